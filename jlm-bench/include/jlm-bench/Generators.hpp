@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_JLMBENCH_GENERATORS_HPP
+#define JLM_JLMBENCH_GENERATORS_HPP
+
+#include <jlm/ir/RvsdgModule.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace jlm {
+namespace bench {
+
+/** \brief Synthetic module generator
+ *
+ * A generator creates a module whose size is determined by a single parameter. All lambdas of the generated modules
+ * have the signature of lambdas created by the LLVM frontend, i.e., they take and return an I/O, memory, and loop
+ * state, such that the modules can be converted to LLVM IR and back.
+ */
+struct Generator {
+  const char * Name;
+  const char * Description;
+  std::unique_ptr<RvsdgModule> (*Generate)(size_t size);
+};
+
+/**
+ * Creates a lambda with \p width independent additions of its argument and constants, which are combined by a
+ * balanced tree of exclusive ors.
+ */
+std::unique_ptr<RvsdgModule>
+CreateWideRegion(size_t width);
+
+/**
+ * Creates a lambda with alternately nested gamma and theta nodes of the nesting depth \p depth.
+ */
+std::unique_ptr<RvsdgModule>
+CreateDeepNesting(size_t depth);
+
+/**
+ * Creates a lambda with a memory state chain of \p length stores and \p length loads through addresses computed
+ * from a pointer argument.
+ */
+std::unique_ptr<RvsdgModule>
+CreateMemoryChain(size_t length);
+
+/**
+ * Creates \p nlambdas exported lambdas, where every lambda calls its predecessor.
+ */
+std::unique_ptr<RvsdgModule>
+CreateManyLambdas(size_t nlambdas);
+
+/**
+ * Creates a lambda with \p nallocas pairs of allocas for integers and pointers. The pointer cells are initialized
+ * with the integer cells and then read and written in a permuted order, such that the points-to sets of the cells
+ * are merged by a unification-based alias analysis.
+ */
+std::unique_ptr<RvsdgModule>
+CreatePointerGraph(size_t nallocas);
+
+/**
+ * @return All generators.
+ */
+const std::vector<Generator> &
+GetGenerators();
+
+}
+}
+
+#endif
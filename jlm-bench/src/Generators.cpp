@@ -0,0 +1,299 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm-bench/Generators.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <jive/rvsdg/binary.hpp>
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <algorithm>
+
+namespace jlm {
+namespace bench {
+
+/**
+ * Creates a function type with the arguments \p arguments and the results \p results. The I/O, memory, and loop
+ * states are appended to both.
+ */
+static FunctionType
+CreateFunctionType(
+  std::vector<const jive::type*> arguments,
+  std::vector<const jive::type*> results)
+{
+  static const iostatetype iOStateType;
+  static const MemoryStateType memoryStateType;
+  static const loopstatetype loopStateType;
+
+  for (auto states : {&arguments, &results}) {
+    states->push_back(&iOStateType);
+    states->push_back(&memoryStateType);
+    states->push_back(&loopStateType);
+  }
+
+  return FunctionType(arguments, results);
+}
+
+/**
+ * Creates an empty module with the binary normal form configured as by the LLVM frontend, i.e., without
+ * flattening, such that the module can be converted to LLVM IR.
+ */
+static std::unique_ptr<RvsdgModule>
+CreateModule(const std::string & name)
+{
+  auto module = RvsdgModule::Create(filepath(name), "", "");
+  jive::binary_op::normal_form(&module->Rvsdg())->set_flatten(false);
+
+  return module;
+}
+
+/**
+ * Finalizes \p lambda with the results \p results and the states of its last three function arguments, and
+ * exports it.
+ */
+static void
+FinalizeAndExport(
+  lambda::node & lambda,
+  std::vector<jive::output*> results)
+{
+  auto nfctarguments = lambda.nfctarguments();
+  for (size_t n = nfctarguments-3; n < nfctarguments; n++)
+    results.push_back(lambda.fctargument(n));
+
+  auto output = lambda.finalize(results);
+  lambda.graph()->add_export(output, {output->type(), lambda.name()});
+}
+
+std::unique_ptr<RvsdgModule>
+CreateWideRegion(size_t width)
+{
+  auto module = CreateModule("wide");
+  auto & graph = module->Rvsdg();
+
+  auto functionType = CreateFunctionType({&jive::bit64}, {&jive::bit64});
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto x = lambda->fctargument(0);
+
+  std::vector<jive::output*> values;
+  for (size_t n = 0; n < std::max(width, size_t(1)); n++) {
+    auto constant = jive::create_bitconstant(lambda->subregion(), 64, n);
+    values.push_back(jive::bitadd_op::create(64, x, constant));
+  }
+
+  while (values.size() > 1) {
+    std::vector<jive::output*> combined;
+    for (size_t n = 0; n+1 < values.size(); n += 2)
+      combined.push_back(jive::bitxor_op::create(64, values[n], values[n+1]));
+    if (values.size() % 2 != 0)
+      combined.push_back(values.back());
+    values = std::move(combined);
+  }
+
+  FinalizeAndExport(*lambda, {values[0]});
+
+  return module;
+}
+
+/**
+ * Creates a gamma node if \p depth is odd, and a theta node otherwise, with the nesting depth \p depth in
+ * \p region.
+ */
+static jive::output *
+CreateNesting(
+  jive::region & region,
+  jive::output * value,
+  size_t depth)
+{
+  if (depth == 0) {
+    auto one = jive::create_bitconstant(&region, 64, 1);
+    return jive::bitadd_op::create(64, value, one);
+  }
+
+  if (depth % 2 != 0) {
+    auto predicate = jive::match(64, {{0, 0}}, 1, 2, value);
+    auto gamma = jive::gamma_node::create(predicate, 2);
+    auto ev = gamma->add_entryvar(value);
+
+    auto value0 = CreateNesting(*gamma->subregion(0), ev->argument(0), depth-1);
+    auto two = jive::create_bitconstant(gamma->subregion(1), 64, 2);
+    auto value1 = jive::bitmul_op::create(64, ev->argument(1), two);
+
+    return gamma->add_exitvar({value0, value1});
+  }
+
+  auto theta = jive::theta_node::create(&region);
+  auto lv = theta->add_loopvar(value);
+
+  auto result = CreateNesting(*theta->subregion(), lv->argument(), depth-1);
+  auto hundred = jive::create_bitconstant(theta->subregion(), 64, 100);
+  auto cmp = jive::bitult_op::create(64, result, hundred);
+
+  lv->result()->divert_to(result);
+  theta->set_predicate(jive::match(1, {{1, 1}}, 0, 2, cmp));
+
+  return lv;
+}
+
+std::unique_ptr<RvsdgModule>
+CreateDeepNesting(size_t depth)
+{
+  auto module = CreateModule("nesting");
+  auto & graph = module->Rvsdg();
+
+  auto functionType = CreateFunctionType({&jive::bit64}, {&jive::bit64});
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+
+  auto result = CreateNesting(*lambda->subregion(), lambda->fctargument(0), depth);
+  FinalizeAndExport(*lambda, {result});
+
+  return module;
+}
+
+std::unique_ptr<RvsdgModule>
+CreateMemoryChain(size_t length)
+{
+  auto module = CreateModule("memory");
+  auto & graph = module->Rvsdg();
+
+  PointerType pointerType(jive::bit64);
+  auto functionType = CreateFunctionType({&pointerType, &jive::bit64}, {&jive::bit64});
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto region = lambda->subregion();
+  auto p = lambda->fctargument(0);
+  auto x = lambda->fctargument(1);
+  jive::output * state = lambda->fctargument(3);
+
+  /*
+   * for i in [0, length):
+   *   p[i] = x + i
+   *   sum = sum + p[i / 2]
+   */
+  jive::output * sum = jive::create_bitconstant(region, 64, 0);
+  for (size_t n = 0; n < length; n++) {
+    auto i = jive::create_bitconstant(region, 64, n);
+    auto address = getelementptr_op::create(p, {i}, pointerType);
+    auto value = jive::bitadd_op::create(64, x, i);
+    state = StoreNode::Create(address, value, {state}, 8)[0];
+
+    auto j = jive::create_bitconstant(region, 64, n/2);
+    auto loadAddress = getelementptr_op::create(p, {j}, pointerType);
+    auto outputs = LoadNode::Create(loadAddress, {state}, 8);
+    sum = jive::bitadd_op::create(64, sum, outputs[0]);
+    state = outputs[1];
+  }
+
+  auto output = lambda->finalize({sum, lambda->fctargument(2), state, lambda->fctargument(4)});
+  graph.add_export(output, {output->type(), lambda->name()});
+
+  return module;
+}
+
+std::unique_ptr<RvsdgModule>
+CreateManyLambdas(size_t nlambdas)
+{
+  auto module = CreateModule("lambdas");
+  auto & graph = module->Rvsdg();
+
+  auto functionType = CreateFunctionType({&jive::bit64}, {&jive::bit64});
+
+  jive::output * predecessor = nullptr;
+  for (size_t n = 0; n < std::max(nlambdas, size_t(1)); n++) {
+    auto lambda = lambda::node::create(graph.root(), functionType, strfmt("f", n), linkage::external_linkage);
+    auto constant = jive::create_bitconstant(lambda->subregion(), 64, n);
+    auto value = jive::bitadd_op::create(64, lambda->fctargument(0), constant);
+
+    jive::output * output;
+    if (predecessor) {
+      auto cv = lambda->add_ctxvar(predecessor);
+      auto results = CallNode::Create(cv, {value, lambda->fctargument(1), lambda->fctargument(2),
+        lambda->fctargument(3)});
+      output = lambda->finalize(results);
+    } else {
+      output = lambda->finalize({value, lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+    }
+
+    graph.add_export(output, {output->type(), lambda->name()});
+    predecessor = output;
+  }
+
+  return module;
+}
+
+std::unique_ptr<RvsdgModule>
+CreatePointerGraph(size_t nallocas)
+{
+  auto module = CreateModule("pointers");
+  auto & graph = module->Rvsdg();
+
+  auto functionType = CreateFunctionType({&jive::bit64}, {&jive::bit64});
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto region = lambda->subregion();
+  auto x = lambda->fctargument(0);
+  nallocas = std::max(nallocas, size_t(1));
+
+  PointerType pointerType(jive::bit64);
+  auto one = jive::create_bitconstant(region, 32, 1);
+
+  std::vector<jive::output*> states({lambda->fctargument(2)});
+  std::vector<jive::output*> integers, pointers;
+  for (size_t n = 0; n < nallocas; n++) {
+    auto integer = alloca_op::create(jive::bit64, one, 8);
+    auto pointer = alloca_op::create(pointerType, one, 8);
+    integers.push_back(integer[0]);
+    pointers.push_back(pointer[0]);
+    states.push_back(integer[1]);
+    states.push_back(pointer[1]);
+  }
+  auto state = MemStateMergeOperator::Create(states);
+
+  /*
+   * pointers[i] = &integers[i]
+   * *pointers[(7 * i + 1) % nallocas] = x
+   * sum = sum + integers[i]
+   */
+  for (size_t n = 0; n < nallocas; n++)
+    state = StoreNode::Create(pointers[n], integers[n], {state}, 8)[0];
+
+  for (size_t n = 0; n < nallocas; n++) {
+    auto outputs = LoadNode::Create(pointers[(7*n + 1) % nallocas], {state}, 8);
+    state = StoreNode::Create(outputs[0], x, {outputs[1]}, 8)[0];
+  }
+
+  jive::output * sum = jive::create_bitconstant(region, 64, 0);
+  for (size_t n = 0; n < nallocas; n++) {
+    auto outputs = LoadNode::Create(integers[n], {state}, 8);
+    sum = jive::bitadd_op::create(64, sum, outputs[0]);
+    state = outputs[1];
+  }
+
+  auto output = lambda->finalize({sum, lambda->fctargument(1), state, lambda->fctargument(3)});
+  graph.add_export(output, {output->type(), lambda->name()});
+
+  return module;
+}
+
+const std::vector<Generator> &
+GetGenerators()
+{
+  static std::vector<Generator> generators({
+    {"wide", "Independent additions in a single region", CreateWideRegion},
+    {"nesting", "Alternately nested gamma and theta nodes", CreateDeepNesting},
+    {"memory", "A long chain of stores and loads", CreateMemoryChain},
+    {"lambdas", "Lambdas that call their predecessor", CreateManyLambdas},
+    {"pointers", "Allocas that store pointers to each other", CreatePointerGraph}
+  });
+
+  return generators;
+}
+
+}
+}
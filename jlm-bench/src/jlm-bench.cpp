@@ -0,0 +1,366 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm-bench/Generators.hpp>
+
+#include <jlm/backend/llvm/jlm2llvm/jlm2llvm.hpp>
+#include <jlm/backend/llvm/rvsdg2jlm/rvsdg2jlm.hpp>
+#include <jlm/frontend/llvm/InterProceduralGraphConversion.hpp>
+#include <jlm/frontend/llvm/LlvmModuleConversion.hpp>
+#include <jlm/ir/ipgraph-module.hpp>
+#include <jlm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/opt/cne.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/FunctionAttributeInference.hpp>
+#include <jlm/opt/FunctionSpecialization.hpp>
+#include <jlm/opt/inlining.hpp>
+#include <jlm/opt/InvariantValueRedirection.hpp>
+#include <jlm/opt/inversion.hpp>
+#include <jlm/opt/LoopIdiomRecognition.hpp>
+#include <jlm/opt/LoopStrengthReduction.hpp>
+#include <jlm/opt/pull.hpp>
+#include <jlm/opt/push.hpp>
+#include <jlm/opt/reduction.hpp>
+#include <jlm/opt/SlpVectorizer.hpp>
+#include <jlm/opt/SparseConditionalConstantPropagation.hpp>
+#include <jlm/opt/StoreForwarding.hpp>
+#include <jlm/opt/unroll.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/CommandLine.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace jlm {
+namespace bench {
+
+/** \brief Benchmark step
+ *
+ * A step is either an optimization, or one of the conversions of the LLVM backend and frontend. The name of an
+ * optimization step is its jlm-opt command line option.
+ */
+struct Step {
+  std::string Name;
+  std::function<std::unique_ptr<optimization>()> CreateOptimization;
+};
+
+template <class T, class... Args> static std::function<std::unique_ptr<optimization>()>
+Factory(Args... args)
+{
+  return [=]() { return std::make_unique<T>(args...); };
+}
+
+static const std::vector<Step> &
+GetSteps()
+{
+  static std::vector<Step> steps({
+    {"AASteensgaardBasic", Factory<aa::SteensgaardBasic>()},
+    {"cne", Factory<cne>()},
+    {"dne", Factory<DeadNodeElimination>()},
+    {"FunctionAttributeInference", Factory<FunctionAttributeInference>()},
+    {"FunctionSpecialization", Factory<FunctionSpecialization>()},
+    {"iln", Factory<fctinline>()},
+    {"InvariantValueRedirection", Factory<InvariantValueRedirection>()},
+    {"LoopIdiomRecognition", Factory<LoopIdiomRecognition>()},
+    {"LoopStrengthReduction", Factory<LoopStrengthReduction>()},
+    {"psh", Factory<pushout>()},
+    {"pll", Factory<pullin>()},
+    {"red", Factory<nodereduction>()},
+    {"ivt", Factory<tginversion>()},
+    {"SlpVectorizer", Factory<SlpVectorizer>()},
+    {"SparseConditionalConstantPropagation", Factory<SparseConditionalConstantPropagation>()},
+    {"StoreForwarding", Factory<StoreForwarding>()},
+    {"url", Factory<loopunroll>(4)},
+    {"rvsdg2jlm", nullptr},
+    {"jlm2llvm", nullptr},
+    {"llvm2jlm", nullptr},
+    {"jlm2rvsdg", nullptr}
+  });
+
+  return steps;
+}
+
+/** \brief Benchmark measurement
+ *
+ * Node counts are the number of RVSDG nodes before and after an optimization. For conversions, nodes_before is the
+ * number of nodes of the generated module, and nodes_after the number of nodes of the module that results from
+ * converting it to LLVM IR and back.
+ */
+struct Measurement {
+  size_t TimeNs = std::numeric_limits<size_t>::max();
+  size_t NodesBefore = 0;
+  size_t NodesAfter = 0;
+  size_t GeneratorPeakRssKb = 0;
+  size_t PeakRssKb = 0;
+};
+
+static size_t
+GetPeakRssKb()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+static size_t
+RunOptimization(
+  const Step & step,
+  RvsdgModule & module,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  auto optimization = step.CreateOptimization();
+
+  jlm::timer timer;
+  timer.start();
+  optimization->run(module, statisticsDescriptor);
+  timer.stop();
+
+  return timer.ns();
+}
+
+/**
+ * Converts \p module to LLVM IR and back. Only the conversion \p step is timed.
+ */
+static size_t
+RunConversion(
+  const Step & step,
+  const RvsdgModule & module,
+  const StatisticsDescriptor & statisticsDescriptor,
+  size_t & nnodes)
+{
+  std::unordered_map<std::string, jlm::timer> timers;
+
+  timers[step.Name].start();
+  auto ipgModule = rvsdg2jlm::rvsdg2jlm(module, statisticsDescriptor);
+  timers["rvsdg2jlm"].stop();
+
+  llvm::LLVMContext context;
+  timers["jlm2llvm"].start();
+  auto llvmModule = jlm2llvm::convert(*ipgModule, context);
+  timers["jlm2llvm"].stop();
+
+  ipgModule.reset();
+  timers["llvm2jlm"].start();
+  ipgModule = ConvertLlvmModule(*llvmModule);
+  timers["llvm2jlm"].stop();
+
+  timers["jlm2rvsdg"].start();
+  auto rvsdgModule = ConvertInterProceduralGraphModule(*ipgModule, statisticsDescriptor);
+  timers["jlm2rvsdg"].stop();
+
+  nnodes = jive::nnodes(rvsdgModule->Rvsdg().root());
+
+  return timers[step.Name].ns();
+}
+
+/**
+ * Runs \p step on modules created by \p generator. The measurement is performed in the calling process, and the
+ * time is the minimum of \p nrepetitions runs.
+ */
+static Measurement
+Measure(
+  const Generator & generator,
+  size_t size,
+  const Step & step,
+  size_t nrepetitions)
+{
+  StatisticsDescriptor statisticsDescriptor;
+
+  Measurement measurement;
+  for (size_t n = 0; n < std::max(nrepetitions, size_t(1)); n++) {
+    auto module = generator.Generate(size);
+    measurement.NodesBefore = jive::nnodes(module->Rvsdg().root());
+    measurement.GeneratorPeakRssKb = std::max(measurement.GeneratorPeakRssKb, GetPeakRssKb());
+
+    size_t time;
+    if (step.CreateOptimization) {
+      time = RunOptimization(step, *module, statisticsDescriptor);
+      measurement.NodesAfter = jive::nnodes(module->Rvsdg().root());
+    } else {
+      time = RunConversion(step, *module, statisticsDescriptor, measurement.NodesAfter);
+    }
+
+    measurement.TimeNs = std::min(measurement.TimeNs, time);
+  }
+  measurement.PeakRssKb = GetPeakRssKb();
+
+  return measurement;
+}
+
+/**
+ * Performs a measurement in a child process, such that the peak resident set size only covers a single
+ * measurement, and a failing or timed out measurement does not terminate the benchmark. The child process is
+ * killed after \p timeout seconds.
+ *
+ * @return A JSON object with the measurement.
+ */
+static std::string
+MeasureInChild(
+  const Generator & generator,
+  size_t size,
+  const Step & step,
+  size_t nrepetitions,
+  unsigned timeout)
+{
+  auto header = strfmt("{\"generator\": \"", generator.Name, "\", \"size\": ", size,
+    ", \"step\": \"", step.Name, "\", ");
+
+  int fds[2];
+  if (pipe(fds) != 0)
+    return header + "\"status\": \"error\"}";
+
+  fflush(stdout);
+  auto pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    alarm(timeout);
+
+    auto m = Measure(generator, size, step, nrepetitions);
+    auto json = strfmt("\"status\": \"ok\", \"time_ns\": ", m.TimeNs,
+      ", \"nodes_before\": ", m.NodesBefore, ", \"nodes_after\": ", m.NodesAfter,
+      ", \"generator_peak_rss_kb\": ", m.GeneratorPeakRssKb, ", \"peak_rss_kb\": ", m.PeakRssKb, "}");
+    if (write(fds[1], json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+      _exit(EXIT_FAILURE);
+    _exit(EXIT_SUCCESS);
+  }
+  close(fds[1]);
+
+  std::string json;
+  char buffer[256];
+  ssize_t nbytes;
+  while ((nbytes = read(fds[0], buffer, sizeof(buffer))) > 0)
+    json.append(buffer, nbytes);
+  close(fds[0]);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
+    return header + json;
+  if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+    return header + "\"status\": \"timeout\"}";
+
+  return header + "\"status\": \"failed\"}";
+}
+
+template <class T> static std::vector<const T*>
+Select(
+  const std::vector<T> & items,
+  const std::vector<std::string> & names,
+  const char * kind)
+{
+  if (names.empty()) {
+    std::vector<const T*> selected;
+    for (auto & item : items)
+      selected.push_back(&item);
+    return selected;
+  }
+
+  std::vector<const T*> selected;
+  for (auto & name : names) {
+    auto it = std::find_if(items.begin(), items.end(), [&](const T & item) { return item.Name == name; });
+    if (it == items.end()) {
+      std::cerr << "Unknown " << kind << ": " << name << "\n";
+      exit(EXIT_FAILURE);
+    }
+    selected.push_back(&*it);
+  }
+
+  return selected;
+}
+
+}
+}
+
+int
+main(int argc, char ** argv)
+{
+  using namespace llvm;
+  using namespace jlm::bench;
+
+  std::string generatorsDescription("Run the comma-separated list of generators. Default are all of:");
+  for (auto & generator : GetGenerators())
+    generatorsDescription += strfmt(" ", generator.Name, " (", generator.Description, ")");
+
+  cl::list<std::string> generatorNames(
+    "generators",
+    cl::CommaSeparated,
+    cl::desc(generatorsDescription),
+    cl::value_desc("generators"));
+
+  cl::list<std::string> stepNames(
+    "steps",
+    cl::CommaSeparated,
+    cl::desc("Run the comma-separated list of steps, i.e., jlm-opt optimizations or the conversions "
+             "rvsdg2jlm, jlm2llvm, llvm2jlm, and jlm2rvsdg. Default are all steps."),
+    cl::value_desc("steps"));
+
+  cl::list<size_t> sizes(
+    "sizes",
+    cl::CommaSeparated,
+    cl::desc("Generate modules with the comma-separated list of sizes. Default is 250,1000,4000."),
+    cl::value_desc("sizes"));
+
+  cl::opt<size_t> nrepetitions(
+    "repetitions",
+    cl::init(1),
+    cl::desc("Report the minimum time of <n> runs."),
+    cl::value_desc("n"));
+
+  cl::opt<unsigned> timeout(
+    "timeout",
+    cl::init(60),
+    cl::desc("Abort a measurement after <seconds>."),
+    cl::value_desc("seconds"));
+
+  cl::opt<std::string> ofile(
+    "o",
+    cl::desc("Write JSON output to <file>. Default is stdout."),
+    cl::value_desc("file"));
+
+  cl::ParseCommandLineOptions(argc, argv, "Scalability benchmarks for jlm\n");
+
+  auto generators = Select(GetGenerators(), generatorNames, "generator");
+  auto steps = Select(GetSteps(), stepNames, "step");
+  std::vector<size_t> moduleSizes(sizes.begin(), sizes.end());
+  if (moduleSizes.empty())
+    moduleSizes = {250, 1000, 4000};
+
+  std::vector<std::string> measurements;
+  for (auto generator : generators) {
+    for (auto size : moduleSizes) {
+      for (auto step : steps) {
+        std::cerr << generator->Name << " " << size << " " << step->Name << "\n";
+        measurements.push_back(MeasureInChild(*generator, size, *step, nrepetitions, timeout));
+      }
+    }
+  }
+
+  std::string json("{\n  \"benchmarks\": [\n");
+  for (size_t n = 0; n < measurements.size(); n++)
+    json += "    " + measurements[n] + (n+1 < measurements.size() ? ",\n" : "\n");
+  json += "  ]\n}\n";
+
+  if (ofile.empty()) {
+    std::cout << json;
+  } else {
+    std::ofstream file(ofile);
+    file << json;
+  }
+
+  return 0;
+}
@@ -7,6 +7,7 @@
 #define JLM_JLMHLS_CMDLINE_HPP
 
 #include <jlm/util/file.hpp>
+#include <jlm/util/Statistics.hpp>
 
 namespace jlm {
 
@@ -23,9 +24,12 @@ public:
 	jlm::filepath inputFile;
 	jlm::filepath outputFolder;
 	OutputFormat format;
+	StatisticsDescriptor sd;
 	std::string hlsFunction;
 	bool extractHlsFunction = false;
 	bool useCirct = false;
+	bool perfCounters = false;
+	size_t targetII = 1;
 };
 
 void
@@ -32,6 +32,20 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	, cl::desc("Write output to <folder>")
 	, cl::value_desc("folder"));
 
+	std::string desc("Write stats to <file>. Default is " + options.sd.filepath().to_str() + ".");
+	cl::opt<std::string> sfile(
+	  "s"
+	, cl::desc(desc)
+	, cl::value_desc("file"));
+
+	cl::list<StatisticsDescriptor::StatisticsId> printStatistics(
+		cl::values(
+		  clEnumValN(
+			StatisticsDescriptor::StatisticsId::FirrtlGeneration,
+			"print-firrtl-generation",
+			"Write FIRRTL generation statistics to file."))
+	, cl::desc("Write statistics"));
+
 	cl::opt<std::string> hlsFunction(
 	  "hls-function"
 	, cl::Prefix
@@ -48,6 +62,17 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	, cl::Prefix
 	, cl::desc("Use CIRCT to generate FIRRTL"));
 
+	cl::opt<bool> perfCounters(
+	  "perf-counters"
+	, cl::Prefix
+	, cl::desc("Instrument the circuit and harness with handshake performance counters"));
+
+	cl::opt<size_t> targetII(
+	  "target-ii"
+	, cl::desc("Initiation interval that buffers are sized for")
+	, cl::value_desc("cycles")
+	, cl::init(1));
+
 	cl::opt<OutputFormat> format(
 		cl::values(
 		  clEnumValN(OutputFormat::firrtl, "fir", "Output FIRRTL [default]")
@@ -60,16 +85,33 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 		throw jlm::error("jlm-hls no output directory provided, i.e, -o.\n");
 	}
 
+	if (perfCounters && useCirct) {
+		throw jlm::error("jlm-hls: --perf-counters is not supported with --circt.\n");
+	}
+
+	if (targetII == 0) {
+		throw jlm::error("jlm-hls: --target-ii has to be at least 1.\n");
+	}
+
 	if (extractHlsFunction && hlsFunction.empty()) {
 		throw jlm::error("jlm-hls: --hls-function is not specifided.\n         which is required for --extract\n");
 	}
 
+	if (!sfile.empty())
+		options.sd.set_file(sfile);
+
+	std::unordered_set<StatisticsDescriptor::StatisticsId> printStatisticsIds(
+		printStatistics.begin(), printStatistics.end());
+
 	options.inputFile = inputFile;
 	options.hlsFunction = hlsFunction;
 	options.outputFolder = outputFolder;
 	options.extractHlsFunction = extractHlsFunction;
 	options.useCirct = useCirct;
+	options.perfCounters = perfCounters;
 	options.format = format;
+	options.targetII = targetII;
+	options.sd.SetPrintStatisticsIds(printStatisticsIds);
 }
 
 } // jlm
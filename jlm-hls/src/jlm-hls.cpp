@@ -16,6 +16,8 @@
 #include <jlm/frontend/llvm/LlvmModuleConversion.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
 
 #include <jlm-hls/cmdline.hpp>
 
@@ -25,6 +27,45 @@
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/SourceMgr.h>
 
+class FirrtlGenerationStatistics final : public jlm::Statistics {
+public:
+	~FirrtlGenerationStatistics() override
+	= default;
+
+	explicit
+	FirrtlGenerationStatistics(jlm::filepath sourceFile)
+	: Statistics(jlm::StatisticsDescriptor::StatisticsId::FirrtlGeneration)
+	, NumBytes_(0)
+	, SourceFile_(std::move(sourceFile))
+	{}
+
+	void
+	Start() noexcept
+	{
+		Timer_.start();
+	}
+
+	void
+	Stop(size_t numBytes) noexcept
+	{
+		Timer_.stop();
+		NumBytes_ = numBytes;
+	}
+
+	[[nodiscard]] std::string
+	ToString() const override
+	{
+		return strfmt("FirrtlGeneration ",
+			SourceFile_.to_str(), " ",
+			"#Bytes:", NumBytes_, " ",
+			"Time[ns]:", Timer_.ns());
+	}
+
+private:
+	size_t NumBytes_;
+	jlm::timer Timer_;
+	jlm::filepath SourceFile_;
+};
 
 static void
 stringToFile(
@@ -68,10 +109,9 @@ main(int argc, char ** argv)
 
 	/* LLVM to JLM pass */
 	auto jlmModule = jlm::ConvertLlvmModule(*llvmModule);
-	jlm::StatisticsDescriptor sd;
 	auto rvsdgModule = jlm::ConvertInterProceduralGraphModule(
 					*jlmModule,
-					sd);
+					flags.sd);
 
 	if (flags.extractHlsFunction) {
 		auto hlsFunction = jlm::hls::split_hls_function(
@@ -88,26 +128,31 @@ main(int argc, char ** argv)
 	}
 
 	if (flags.format == jlm::OutputFormat::firrtl) {
-		jlm::hls::rvsdg2rhls(*rvsdgModule);
+		jlm::hls::rvsdg2rhls(*rvsdgModule, flags.targetII);
 
 		std::string output;
+		FirrtlGenerationStatistics statistics(flags.inputFile);
+		statistics.Start();
 		if (flags.useCirct) {
 			jlm::hls::MLIRGen hls;
 			output = hls.run(*rvsdgModule);
 		} else {
-			jlm::hls::FirrtlHLS hls;
+			jlm::hls::FirrtlHLS hls(flags.perfCounters);
 			output = hls.run(*rvsdgModule);
 		}
+		statistics.Stop(output.size());
+		flags.sd.PrintStatistics(statistics);
+
 		stringToFile(
 			output,
 			flags.outputFolder.path() + "/jlm_hls.fir");
 
-		jlm::hls::VerilatorHarnessHLS vhls;
+		jlm::hls::VerilatorHarnessHLS vhls(flags.perfCounters);
 		stringToFile(
 			vhls.run(*rvsdgModule),
 			flags.outputFolder.path() + "/jlm_hls_harness.cpp");
 	} else if (flags.format == jlm::OutputFormat::dot) {
-		jlm::hls::rvsdg2rhls(*rvsdgModule);
+		jlm::hls::rvsdg2rhls(*rvsdgModule, flags.targetII);
 
 		jlm::hls::DotHLS dhls;
 		stringToFile(
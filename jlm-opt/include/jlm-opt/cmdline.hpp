@@ -6,9 +6,11 @@
 #ifndef JLM_JLMOPT_CMDLINE_HPP
 #define JLM_JLMOPT_CMDLINE_HPP
 
+#include <jlm/opt/CompilationBudget.hpp>
 #include <jlm/util/file.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -24,6 +26,8 @@ public:
 	: ifile("")
 	, ofile("")
 	, format(outputformat::llvm)
+	, functionCache("")
+	, server("")
 	{}
 
 	jlm::filepath ifile;
@@ -31,6 +35,14 @@ public:
 	outputformat format;
 	StatisticsDescriptor sd;
 	std::vector<jlm::optimization*> optimizations;
+	/* the function cache directory, or empty if no function cache is used */
+	jlm::filepath functionCache;
+	/* a description of the optimizations and their parameters */
+	std::string pipeline;
+	/* the compile-time budgets, or empty if the pipeline is not bounded */
+	std::optional<CompilationBudget> compilationBudget;
+	/* the socket of the server, or empty if jlm-opt does not run as server */
+	jlm::filepath server;
 };
 
 void
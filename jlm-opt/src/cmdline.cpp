@@ -8,64 +8,122 @@
 #include <jlm/opt/alias-analyses/Optimization.hpp>
 #include <jlm/opt/cne.hpp>
 #include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/FunctionAttributeInference.hpp>
+#include <jlm/opt/FunctionSpecialization.hpp>
 #include <jlm/opt/inlining.hpp>
 #include <jlm/opt/InvariantValueRedirection.hpp>
 #include <jlm/opt/pull.hpp>
 #include <jlm/opt/push.hpp>
 #include <jlm/opt/inversion.hpp>
+#include <jlm/opt/LoopIdiomRecognition.hpp>
+#include <jlm/opt/LoopStrengthReduction.hpp>
 #include <jlm/opt/unroll.hpp>
 #include <jlm/opt/reduction.hpp>
+#include <jlm/opt/SlpVectorizer.hpp>
+#include <jlm/opt/SparseConditionalConstantPropagation.hpp>
+#include <jlm/opt/StoreForwarding.hpp>
 #include <jlm/opt/optimization.hpp>
 
 #include <llvm/Support/CommandLine.h>
 
+#include <algorithm>
+
 namespace jlm {
 
 enum class OptimizationId {
   AASteensgaardBasic,
   cne,
   dne,
+  FunctionAttributeInference,
+  FunctionSpecialization,
   iln,
   InvariantValueRedirection,
+  LoopIdiomRecognition,
+  LoopStrengthReduction,
   psh,
   red,
   ivt,
+  SlpVectorizer,
+  SparseConditionalConstantPropagation,
+  StoreForwarding,
   url,
   pll,
 };
 
 static jlm::optimization *
-GetOptimization(enum OptimizationId id)
+GetOptimization(
+  enum OptimizationId id,
+  const jlm::fctinline & inlining,
+  const jlm::FunctionSpecialization & specialization,
+  const jlm::loopunroll & unrolling,
+  const jlm::nodereduction & reduction)
 {
   static jlm::aa::SteensgaardBasic steensgaardBasic;
   static jlm::cne cne;
   static jlm::DeadNodeElimination dne;
+  static jlm::FunctionAttributeInference functionAttributeInference;
+  static jlm::FunctionSpecialization functionSpecialization;
   static jlm::fctinline fctinline;
   static jlm::InvariantValueRedirection invariantValueRedirection;
+  static jlm::LoopIdiomRecognition loopIdiomRecognition;
+  static jlm::LoopStrengthReduction loopStrengthReduction;
   static jlm::pullin pullin;
   static jlm::pushout pushout;
   static jlm::tginversion tginversion;
   static jlm::loopunroll loopunroll(4);
   static jlm::nodereduction nodereduction;
+  static jlm::SlpVectorizer slpVectorizer;
+  static jlm::SparseConditionalConstantPropagation sparseConditionalConstantPropagation;
+  static jlm::StoreForwarding storeForwarding;
+
+  fctinline = inlining;
+  functionSpecialization = specialization;
+  loopunroll = unrolling;
+  nodereduction = reduction;
 
   static std::unordered_map<OptimizationId, jlm::optimization*>
     map({
           {OptimizationId::AASteensgaardBasic,        &steensgaardBasic},
           {OptimizationId::cne,                       &cne},
           {OptimizationId::dne,                       &dne},
+          {OptimizationId::FunctionAttributeInference, &functionAttributeInference},
+          {OptimizationId::FunctionSpecialization,    &functionSpecialization},
           {OptimizationId::iln,                       &fctinline},
           {OptimizationId::InvariantValueRedirection, &invariantValueRedirection},
+          {OptimizationId::LoopIdiomRecognition,      &loopIdiomRecognition},
+          {OptimizationId::LoopStrengthReduction,     &loopStrengthReduction},
           {OptimizationId::pll,                       &pullin},
           {OptimizationId::psh,                       &pushout},
           {OptimizationId::ivt,                       &tginversion},
           {OptimizationId::url,                       &loopunroll},
-          {OptimizationId::red,                       &nodereduction}
+          {OptimizationId::red,                       &nodereduction},
+          {OptimizationId::SlpVectorizer,             &slpVectorizer},
+          {OptimizationId::SparseConditionalConstantPropagation, &sparseConditionalConstantPropagation},
+          {OptimizationId::StoreForwarding,           &storeForwarding}
         });
 
   JLM_ASSERT(map.find(id) != map.end());
   return map[id];
 }
 
+/*
+ * Returns true if the optimization transforms every lambda independently of all other lambdas. Only pipelines of
+ * such optimizations can use the function cache.
+ */
+static bool
+IsIntraProcedural(enum OptimizationId id)
+{
+  switch (id) {
+    case OptimizationId::AASteensgaardBasic:
+    case OptimizationId::FunctionAttributeInference:
+    case OptimizationId::FunctionSpecialization:
+    case OptimizationId::iln:
+      return false;
+    default:
+      return true;
+  }
+}
+
 void
 parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 {
@@ -109,6 +167,9 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
         clEnumValN(StatisticsDescriptor::StatisticsId::CommonNodeElimination,
                    "print-cne-stat",
                    "Write common node elimination statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::CompilationBudget,
+                   "printCompilationBudget",
+                   "Write compilation budget decisions to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::ControlFlowRecovery,
                    "print-cfr-time",
                    "Write control flow recovery statistics to file."),
@@ -118,15 +179,30 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
         clEnumValN(StatisticsDescriptor::StatisticsId::DeadNodeElimination,
                    "print-dne-stat",
                    "Write dead node elimination statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::FunctionAttributeInference,
+                   "printFunctionAttributeInference",
+                   "Write function attribute inference statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::FunctionCache,
+                   "printFunctionCache",
+                   "Write function cache statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::FunctionInlining,
                    "print-iln-stat",
                    "Write function inlining statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::FunctionSpecialization,
+                   "printFunctionSpecialization",
+                   "Write function specialization statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::InvariantValueRedirection,
                    "printInvariantValueRedirection",
                    "Write invariant value redirection statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::JlmToRvsdgConversion,
                    "print-jlm-rvsdg-conversion",
                    "Write Jlm to RVSDG conversion statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::LoopIdiomRecognition,
+                   "printLoopIdiomRecognition",
+                   "Write loop idiom recognition statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::LoopStrengthReduction,
+                   "printLoopStrengthReduction",
+                   "Write loop strength reduction statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::LoopUnrolling,
                    "print-unroll-stat",
                    "Write loop unrolling statistics to file."),
@@ -138,7 +214,7 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
                    "Write node push statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::ReduceNodes,
                    "print-reduction-stat",
-                   "Write node reduction statistics to file."),
+                   "Write node reduction statistics, including the rewrites of every rule, to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::RvsdgConstruction,
                    "print-rvsdg-construction",
                    "Write RVSDG construction statistics to file."),
@@ -148,12 +224,21 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
         clEnumValN(StatisticsDescriptor::StatisticsId::RvsdgOptimization,
                    "print-rvsdg-optimization",
                    "Write RVSDG optimization statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::SlpVectorizer,
+                   "printSlpVectorizer",
+                   "Write SLP vectorizer statistics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::SparseConditionalConstantPropagation,
+                   "printSparseConditionalConstantPropagation",
+                   "Write sparse conditional constant propagation statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::SteensgaardAnalysis,
                    "print-steensgaard-analysis",
                    "Write Steensgaard analysis statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::SteensgaardPointsToGraphConstruction,
                    "print-steensgaard-pointstograph-construction",
                    "Write Steensgaard PointsTo Graph construction statisitics to file."),
+        clEnumValN(StatisticsDescriptor::StatisticsId::StoreForwarding,
+                   "printStoreForwarding",
+                   "Write store forwarding statistics to file."),
         clEnumValN(StatisticsDescriptor::StatisticsId::ThetaGammaInversion,
                    "print-ivt-stat",
                    "Write theta-gamma inversion statistics to file.")),
@@ -172,19 +257,121 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
         "AASteensgaardBasic",
         "Steensgaard alias analysis with basic memory state encoding.")
       , clEnumValN(jlm::OptimizationId::cne, "cne", "Common node elimination")
-      , clEnumValN(jlm::OptimizationId::dne, "dne", "Dead node elimination")
+      , clEnumValN(jlm::OptimizationId::dne, "dne", "Dead node elimination"),
+      clEnumValN(
+        jlm::OptimizationId::FunctionAttributeInference,
+        "FunctionAttributeInference",
+        "Function attribute inference"),
+      clEnumValN(
+        jlm::OptimizationId::FunctionSpecialization,
+        "FunctionSpecialization",
+        "Specialize functions for constant call-site arguments")
       , clEnumValN(jlm::OptimizationId::iln, "iln", "Function inlining"),
       clEnumValN(
         jlm::OptimizationId::InvariantValueRedirection,
         "InvariantValueRedirection",
-        "Invariant Value Redirection")
+        "Invariant Value Redirection"),
+      clEnumValN(
+        jlm::OptimizationId::LoopIdiomRecognition,
+        "LoopIdiomRecognition",
+        "Replace array initialization and copy loops with Memset and Memcpy"),
+      clEnumValN(
+        jlm::OptimizationId::LoopStrengthReduction,
+        "LoopStrengthReduction",
+        "Induction variable strength reduction and linear function test replacement")
       , clEnumValN(jlm::OptimizationId::psh, "psh", "Node push out")
       , clEnumValN(jlm::OptimizationId::pll, "pll", "Node pull in")
-      , clEnumValN(jlm::OptimizationId::red, "red", "Node reductions")
+      , clEnumValN(jlm::OptimizationId::red, "red", "Node reductions"),
+      clEnumValN(
+        jlm::OptimizationId::SlpVectorizer,
+        "SlpVectorizer",
+        "Superword-level parallelism vectorization"),
+      clEnumValN(
+        jlm::OptimizationId::SparseConditionalConstantPropagation,
+        "SparseConditionalConstantPropagation",
+        "Sparse conditional constant propagation"),
+      clEnumValN(
+        jlm::OptimizationId::StoreForwarding,
+        "StoreForwarding",
+        "Store-to-load forwarding and dead store elimination")
       , clEnumValN(jlm::OptimizationId::ivt, "ivt", "Theta-gamma inversion")
       , clEnumValN(jlm::OptimizationId::url, "url", "Loop unrolling"))
     , cl::desc("Perform optimization"));
 
+  jlm::fctinline defaultInlining;
+  cl::opt<size_t> inliningThreshold(
+    "iln-threshold",
+    cl::init(defaultInlining.threshold()),
+    cl::desc("Inline call sites whose cost does not exceed <nodes>."),
+    cl::value_desc("nodes"));
+
+  cl::opt<size_t> inliningGrowth(
+    "iln-growth",
+    cl::init(defaultInlining.growth()),
+    cl::desc("Let inlining grow the module by at most <percent>."),
+    cl::value_desc("percent"));
+
+  jlm::FunctionSpecialization defaultSpecialization;
+  cl::opt<size_t> specializationGrowth(
+    "specialization-growth",
+    cl::init(defaultSpecialization.GetGrowth()),
+    cl::desc("Let function specialization grow the module by at most <percent>."),
+    cl::value_desc("percent"));
+
+  cl::opt<size_t> unrollingBudget(
+    "url-budget",
+    cl::init(0),
+    cl::desc("Unroll every loop individually such that its unrolled body has at most <nodes>. "
+             "Loops with few known iterations are unrolled completely. "
+             "If zero, innermost loops are unrolled by a factor of four."),
+    cl::value_desc("nodes"));
+
+  cl::opt<bool> reductionTiming(
+    "red-timing",
+    cl::init(false),
+    cl::desc("Measure the time of every rewrite rule in the node reduction statistics."));
+
+  cl::opt<std::string> functionCache(
+    "function-cache",
+    cl::desc("Reuse optimized functions from the cache in <directory>. "
+             "Only supported for intraprocedural optimizations."),
+    cl::value_desc("directory"));
+
+  cl::opt<size_t> moduleTimeBudget(
+    "module-time-budget",
+    cl::desc("Only run dead node elimination and node reductions on the module after <ms>."),
+    cl::value_desc("ms"));
+
+  cl::opt<size_t> moduleGrowthBudget(
+    "module-growth-budget",
+    cl::desc("Only run dead node elimination and node reductions on the module "
+             "after it grew by more than <percent>."),
+    cl::value_desc("percent"));
+
+  cl::opt<size_t> lambdaTimeBudget(
+    "lambda-time-budget",
+    cl::desc("Optimize every function separately, and only run dead node elimination and node reductions on it "
+             "after <ms>. Only supported for intraprocedural optimizations."),
+    cl::value_desc("ms"));
+
+  cl::opt<size_t> lambdaGrowthBudget(
+    "lambda-growth-budget",
+    cl::desc("Optimize every function separately, and only run dead node elimination and node reductions on it "
+             "after it grew by more than <percent>. Only supported for intraprocedural optimizations."),
+    cl::value_desc("percent"));
+
+  cl::opt<size_t> coldThreshold(
+    "cold-threshold",
+    cl::init(0),
+    cl::desc("Only run dead node elimination and node reductions on functions with fewer than <nodes>. "
+             "Functions with the cold attribute take this path whenever a budget or threshold is given."),
+    cl::value_desc("nodes"));
+
+  cl::opt<std::string> server(
+    "server",
+    cl::desc("Run as server that listens for jlm-opt invocations on the Unix domain socket <socket>."),
+    cl::value_desc("socket"));
+
 	cl::ParseCommandLineOptions(argc, argv);
 
 	if (!ofile.empty())
@@ -193,9 +380,45 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	if (!sfile.empty())
 		options.sd.set_file(sfile);
 
+	jlm::fctinline inlining(inliningThreshold, inliningGrowth);
+	jlm::FunctionSpecialization specialization(specializationGrowth);
+	jlm::loopunroll unrolling(4, unrollingBudget);
+	jlm::nodereduction reduction(reductionTiming);
 	std::vector<jlm::optimization*> optimizations;
 	for (auto & optid : optids)
-		optimizations.push_back(GetOptimization(optid));
+		optimizations.push_back(GetOptimization(optid, inlining, specialization, unrolling, reduction));
+
+  std::string pipeline;
+  for (size_t n = 0; n < optids.size(); n++)
+    pipeline += std::string(argv[optids.getPosition(n)]) + " ";
+  pipeline += "--url-budget=" + std::to_string(unrollingBudget);
+
+  if (!functionCache.empty()) {
+    if (std::all_of(optids.begin(), optids.end(), IsIntraProcedural))
+      options.functionCache = functionCache;
+    else
+      errs() << "Function cache disabled: The pipeline contains interprocedural optimizations.\n";
+  }
+
+  auto GetBudget = [](const cl::opt<size_t> & option)
+  {
+    return option.getNumOccurrences() != 0 ? std::make_optional<size_t>(option) : std::nullopt;
+  };
+
+  CompilationBudget::Limits moduleLimits({GetBudget(moduleTimeBudget), GetBudget(moduleGrowthBudget)});
+  CompilationBudget::Limits lambdaLimits({GetBudget(lambdaTimeBudget), GetBudget(lambdaGrowthBudget)});
+  if ((lambdaLimits.Time || lambdaLimits.Growth) && !std::all_of(optids.begin(), optids.end(), IsIntraProcedural)) {
+    errs() << "Function budgets disabled: The pipeline contains interprocedural optimizations.\n";
+    lambdaLimits = {};
+  }
+
+  if (moduleLimits.Time || moduleLimits.Growth || lambdaLimits.Time || lambdaLimits.Growth
+      || coldThreshold.getNumOccurrences() != 0) {
+    if (!options.functionCache.to_str().empty())
+      errs() << "Compilation budgets disabled: They are not supported with the function cache.\n";
+    else
+      options.compilationBudget = CompilationBudget(moduleLimits, lambdaLimits, coldThreshold);
+  }
 
   std::unordered_set<StatisticsDescriptor::StatisticsId> printStatisticsIds(
     printStatistics.begin(), printStatistics.end());
@@ -203,6 +426,8 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	options.ifile = ifile;
 	options.format = format;
 	options.optimizations = optimizations;
+	options.pipeline = pipeline;
+	options.server = server;
   options.sd.SetPrintStatisticsIds(printStatisticsIds);
 }
 
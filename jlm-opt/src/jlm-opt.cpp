@@ -12,7 +12,9 @@
 #include <jlm/ir/ipgraph-module.hpp>
 #include <jlm/ir/operators.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/FunctionCache.hpp>
 #include <jlm/opt/optimization.hpp>
+#include <jlm/tooling/JlmOptServer.hpp>
 
 #include <jlm-opt/cmdline.hpp>
 
@@ -102,23 +104,50 @@ print(
 	formatters[format](rm, fp, sd);
 }
 
-int
-main(int argc, char ** argv)
+static int
+run(const char * executable, const jlm::cmdline_options & flags)
 {
-	jlm::cmdline_options flags;
-	parse_cmdline(argc, argv, flags);
-
 	llvm::LLVMContext ctx;
-	auto llvm_module = parse_llvm_file(argv[0], flags.ifile, ctx);
+	auto llvm_module = parse_llvm_file(executable, flags.ifile, ctx);
 
 	auto jlm_module = construct_jlm_module(*llvm_module);
 
 	llvm_module.reset();
 	auto rvsdgModule = jlm::ConvertInterProceduralGraphModule(*jlm_module, flags.sd);
 
-	optimize(*rvsdgModule, flags.sd, flags.optimizations);
+	if (!flags.functionCache.to_str().empty()) {
+		jlm::FunctionCache functionCache(flags.functionCache, flags.pipeline);
+		functionCache.Run(*rvsdgModule, flags.sd, flags.optimizations);
+	} else if (flags.compilationBudget.has_value()) {
+		flags.compilationBudget->Run(*rvsdgModule, flags.sd, flags.optimizations);
+	} else {
+		optimize(*rvsdgModule, flags.sd, flags.optimizations);
+	}
 
 	print(*rvsdgModule, flags.ofile, flags.format, flags.sd);
 
 	return 0;
 }
+
+int
+main(int argc, char ** argv)
+{
+	jlm::cmdline_options flags;
+	parse_cmdline(argc, argv, flags);
+
+	if (flags.server == "")
+		return run(argv[0], flags);
+
+	jlm::JlmOptServer server(flags.server);
+	return server.Run([](int argc, char ** argv)
+	{
+		jlm::cmdline_options flags;
+		parse_cmdline(argc, argv, flags);
+		if (!flags.server.to_str().empty()) {
+			std::cerr << argv[0] << ": Requests cannot start a server.\n";
+			return EXIT_FAILURE;
+		}
+
+		return run(argv[0], flags);
+	});
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_RVSDG_CHANGE_LOG_HPP
+#define JIVE_RVSDG_CHANGE_LOG_HPP
+
+#include <stddef.h>
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace jive {
+
+class argument;
+class input;
+class node;
+class node_input;
+class node_output;
+class output;
+class region;
+class result;
+
+/**
+	\brief Records the changes to a graph since a checkpoint
+
+	The log records node creation and removal, input diversion, and the addition and removal of node
+	inputs and outputs as well as region arguments and results. Removed objects are unlinked from the
+	graph, but kept alive by the log, such that \ref rollback() can link them in again. A rollback
+	therefore takes time proportional to the number of changes since the checkpoint. Removed objects
+	are destroyed when the outermost checkpoint is committed.
+
+	Checkpoints can be nested. A rollback undoes the changes since the innermost checkpoint, and a
+	commit of an inner checkpoint merges its changes into the enclosing checkpoint.
+
+	Undone removals append the restored nodes to the node lists of their region, i.e., the order of
+	the nodes within a region is not restored.
+*/
+class change_log final {
+	enum class change_kind {
+		node_create,
+		node_remove,
+		input_divert,
+		input_add,
+		input_remove,
+		output_add,
+		output_remove,
+		argument_add,
+		argument_remove,
+		result_add,
+		result_remove
+	};
+
+	struct change {
+		change_kind kind;
+		/* the changed node, or the node of the changed region */
+		jive::node * node;
+		jive::region * region;
+		jive::input * input;
+		jive::output * output;
+		size_t index;
+	};
+
+public:
+	~change_log();
+
+	change_log() noexcept;
+
+	change_log(const change_log&) = delete;
+
+	change_log&
+	operator=(const change_log&) = delete;
+
+	/**
+		\brief Returns true if changes are currently recorded
+	*/
+	inline bool
+	recording() const noexcept
+	{
+		return !checkpoints_.empty() && !suspended_;
+	}
+
+	/**
+		\brief Returns true if the destruction of \p node was already notified
+
+		Removed nodes are notified as destroyed when they are removed. Their destructors must not
+		notify them again when they are destroyed on commit.
+	*/
+	inline bool
+	destruction_notified(const jive::node * node) const noexcept
+	{
+		return node == destroying_;
+	}
+
+	inline size_t
+	ncheckpoints() const noexcept
+	{
+		return checkpoints_.size();
+	}
+
+	inline size_t
+	nchanges() const noexcept
+	{
+		return changes_.size();
+	}
+
+	void
+	checkpoint();
+
+	void
+	commit();
+
+	void
+	rollback();
+
+	/* recording, only invoked if recording() returns true */
+
+	void
+	node_created(jive::node * node);
+
+	void
+	remove_node(jive::node * node);
+
+	void
+	input_diverted(jive::input * input, jive::output * old_origin);
+
+	void
+	input_added(jive::node_input * input);
+
+	void
+	remove_input(std::unique_ptr<jive::node_input> input, jive::node * node, size_t index);
+
+	void
+	output_added(jive::node_output * output);
+
+	void
+	remove_output(std::unique_ptr<jive::node_output> output, jive::node * node, size_t index);
+
+	void
+	argument_added(jive::argument * argument);
+
+	void
+	remove_argument(jive::argument * argument, size_t index);
+
+	void
+	result_added(jive::result * result);
+
+	void
+	remove_result(jive::result * result, size_t index);
+
+private:
+	void
+	undo(const change & change, std::unordered_set<const jive::node*> & deleted);
+
+	void
+	destroy_removed();
+
+	static void
+	unlink(jive::node * node);
+
+	static void
+	link(jive::node * node);
+
+	static void
+	link(jive::argument * argument);
+
+	bool suspended_;
+	const jive::node * destroying_;
+	std::vector<size_t> checkpoints_;
+	std::vector<change> changes_;
+};
+
+}
+
+#endif
@@ -71,6 +71,12 @@ public:
 		return !(*this == other);
 	}
 
+	inline size_t
+	hash() const noexcept
+	{
+		return (nalternatives_ << 16) ^ alternative_;
+	}
+
 	inline size_t
 	alternative() const noexcept
 	{
@@ -138,6 +144,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const override;
+
 	virtual jive_unop_reduction_path_t
 	can_reduce_operand(const jive::output * arg) const noexcept override;
 
@@ -10,13 +10,19 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include <deque>
 #include <typeindex>
+#include <unordered_set>
 
 #include <jive/common.hpp>
+#include <jive/rvsdg/change-log.hpp>
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/node.hpp>
+#include <jive/rvsdg/operation-interner.hpp>
 #include <jive/rvsdg/region.hpp>
+#include <jive/rvsdg/rewrite-profile.hpp>
 #include <jive/rvsdg/tracker.hpp>
+#include <jive/util/id-allocator.hpp>
 
 namespace jive {
 
@@ -126,22 +132,85 @@ public:
 		return root_;
 	}
 
+	/**
+		\brief Serial number of the graph
+
+		Every graph obtains a distinct serial number on construction. Unlike the address of a graph,
+		it is not reused by a graph that is created after this one is destroyed.
+	*/
+	inline size_t
+	serial() const noexcept
+	{
+		return serial_;
+	}
+
+	/**
+		\brief Requests a normalization of all nodes
+
+		Invoked when the configuration of a normal form changes, e.g., a reduction is enabled. The next
+		\ref normalize() visits all nodes of the graph instead of only the dirty ones.
+	*/
 	inline void
 	mark_denormalized() noexcept
 	{
 		normalized_ = false;
+		worklist_.clear();
+		dirty_nodes_.clear();
 	}
 
-	inline void
-	normalize()
+	/**
+		\brief Normalizes the graph
+
+		After the graph was normalized, nodes that are created or whose operands change are recorded as
+		dirty, as are the producers and the remaining users of operands that lose a user. If no normal form changed since the
+		last normalization, only the dirty nodes are normalized.
+		The users of a node that is reduced become dirty again, such that the worklist is processed
+		until a fixpoint is reached. Otherwise, all regions are normalized with \ref region::normalize().
+	*/
+	void
+	normalize();
+
+	inline size_t
+	ndirty_nodes() const noexcept
 	{
-		root()->normalize(true);
-		normalized_ = true;
+		return dirty_nodes_.size();
 	}
 
 	std::unique_ptr<jive::graph>
 	copy() const;
 
+	/**
+		\brief Starts recording the changes to the graph
+
+		The graph can be transformed speculatively after a checkpoint. A subsequent \ref rollback()
+		restores the graph as it was at the checkpoint in time proportional to the number of changes,
+		while \ref commit() keeps the changes. Checkpoints can be nested. See \ref change_log for the
+		recorded changes.
+	*/
+	inline void
+	checkpoint()
+	{
+		changes_.checkpoint();
+	}
+
+	inline void
+	commit()
+	{
+		changes_.commit();
+	}
+
+	inline void
+	rollback()
+	{
+		changes_.rollback();
+	}
+
+	inline jive::change_log &
+	changes() noexcept
+	{
+		return changes_;
+	}
+
 	jive::node_normal_form *
 	node_normal_form(const std::type_info & type) noexcept;
 
@@ -163,10 +232,86 @@ public:
 		root()->prune(true);
 	}
 
+	/**
+		\brief Identifiers of the nodes in the graph
+
+		Nodes, outputs, and regions obtain a compact identifier from the graph on construction and
+		return it on destruction. The identifiers index side tables, see \ref side_table.
+	*/
+	inline id_allocator &
+	node_ids() noexcept
+	{
+		return node_ids_;
+	}
+
+	inline id_allocator &
+	output_ids() noexcept
+	{
+		return output_ids_;
+	}
+
+	inline id_allocator &
+	region_ids() noexcept
+	{
+		return region_ids_;
+	}
+
+	/**
+		\brief The operations of the nodes in the graph
+	*/
+	inline operation_interner &
+	operations() noexcept
+	{
+		return operations_;
+	}
+
+	/**
+		\brief The rewrites of the normal forms of the graph
+	*/
+	inline rewrite_profile &
+	rewrites() noexcept
+	{
+		return rewrites_;
+	}
+
+	/**
+		\brief Notifications of changes to the graph
+
+		Nodes and inputs invoke these directly on their own graph, in addition to the global
+		notifiers. They record the changes in the change log and, once the graph was normalized,
+		mark the affected nodes as dirty.
+	*/
+	void
+	node_create(jive::node * node);
+
+	void
+	node_destroy(jive::node * node);
+
+	void
+	input_change(jive::input * input, jive::output * old_origin, jive::output * new_origin);
+
 private:
+	void
+	mark_dirty(jive::node * node);
+
+	void
+	mark_user_removed(jive::output * output, const jive::node * removed);
+
+	/* must be constructed before and destructed after the root region */
+	id_allocator node_ids_;
+	id_allocator output_ids_;
+	id_allocator region_ids_;
+	operation_interner operations_;
+	jive::change_log changes_;
+	rewrite_profile rewrites_;
+
+	size_t serial_;
 	bool normalized_;
 	jive::region * root_;
 	jive::node_normal_form_hash node_normal_forms_;
+
+	std::deque<jive::node*> worklist_;
+	std::unordered_set<jive::node*> dirty_nodes_;
 };
 
 }
@@ -23,6 +23,7 @@ namespace base {
 	class type;
 }
 
+class change_log;
 class graph;
 class node_normal_form;
 class output;
@@ -31,6 +32,7 @@ class substitution_map;
 /* inputs */
 
 class input {
+	friend jive::change_log;
 	friend jive::node;
 	friend jive::region;
 
@@ -262,6 +264,7 @@ is(const jive::input & input) noexcept
 
 class output {
 	friend input;
+	friend jive::change_log;
 	friend jive::node;
 	friend jive::region;
 
@@ -290,6 +293,25 @@ public:
 		return index_;
 	}
 
+	/**
+		\brief Returns the identifier of the output
+
+		The identifier is unique among all outputs of the graph, and reused after the output is
+		destroyed. Together with \ref generation(), it distinguishes the output from all other
+		outputs that ever existed in the graph.
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
+	inline size_t
+	generation() const noexcept
+	{
+		return generation_;
+	}
+
 	inline size_t
 	nusers() const noexcept
 	{
@@ -500,6 +522,8 @@ private:
 	add_user(jive::input * user);
 
 	size_t index_;
+	size_t id_;
+	size_t generation_;
 	jive::region * region_;
 	std::unique_ptr<jive::port> port_;
 	std::unordered_set<jive::input*> users_;
@@ -561,12 +585,23 @@ private:
 /* node class */
 
 class node {
+	friend jive::change_log;
+
 public:
 	virtual
 	~node();
 
 	node(std::unique_ptr<jive::operation> op, jive::region * region);
 
+	node(const jive::operation & op, jive::region * region);
+
+	/**
+		\brief Returns the operation of the node
+
+		The operation is interned in the node's graph, see \ref operation_interner, or owned by the
+		node if it is not internable. The operations of two nodes of the same graph are equal if and
+		only if they are the same object.
+	*/
 	inline const jive::operation &
 	operation() const noexcept
 	{
@@ -634,7 +669,7 @@ public:
 		return outputs_[index].get();
 	}
 
-	inline void
+	void
 	recompute_depth() noexcept;
 
 protected:
@@ -645,12 +680,7 @@ protected:
 	remove_input(size_t index);
 
 	node_output *
-	add_output(std::unique_ptr<node_output> output)
-	{
-		output->index_ = noutputs();
-		outputs_.push_back(std::move(output));
-		return this->output(noutputs()-1);
-	}
+	add_output(std::unique_ptr<node_output> output);
 
 	void
 	remove_output(size_t index);
@@ -696,6 +726,31 @@ public:
 		return depth_;
 	}
 
+	/**
+		\brief Returns the identifier of the node
+
+		See \ref output::id().
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
+	inline size_t
+	generation() const noexcept
+	{
+		return generation_;
+	}
+
+	/**
+		\brief Returns the normal form of the node's operation
+
+		The normal form is looked up in the graph on the first invocation and cached afterwards.
+	*/
+	jive::node_normal_form *
+	normal_form() const noexcept;
+
 private:
 	jive::detail::intrusive_list_anchor<
 		jive::node
@@ -727,9 +782,13 @@ public:
 
 private:
 	size_t depth_;
+	size_t id_;
+	size_t generation_;
 	jive::graph * graph_;
 	jive::region * region_;
-	std::unique_ptr<jive::operation> operation_;
+	const jive::operation * operation_;
+	std::unique_ptr<jive::operation> owned_operation_;
+	mutable jive::node_normal_form * normal_form_;
 	std::vector<std::unique_ptr<node_input>> inputs_;
 	std::vector<std::unique_ptr<node_output>> outputs_;
 };
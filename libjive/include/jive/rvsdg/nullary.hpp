@@ -12,6 +12,8 @@
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/simple-node.hpp>
 
+#include <typeinfo>
+
 namespace jive {
 
 class output;
@@ -82,6 +84,12 @@ public:
 		return op && op->value_ == value_;
 	}
 
+	virtual size_t
+	hash() const override
+	{
+		return typeid(*this).hash_code() ^ value_.hash();
+	}
+
 	virtual std::string
 	debug_string() const override
 	{
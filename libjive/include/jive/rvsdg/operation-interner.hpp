@@ -0,0 +1,93 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_RVSDG_OPERATION_INTERNER_HPP
+#define JIVE_RVSDG_OPERATION_INTERNER_HPP
+
+#include <jive/rvsdg/operation.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace jive {
+
+/**
+	\brief Keeps a single immutable instance of every distinct operation
+
+	The nodes of a graph reference the operations interned in the graph instead of owning a copy.
+	Two operations interned in the same interner are equal if and only if they are the same object,
+	such that node operations of the same graph can be compared by pointer. Operations are
+	considered equal if they have the same dynamic type, compare equal with
+	\ref operation::operator==, and, for simple operations, have the same argument and result
+	ports. Interned operations are reference counted: every \ref intern() acquires a reference that
+	is given up with \ref release(), and an operation is destroyed once its last reference is
+	released. Nodes hold a reference to their operation for their lifetime, such that the
+	interner only retains the operations of the nodes in the graph. Operations that are not
+	\ref operation::internable cannot be interned.
+*/
+class operation_interner final {
+public:
+	operation_interner() = default;
+
+	operation_interner(const operation_interner&) = delete;
+
+	operation_interner&
+	operator=(const operation_interner&) = delete;
+
+	/**
+		\brief Returns the interned operation equal to \p op
+
+		\p op is copied if no equal operation was interned before. \p op must be internable. The
+		caller acquires a reference to the returned operation.
+	*/
+	const jive::operation &
+	intern(const jive::operation & op);
+
+	/**
+		\brief Returns the interned operation equal to \p op
+
+		\p op is taken over if no equal operation was interned before. \p op must be internable.
+		The caller acquires a reference to the returned operation.
+	*/
+	const jive::operation &
+	intern(std::unique_ptr<jive::operation> op);
+
+	/**
+		\brief Releases a reference to the interned operation \p op
+
+		\p op is destroyed if this was its last reference.
+	*/
+	void
+	release(const jive::operation & op);
+
+	/**
+		\brief Returns the interned operation equal to \p op, or nullptr if there is none
+
+		No reference is acquired.
+	*/
+	const jive::operation *
+	find(const jive::operation & op) const;
+
+	inline size_t
+	size() const noexcept
+	{
+		return operations_.size();
+	}
+
+private:
+	struct entry {
+		std::unique_ptr<jive::operation> operation;
+		mutable size_t nreferences;
+	};
+
+	const entry *
+	lookup(const jive::operation & op, size_t hash) const noexcept;
+
+	std::unordered_multimap<size_t, entry> operations_;
+};
+
+}
+
+#endif
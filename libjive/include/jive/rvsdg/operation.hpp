@@ -103,6 +103,28 @@ public:
 	virtual std::unique_ptr<jive::operation>
 	copy() const = 0;
 
+	/**
+		\brief Returns a hash of the operation
+
+		Equal operations must have equal hashes. The default hash is derived from the dynamic type
+		and the debug string of the operation. Operations whose debug string omits attributes compared
+		in \ref operator== must override it, and frequently created operations should override it
+		with a hash that does not format a string.
+	*/
+	virtual size_t
+	hash() const;
+
+	/**
+		\brief Returns true if the operation can be interned, see \ref operation_interner
+
+		Operations that are only equal to themselves, e.g., to exclude them from common node
+		elimination, must return false. They would never be shared, but every interned instance would
+		be kept alive until the graph is destroyed. The nodes of such operations own their operation
+		instead.
+	*/
+	virtual bool
+	internable() const noexcept;
+
 	inline bool
 	operator!=(const operation & other) const noexcept
 	{
@@ -121,6 +121,8 @@ private:
 };
 
 class region {
+	friend jive::change_log;
+
 	typedef jive::detail::intrusive_list<
 		jive::node,
 		jive::node::region_node_list_accessor
@@ -187,6 +189,23 @@ public:
 		return index_;
 	}
 
+	/**
+		\brief Returns the identifier of the region
+
+		See \ref output::id().
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
+	inline size_t
+	generation() const noexcept
+	{
+		return generation_;
+	}
+
 	/* \brief Append \p argument to the region
 	*
 	* Multiple invocations of append_argument for the same argument are undefined.
@@ -275,6 +294,8 @@ public:
 
 private:
 	size_t index_;
+	size_t id_;
+	size_t generation_;
 	jive::graph * graph_;
 	jive::structural_node * node_;
 	std::vector<jive::result*> results_;
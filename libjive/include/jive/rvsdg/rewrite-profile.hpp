@@ -0,0 +1,170 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_RVSDG_REWRITE_PROFILE_HPP
+#define JIVE_RVSDG_REWRITE_PROFILE_HPP
+
+#include <stddef.h>
+
+#include <chrono>
+#include <map>
+#include <string_view>
+#include <utility>
+
+namespace jive {
+
+class graph;
+
+/**
+	\brief Counts the rewrites of the normal forms of a graph
+
+	Every rewrite rule of a normal form is identified by the name of the normal form and the name
+	of the rule, e.g., "load" and "load_mux". An attempt of a rule is the check whether the rule is
+	applicable, and an application is an attempt that rewrote the graph. Rules that are disabled in
+	their normal form are not attempted. The profile optionally measures the time of the attempts,
+	including the time of the rewrites and of all rewrites that are nested in them.
+
+	The profile is disabled by default, in which case an attempt costs a single check of a flag.
+	See \ref rewrite_attempt for how normal forms record their rewrites.
+*/
+class rewrite_profile final {
+public:
+	struct rule {
+		size_t attempts = 0;
+		size_t applications = 0;
+		size_t ns = 0;
+	};
+
+	/* normal form name and rule name, both of which are string literals */
+	typedef std::pair<std::string_view, std::string_view> key;
+
+	inline
+	rewrite_profile() noexcept
+	: enabled_(false)
+	, timed_(false)
+	{}
+
+	rewrite_profile(const rewrite_profile&) = delete;
+
+	rewrite_profile&
+	operator=(const rewrite_profile&) = delete;
+
+	/**
+		\brief Starts counting rewrites, and measures their time if \p timed is true
+	*/
+	inline void
+	enable(bool timed) noexcept
+	{
+		enabled_ = true;
+		timed_ = timed;
+	}
+
+	inline void
+	disable() noexcept
+	{
+		enabled_ = false;
+		timed_ = false;
+	}
+
+	inline bool
+	enabled() const noexcept
+	{
+		return enabled_;
+	}
+
+	inline bool
+	timed() const noexcept
+	{
+		return timed_;
+	}
+
+	/**
+		\brief Returns the counters of the rule \p rule_name of the normal form \p normal_form
+	*/
+	inline rewrite_profile::rule &
+	lookup(std::string_view normal_form, std::string_view rule_name)
+	{
+		return rules_[{normal_form, rule_name}];
+	}
+
+	/**
+		\brief Returns the counters of all attempted rules ordered by normal form and rule name
+	*/
+	inline const std::map<key, rewrite_profile::rule> &
+	rules() const noexcept
+	{
+		return rules_;
+	}
+
+	inline void
+	clear() noexcept
+	{
+		rules_.clear();
+	}
+
+private:
+	bool enabled_;
+	bool timed_;
+	std::map<key, rewrite_profile::rule> rules_;
+};
+
+/**
+	\brief Records a single attempt of a rewrite rule in the profile of a graph
+
+	The attempt lasts from the construction to the destruction of the object. Normal forms create
+	it after the check whether the rule is enabled, and wrap the applicability check with
+	\ref applies():
+
+	\code
+	if (get_load_mux_reducible()) {
+		rewrite_attempt attempt(*graph(), "load", "load_mux");
+		if (attempt.applies(is_load_mux_reducible(operands)))
+			return perform_load_mux_reduction(*op, operands);
+	}
+	\endcode
+*/
+class rewrite_attempt final {
+public:
+	rewrite_attempt(
+		jive::graph & graph,
+		std::string_view normal_form,
+		std::string_view rule_name);
+
+	inline
+	~rewrite_attempt()
+	{
+		if (rule_ && timed_)
+			rule_->ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start_).count();
+	}
+
+	rewrite_attempt(const rewrite_attempt&) = delete;
+
+	rewrite_attempt&
+	operator=(const rewrite_attempt&) = delete;
+
+	/**
+		\brief Records an application of the rule if \p applicable is true
+
+		\return \p applicable
+	*/
+	inline bool
+	applies(bool applicable) noexcept
+	{
+		if (rule_ && applicable)
+			rule_->applications++;
+
+		return applicable;
+	}
+
+private:
+	rewrite_profile::rule * rule_;
+	bool timed_;
+	std::chrono::steady_clock::time_point start_;
+};
+
+}
+
+#endif
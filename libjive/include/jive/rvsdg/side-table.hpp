@@ -0,0 +1,195 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_RVSDG_SIDE_TABLE_HPP
+#define JIVE_RVSDG_SIDE_TABLE_HPP
+
+#include <jive/common.hpp>
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/node.hpp>
+#include <jive/rvsdg/region.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace jive {
+
+namespace detail {
+
+static inline size_t
+side_table_graph(const jive::node & node) noexcept
+{
+	return node.graph()->serial();
+}
+
+static inline size_t
+side_table_graph(const jive::output & output) noexcept
+{
+	return output.region()->graph()->serial();
+}
+
+static inline size_t
+side_table_graph(const jive::region & region) noexcept
+{
+	return region.graph()->serial();
+}
+
+}
+
+/**
+	\brief Maps nodes, outputs, or regions of a graph to values
+
+	The table is indexed with the identifiers that the graph hands out to its nodes, outputs, and
+	regions. It is stored in pages of fixed size that are allocated on first use, such that a table
+	with few entries does not allocate space for all identifiers of a large graph. Every entry
+	records the generation of its key, which invalidates entries of destroyed keys whose identifier
+	was reused.
+
+	A table is bound to the graph of the first inserted key by the graph's serial number. Lookups of
+	keys from other graphs, including a graph that is allocated at the address of a destroyed one, do
+	not find an entry, and insertions of such keys throw.
+*/
+template <typename Key, typename T>
+class side_table final {
+	static constexpr size_t page_size = 256;
+
+	struct entry {
+		size_t generation = 0;
+		T value = T();
+	};
+
+	typedef std::array<entry, page_size> page;
+
+public:
+	side_table()
+	: graph_serial_(0)
+	{}
+
+	side_table(const side_table & other)
+	: graph_serial_(other.graph_serial_)
+	{
+		pages_.resize(other.pages_.size());
+		for (size_t n = 0; n < other.pages_.size(); n++) {
+			if (other.pages_[n])
+				pages_[n] = std::make_unique<page>(*other.pages_[n]);
+		}
+	}
+
+	side_table(side_table &&) = default;
+
+	side_table &
+	operator=(const side_table & other)
+	{
+		if (this != &other)
+			*this = side_table(other);
+
+		return *this;
+	}
+
+	side_table &
+	operator=(side_table &&) = default;
+
+	inline bool
+	contains(const Key & key) const noexcept
+	{
+		return find(key) != nullptr;
+	}
+
+	/**
+		\return The value of \p key, or nullptr if the table contains no entry for \p key.
+	*/
+	inline T *
+	lookup(const Key & key) noexcept
+	{
+		auto e = find(key);
+		return e ? &e->value : nullptr;
+	}
+
+	inline const T *
+	lookup(const Key & key) const noexcept
+	{
+		auto e = find(key);
+		return e ? &e->value : nullptr;
+	}
+
+	/**
+		\return The value of \p key. A default constructed value is inserted if the table contains
+		no entry for \p key.
+	*/
+	T &
+	operator[](const Key & key)
+	{
+		if (graph_serial_ == 0)
+			graph_serial_ = detail::side_table_graph(key);
+		if (graph_serial_ != detail::side_table_graph(key))
+			throw compiler_error("Side table key belongs to a different graph.");
+
+		auto id = key.id();
+		auto p = id / page_size;
+		if (p >= pages_.size())
+			pages_.resize(p+1);
+		if (!pages_[p])
+			pages_[p] = std::make_unique<page>();
+
+		auto & e = (*pages_[p])[id % page_size];
+		if (e.generation != key.generation()) {
+			e.generation = key.generation();
+			e.value = T();
+		}
+
+		return e.value;
+	}
+
+	inline void
+	insert(const Key & key, T value)
+	{
+		(*this)[key] = std::move(value);
+	}
+
+	bool
+	erase(const Key & key)
+	{
+		auto e = find(key);
+		if (e == nullptr)
+			return false;
+
+		e->generation = 0;
+		e->value = T();
+		return true;
+	}
+
+	void
+	clear() noexcept
+	{
+		pages_.clear();
+		graph_serial_ = 0;
+	}
+
+private:
+	inline entry *
+	find(const Key & key) const noexcept
+	{
+		auto id = key.id();
+		auto p = id / page_size;
+		if (p >= pages_.size() || !pages_[p] || graph_serial_ != detail::side_table_graph(key))
+			return nullptr;
+
+		auto & e = (*pages_[p])[id % page_size];
+		return e.generation == key.generation() ? &e : nullptr;
+	}
+
+	/* serial number of the graph, or zero if the table is unbound */
+	size_t graph_serial_;
+	std::vector<std::unique_ptr<page>> pages_;
+};
+
+template <typename T> using NodeMap = side_table<jive::node, T>;
+template <typename T> using OutputMap = side_table<jive::output, T>;
+template <typename T> using RegionMap = side_table<jive::region, T>;
+
+}
+
+#endif
@@ -8,27 +8,30 @@
 #define JIVE_RVSDG_SUBSTITUTION_HPP
 
 #include <jive/common.hpp>
+#include <jive/rvsdg/side-table.hpp>
 
 #include <unordered_map>
 
 namespace jive {
 
-class output;
-class region;
 class structural_input;
 
+/**
+	Outputs and regions are mapped with side tables indexed by their identifiers in the graph.
+	All originals of a map must therefore belong to the same graph.
+*/
 class substitution_map final {
 public:
 	bool
 	contains(const output & original) const noexcept
 	{
-		return output_map_.find(&original) != output_map_.end();
+		return output_map_.contains(original);
 	}
 
 	bool
 	contains(const region & original) const noexcept
 	{
-		return region_map_.find(&original) != region_map_.end();
+		return region_map_.contains(original);
 	}
 
 	bool
@@ -43,7 +46,7 @@ public:
 		if (!contains(original))
 			throw compiler_error("Output not in substitution map.");
 
-		return *output_map_.find(&original)->second;
+		return **output_map_.lookup(original);
 	}
 
 	region &
@@ -52,7 +55,7 @@ public:
 		if (!contains(original))
 			throw compiler_error("Region not in substitution map.");
 
-		return *region_map_.find(&original)->second;
+		return **region_map_.lookup(original);
 	}
 
 	structural_input &
@@ -67,15 +70,21 @@ public:
 	inline jive::output *
 	lookup(const jive::output * original) const noexcept
 	{
-		auto i = output_map_.find(original);
-		return i != output_map_.end() ? i->second : nullptr;
+		if (original == nullptr)
+			return nullptr;
+
+		auto substitute = output_map_.lookup(*original);
+		return substitute ? *substitute : nullptr;
 	}
 
 	inline jive::region *
 	lookup(const jive::region * original) const noexcept
 	{
-		auto i = region_map_.find(original);
-		return i != region_map_.end() ? i->second : nullptr;
+		if (original == nullptr)
+			return nullptr;
+
+		auto substitute = region_map_.lookup(*original);
+		return substitute ? *substitute : nullptr;
 	}
 
 	inline jive::structural_input *
@@ -88,13 +97,13 @@ public:
 	inline void
 	insert(const jive::output * original, jive::output * substitute)
 	{
-		output_map_[original] = substitute;
+		output_map_.insert(*original, substitute);
 	}
 
 	inline void
 	insert(const jive::region * original, jive::region * substitute)
 	{
-		region_map_[original] = substitute;
+		region_map_.insert(*original, substitute);
 	}
 
 	inline void
@@ -104,8 +113,8 @@ public:
 	}
 
 private:
-	std::unordered_map<const jive::region*, jive::region*> region_map_;
-	std::unordered_map<const jive::output*, jive::output*> output_map_;
+	RegionMap<jive::region*> region_map_;
+	OutputMap<jive::output*> output_map_;
 	std::unordered_map<const jive::structural_input*, jive::structural_input*> structinput_map_;
 };
 
@@ -48,6 +48,9 @@ public:
 
 	virtual std::unique_ptr<bitunary_op>
 	create(size_t nbits) const = 0;
+
+	virtual size_t
+	hash() const override;
 };
 
 /* Represents a binary operation (possibly normalized n-ary if associative)
@@ -83,6 +86,9 @@ public:
 	virtual std::unique_ptr<bitbinary_op>
 	create(size_t nbits) const = 0;
 
+	virtual size_t
+	hash() const override;
+
 	inline const bittype &
 	type() const noexcept
 	{
@@ -125,6 +131,9 @@ public:
 	virtual std::unique_ptr<bitcompare_op>
 	create(size_t nbits) const = 0;
 
+	virtual size_t
+	hash() const override;
+
 	inline const bittype &
 	type() const noexcept
 	{
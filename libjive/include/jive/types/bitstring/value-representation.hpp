@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace jive {
@@ -248,6 +249,12 @@ public:
 		return !(*this == other);
 	}
 
+	inline size_t
+	hash() const noexcept
+	{
+		return std::hash<std::string_view>()(std::string_view(data_.data(), data_.size()));
+	}
+
 	inline bool
 	operator==(int64_t value) const
 	{
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_ID_ALLOCATOR_HPP
+#define JIVE_UTIL_ID_ALLOCATOR_HPP
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+namespace jive {
+
+/**
+	\brief Hands out compact integer identifiers
+
+	Identifiers of released objects are reused. Every release increments the generation of an
+	identifier, such that side tables can distinguish an object from a previous object with the
+	same identifier. Generations start at one, such that zero can mark empty side table entries.
+*/
+class id_allocator final {
+public:
+	/**
+		\brief Allocates an identifier
+
+		\return The identifier and its generation.
+	*/
+	inline std::pair<size_t, size_t>
+	allocate()
+	{
+		if (!free_.empty()) {
+			auto id = free_.back();
+			free_.pop_back();
+			return {id, generations_[id]};
+		}
+
+		generations_.push_back(1);
+		/* ensure that release() never needs to allocate */
+		free_.reserve(generations_.capacity());
+		return {generations_.size()-1, 1};
+	}
+
+	inline void
+	release(size_t id) noexcept
+	{
+		generations_[id]++;
+		free_.push_back(id);
+	}
+
+	/**
+		\brief Returns an upper bound of all allocated identifiers
+	*/
+	inline size_t
+	capacity() const noexcept
+	{
+		return generations_.size();
+	}
+
+	inline size_t
+	nallocated() const noexcept
+	{
+		return generations_.size() - free_.size();
+	}
+
+private:
+	std::vector<size_t> generations_;
+	std::vector<size_t> free_;
+};
+
+}
+
+#endif
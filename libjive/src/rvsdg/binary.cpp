@@ -94,6 +94,7 @@ binary_normal_form::normalize_node(jive::node * node, const binary_op & op) cons
 
 	/* possibly expand associative */
 	if (get_flatten() && op.is_associative()) {
+		rewrite_attempt attempt(*graph(), "binary", "flatten");
 		new_args = base::detail::associative_flatten(
 			args,
 			[&op](jive::output * arg) {
@@ -104,13 +105,17 @@ binary_normal_form::normalize_node(jive::node * node, const binary_op & op) cons
 				auto fb_op = dynamic_cast<const flattened_binary_op*>(&node->operation());
 				return node->operation() == op || (fb_op && fb_op->bin_operation() == op);
 			});
+		attempt.applies(new_args != args);
 	} else {
 		new_args = args;
 	}
 
 	if (get_reducible()) {
+		rewrite_attempt attempt(*graph(), "binary", "reduce");
+		auto nargs = new_args.size();
 		auto tmp = reduce_operands(op, std::move(new_args));
 		new_args = {tmp.begin(), tmp.end()};
+		attempt.applies(new_args.size() != nargs);
 
 		if (new_args.size() == 1) {
 			node->output(0)->divert_users(new_args[0]);
@@ -152,6 +157,7 @@ binary_normal_form::normalized_create(
 
 	/* possibly expand associative */
 	if (get_mutable() && get_flatten() && op.is_associative()) {
+		rewrite_attempt attempt(*graph(), "binary", "flatten");
 		new_args = base::detail::associative_flatten(
 			args,
 			[&op](jive::output* arg) {
@@ -162,10 +168,14 @@ binary_normal_form::normalized_create(
 				auto fb_op = dynamic_cast<const flattened_binary_op*>(&node->operation());
 				return node->operation() == op || (fb_op && fb_op->bin_operation() == op);
 			});
+		attempt.applies(new_args != args);
 	}
 
 	if (get_mutable() && get_reducible()) {
+		rewrite_attempt attempt(*graph(), "binary", "reduce");
+		auto nargs = new_args.size();
 		new_args = reduce_operands(op, std::move(new_args));
+		attempt.applies(new_args.size() != nargs);
 		if (new_args.size() == 1)
 			return new_args;
 	}
@@ -0,0 +1,359 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/common.hpp>
+#include <jive/rvsdg/change-log.hpp>
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/notifiers.hpp>
+#include <jive/rvsdg/region.hpp>
+#include <jive/rvsdg/structural-node.hpp>
+
+namespace jive {
+
+/* inserts \p element into \p list, which is ordered by the index of the elements' regions */
+template <class L, class T> static void
+insert_ordered(L & list, T * element)
+{
+	auto it = list.begin();
+	while (it != list.end() && it->region()->index() < element->region()->index())
+		it++;
+
+	list.insert(it, element);
+}
+
+change_log::~change_log()
+{
+	JIVE_DEBUG_ASSERT(checkpoints_.empty());
+}
+
+change_log::change_log() noexcept
+: suspended_(false)
+, destroying_(nullptr)
+{}
+
+void
+change_log::checkpoint()
+{
+	checkpoints_.push_back(changes_.size());
+}
+
+void
+change_log::commit()
+{
+	if (checkpoints_.empty())
+		throw compiler_error("No checkpoint to commit.");
+
+	checkpoints_.pop_back();
+	if (checkpoints_.empty())
+		destroy_removed();
+}
+
+void
+change_log::rollback()
+{
+	if (checkpoints_.empty())
+		throw compiler_error("No checkpoint to roll back to.");
+
+	auto begin = checkpoints_.back();
+
+	suspended_ = true;
+	std::unordered_set<const jive::node*> deleted;
+	while (changes_.size() > begin) {
+		undo(changes_.back(), deleted);
+		changes_.pop_back();
+	}
+	suspended_ = false;
+
+	checkpoints_.pop_back();
+}
+
+void
+change_log::undo(const change & change, std::unordered_set<const jive::node*> & deleted)
+{
+	switch (change.kind) {
+	case change_kind::node_create:
+	{
+		deleted.insert(change.node);
+		delete change.node;
+		break;
+	}
+	case change_kind::node_remove:
+	{
+		link(change.node);
+		change.node->graph()->node_create(change.node);
+		on_node_create(change.node);
+		break;
+	}
+	case change_kind::input_divert:
+	{
+		change.input->divert_to(change.output);
+		break;
+	}
+	case change_kind::input_add:
+	{
+		/* inputs of a simple node are added before its creation is recorded */
+		if (deleted.find(change.node) == deleted.end())
+			change.node->remove_input(change.input->index());
+		break;
+	}
+	case change_kind::input_remove:
+	{
+		auto node = change.node;
+		auto input = static_cast<node_input*>(change.input);
+		if (node->ninputs() == 0)
+			node->region()->top_nodes.erase(node);
+
+		node->inputs_.insert(node->inputs_.begin() + change.index, std::unique_ptr<node_input>(input));
+		for (size_t n = change.index; n < node->ninputs(); n++)
+			node->inputs_[n]->index_ = n;
+
+		input->origin()->add_user(input);
+		node->recompute_depth();
+		break;
+	}
+	case change_kind::output_add:
+	{
+		if (deleted.find(change.node) == deleted.end())
+			change.node->remove_output(change.output->index());
+		break;
+	}
+	case change_kind::output_remove:
+	{
+		auto node = change.node;
+		auto output = static_cast<node_output*>(change.output);
+		node->outputs_.insert(node->outputs_.begin() + change.index,
+			std::unique_ptr<node_output>(output));
+		for (size_t n = change.index; n < node->noutputs(); n++)
+			node->outputs_[n]->index_ = n;
+		break;
+	}
+	case change_kind::argument_add:
+	{
+		if (deleted.find(change.node) == deleted.end())
+			change.region->remove_argument(change.output->index());
+		break;
+	}
+	case change_kind::argument_remove:
+	{
+		auto region = change.region;
+		auto argument = static_cast<jive::argument*>(change.output);
+		region->arguments_.insert(region->arguments_.begin() + change.index, argument);
+		for (size_t n = change.index; n < region->narguments(); n++)
+			region->arguments_[n]->index_ = n;
+
+		link(argument);
+		break;
+	}
+	case change_kind::result_add:
+	{
+		if (deleted.find(change.node) == deleted.end())
+			change.region->remove_result(change.input->index());
+		break;
+	}
+	case change_kind::result_remove:
+	{
+		auto region = change.region;
+		auto result = static_cast<jive::result*>(change.input);
+		region->results_.insert(region->results_.begin() + change.index, result);
+		for (size_t n = change.index; n < region->nresults(); n++)
+			region->results_[n]->index_ = n;
+
+		result->origin()->add_user(result);
+		if (result->output())
+			insert_ordered(result->output()->results, result);
+		break;
+	}
+	}
+}
+
+void
+change_log::destroy_removed()
+{
+	/*
+		The destructors of nodes, inputs, arguments, and results expect the objects to be linked with
+		their origins and owners. The removed objects are therefore linked in again in reverse order of
+		their removal, which restores the links that existed at the time of each removal, and then
+		destroyed in order of their removal.
+	*/
+	suspended_ = true;
+
+	for (auto it = changes_.rbegin(); it != changes_.rend(); it++) {
+		switch (it->kind) {
+		case change_kind::node_remove:
+			link(it->node);
+			break;
+		case change_kind::input_remove:
+			it->input->origin()->add_user(it->input);
+			break;
+		case change_kind::argument_remove:
+			link(static_cast<jive::argument*>(it->output));
+			break;
+		case change_kind::result_remove:
+		{
+			auto result = static_cast<jive::result*>(it->input);
+			result->origin()->add_user(result);
+			if (result->output())
+				insert_ordered(result->output()->results, result);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	for (const auto & change : changes_) {
+		switch (change.kind) {
+		case change_kind::node_remove:
+			destroying_ = change.node;
+			delete change.node;
+			destroying_ = nullptr;
+			break;
+		case change_kind::input_remove:
+		case change_kind::result_remove:
+			delete change.input;
+			break;
+		case change_kind::output_remove:
+		case change_kind::argument_remove:
+			delete change.output;
+			break;
+		default:
+			break;
+		}
+	}
+
+	changes_.clear();
+	suspended_ = false;
+}
+
+void
+change_log::unlink(jive::node * node)
+{
+	JIVE_DEBUG_ASSERT(!node->has_users());
+
+	auto region = node->region();
+	region->bottom_nodes.erase(node);
+	if (node->ninputs() == 0)
+		region->top_nodes.erase(node);
+	region->nodes.erase(node);
+
+	for (size_t n = 0; n < node->ninputs(); n++) {
+		auto input = node->input(n);
+		input->origin()->remove_user(input);
+	}
+}
+
+void
+change_log::link(jive::node * node)
+{
+	JIVE_DEBUG_ASSERT(!node->has_users());
+
+	auto region = node->region();
+	region->nodes.push_back(node);
+	if (node->ninputs() == 0)
+		region->top_nodes.push_back(node);
+	region->bottom_nodes.push_back(node);
+
+	for (size_t n = 0; n < node->ninputs(); n++) {
+		auto input = node->input(n);
+		input->origin()->add_user(input);
+	}
+}
+
+void
+change_log::link(jive::argument * argument)
+{
+	if (argument->input())
+		insert_ordered(argument->input()->arguments, argument);
+}
+
+void
+change_log::node_created(jive::node * node)
+{
+	changes_.push_back({change_kind::node_create, node, nullptr, nullptr, nullptr, 0});
+}
+
+void
+change_log::remove_node(jive::node * node)
+{
+	node->graph()->node_destroy(node);
+	on_node_destroy(node);
+	unlink(node);
+
+	changes_.push_back({change_kind::node_remove, node, nullptr, nullptr, nullptr, 0});
+}
+
+void
+change_log::input_diverted(jive::input * input, jive::output * old_origin)
+{
+	changes_.push_back({change_kind::input_divert, nullptr, nullptr, input, old_origin, 0});
+}
+
+void
+change_log::input_added(jive::node_input * input)
+{
+	changes_.push_back({change_kind::input_add, input->node(), nullptr, input, nullptr, 0});
+}
+
+void
+change_log::remove_input(std::unique_ptr<jive::node_input> input, jive::node * node, size_t index)
+{
+	input->origin()->remove_user(input.get());
+
+	changes_.push_back({change_kind::input_remove, node, nullptr, input.release(), nullptr, index});
+}
+
+void
+change_log::output_added(jive::node_output * output)
+{
+	changes_.push_back({change_kind::output_add, output->node(), nullptr, nullptr, output, 0});
+}
+
+void
+change_log::remove_output(std::unique_ptr<jive::node_output> output, jive::node * node, size_t index)
+{
+	JIVE_DEBUG_ASSERT(output->nusers() == 0);
+
+	changes_.push_back({change_kind::output_remove, node, nullptr, nullptr, output.release(), index});
+}
+
+void
+change_log::argument_added(jive::argument * argument)
+{
+	auto region = argument->region();
+	changes_.push_back({change_kind::argument_add, region->node(), region, nullptr, argument, 0});
+}
+
+void
+change_log::remove_argument(jive::argument * argument, size_t index)
+{
+	JIVE_DEBUG_ASSERT(argument->nusers() == 0);
+
+	if (argument->input())
+		argument->input()->arguments.erase(argument);
+
+	auto region = argument->region();
+	changes_.push_back({change_kind::argument_remove, region->node(), region, nullptr, argument,
+		index});
+}
+
+void
+change_log::result_added(jive::result * result)
+{
+	auto region = result->region();
+	changes_.push_back({change_kind::result_add, region->node(), region, result, nullptr, 0});
+}
+
+void
+change_log::remove_result(jive::result * result, size_t index)
+{
+	result->origin()->remove_user(result);
+	if (result->output())
+		result->output()->results.erase(result);
+
+	auto region = result->region();
+	changes_.push_back({change_kind::result_remove, region->node(), region, result, nullptr, index});
+}
+
+}
@@ -91,6 +91,13 @@ match_op::operator==(const operation & other) const noexcept
 	    && op->nalternatives() == nalternatives();
 }
 
+size_t
+match_op::hash() const
+{
+	/* the mapping is not hashed, as its iteration order is unspecified */
+	return typeid(*this).hash_code() ^ (nbits() << 16) ^ (nalternatives() << 8) ^ default_alternative_;
+}
+
 jive_unop_reduction_path_t
 match_op::can_reduce_operand(const jive::output * arg) const noexcept
 {
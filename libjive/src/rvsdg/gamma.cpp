@@ -176,19 +176,29 @@ gamma_normal_form::normalize_node(jive::node * node_) const
 	if (!get_mutable())
 		return true;
 
-	if (get_predicate_reduction() && is_predicate_reducible(node)) {
-		perform_predicate_reduction(node);
-		return false;
+	if (get_predicate_reduction()) {
+		rewrite_attempt attempt(*graph(), "gamma", "predicate");
+		if (attempt.applies(is_predicate_reducible(node))) {
+			perform_predicate_reduction(node);
+			return false;
+		}
 	}
 
 	bool was_normalized = true;
-	if (get_invariant_reduction())
-		was_normalized |= perform_invariant_reduction(node);
+	if (get_invariant_reduction()) {
+		rewrite_attempt attempt(*graph(), "gamma", "invariant");
+		auto invariant_normalized = perform_invariant_reduction(node);
+		attempt.applies(!invariant_normalized);
+		was_normalized |= invariant_normalized;
+	}
 
-	auto outputs = is_control_constant_reducible(node);
-	if (get_control_constant_reduction() && !outputs.empty()) {
-		perform_control_constant_reduction(outputs);
-		was_normalized = false;
+	if (get_control_constant_reduction()) {
+		rewrite_attempt attempt(*graph(), "gamma", "control_constant");
+		auto outputs = is_control_constant_reducible(node);
+		if (attempt.applies(!outputs.empty())) {
+			perform_control_constant_reduction(outputs);
+			was_normalized = false;
+		}
 	}
 
 	return was_normalized;
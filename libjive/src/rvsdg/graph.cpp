@@ -4,12 +4,15 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <atomic>
+
 #include <cxxabi.h>
 
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/region.hpp>
+#include <jive/rvsdg/structural-node.hpp>
 #include <jive/rvsdg/substitution.hpp>
 #include <jive/rvsdg/tracker.hpp>
 #include <jive/types/record.hpp>
@@ -62,14 +65,118 @@ graph::~graph()
 {
 	JIVE_DEBUG_ASSERT(!has_active_trackers(this));
 
+	while (changes_.ncheckpoints() != 0)
+		changes_.commit();
+
+	/* do not record the nodes that become dirty while the graph is torn down */
+	normalized_ = false;
 	delete root_;
 }
 
+static std::atomic<size_t> graph_serials(0);
+
 graph::graph()
-	: normalized_(false)
+	: serial_(++graph_serials)
+	, normalized_(false)
 	, root_(new jive::region(nullptr, this))
 {}
 
+void
+graph::normalize()
+{
+	if (!normalized_) {
+		root()->normalize(true);
+		worklist_.clear();
+		dirty_nodes_.clear();
+		normalized_ = true;
+		return;
+	}
+
+	while (!worklist_.empty()) {
+		auto node = worklist_.front();
+		worklist_.pop_front();
+
+		/* skip nodes that were destroyed or already normalized */
+		if (dirty_nodes_.erase(node) == 0)
+			continue;
+
+		node->normal_form()->normalize_node(node);
+	}
+}
+
+void
+graph::mark_dirty(jive::node * node)
+{
+	/* before the first normalization, all nodes are visited anyway */
+	if (!normalized_)
+		return;
+
+	if (dirty_nodes_.insert(node).second)
+		worklist_.push_back(node);
+}
+
+void
+graph::mark_user_removed(jive::output * output, const jive::node * removed)
+{
+	if (auto producer = node_output::node(output))
+		mark_dirty(producer);
+
+	/*
+		Reductions such as load-alloca, store-mux, or mux-mux depend on the number of users of an
+		operand. Any remaining user of the operand can therefore become reducible.
+	*/
+	for (const auto & user : *output) {
+		auto ni = dynamic_cast<node_input*>(user);
+		if (ni && ni->node() != removed)
+			mark_dirty(ni->node());
+	}
+}
+
+void
+graph::node_create(jive::node * node)
+{
+	JIVE_DEBUG_ASSERT(node->graph() == this);
+
+	mark_dirty(node);
+
+	if (changes_.recording())
+		changes_.node_created(node);
+}
+
+void
+graph::node_destroy(jive::node * node)
+{
+	JIVE_DEBUG_ASSERT(node->graph() == this);
+
+	if (!normalized_)
+		return;
+
+	for (size_t n = 0; n < node->ninputs(); n++)
+		mark_user_removed(node->input(n)->origin(), node);
+
+	dirty_nodes_.erase(node);
+}
+
+void
+graph::input_change(jive::input * input, jive::output * old_origin, jive::output * new_origin)
+{
+	JIVE_DEBUG_ASSERT(input->region()->graph() == this);
+
+	if (changes_.recording())
+		changes_.input_diverted(input, old_origin);
+
+	mark_user_removed(old_origin, nullptr);
+
+	if (auto ni = dynamic_cast<node_input*>(input)) {
+		mark_dirty(ni->node());
+		return;
+	}
+
+	/* a changed result can enable reductions of the structural node, e.g., gamma invariant reductions */
+	if (auto node = input->region()->node())
+		mark_dirty(node);
+}
+
 std::unique_ptr<jive::graph>
 graph::copy() const
 {
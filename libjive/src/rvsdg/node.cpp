@@ -5,9 +5,11 @@
  */
 
 #include <string.h>
+#include <tuple>
 
 #include <jive/common.hpp>
 
+#include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/notifiers.hpp>
 #include <jive/rvsdg/region.hpp>
@@ -68,7 +70,7 @@ input::divert_to(jive::output * new_origin)
 	if (is<node_input>(*this))
 		static_cast<node_input*>(this)->node()->recompute_depth();
 
-	region()->graph()->mark_denormalized();
+	region()->graph()->input_change(this, old_origin, new_origin);
 	on_input_change(this, old_origin, new_origin);
 }
 
@@ -77,6 +79,8 @@ input::divert_to(jive::output * new_origin)
 output::~output() noexcept
 {
 	JIVE_DEBUG_ASSERT(nusers() == 0);
+
+	region_->graph()->output_ids().release(id_);
 }
 
 output::output(
@@ -85,7 +89,9 @@ output::output(
 : index_(0)
 , region_(region)
 , port_(port.copy())
-{}
+{
+	std::tie(id_, generation_) = region->graph()->output_ids().allocate();
+}
 
 std::string
 output::debug_string() const
@@ -165,8 +171,39 @@ node::node(std::unique_ptr<jive::operation> op, jive::region * region)
 	: depth_(0)
 	, graph_(region->graph())
 	, region_(region)
-	, operation_(std::move(op))
+	, operation_(nullptr)
+	, normal_form_(nullptr)
 {
+	if (op->internable()) {
+		operation_ = &graph_->operations().intern(std::move(op));
+	} else {
+		owned_operation_ = std::move(op);
+		operation_ = owned_operation_.get();
+	}
+
+	std::tie(id_, generation_) = graph_->node_ids().allocate();
+
+	region->bottom_nodes.push_back(this);
+	region->top_nodes.push_back(this);
+	region->nodes.push_back(this);
+}
+
+node::node(const jive::operation & op, jive::region * region)
+	: depth_(0)
+	, graph_(region->graph())
+	, region_(region)
+	, operation_(nullptr)
+	, normal_form_(nullptr)
+{
+	if (op.internable()) {
+		operation_ = &graph_->operations().intern(op);
+	} else {
+		owned_operation_ = op.copy();
+		operation_ = owned_operation_.get();
+	}
+
+	std::tie(id_, generation_) = graph_->node_ids().allocate();
+
 	region->bottom_nodes.push_back(this);
 	region->top_nodes.push_back(this);
 	region->nodes.push_back(this);
@@ -182,6 +219,22 @@ node::~node()
 	inputs_.clear();
 
 	region()->nodes.erase(this);
+
+	graph()->node_ids().release(id_);
+
+	if (!owned_operation_)
+		graph()->operations().release(*operation_);
+}
+
+jive::node_normal_form *
+node::normal_form() const noexcept
+{
+	if (normal_form_ == nullptr) {
+		const auto & op = operation();
+		normal_form_ = graph()->node_normal_form(typeid(op));
+	}
+
+	return normal_form_;
 }
 
 node_input *
@@ -201,6 +254,10 @@ node::add_input(std::unique_ptr<node_input> input)
 	if (new_depth > depth())
 		recompute_depth();
 
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.input_added(this->input(ninputs()-1));
+
 	return this->input(ninputs()-1);
 }
 
@@ -211,12 +268,19 @@ node::remove_input(size_t index)
 	auto producer = node_output::node(input(index)->origin());
 
 	/* remove input */
+	auto input = std::move(inputs_[index]);
 	for (size_t n = index; n < ninputs()-1; n++) {
 		inputs_[n] = std::move(inputs_[n+1]);
 		inputs_[n]->index_ = n;
 	}
 	inputs_.pop_back();
 
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.remove_input(std::move(input), this, index);
+	else
+		input.reset();
+
 	/* recompute depth */
 	if (producer) {
 		auto pdepth = producer->depth();
@@ -233,16 +297,34 @@ node::remove_input(size_t index)
 	}
 }
 
+node_output *
+node::add_output(std::unique_ptr<node_output> output)
+{
+	output->index_ = noutputs();
+	outputs_.push_back(std::move(output));
+
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.output_added(this->output(noutputs()-1));
+
+	return this->output(noutputs()-1);
+}
+
 void
 node::remove_output(size_t index)
 {
 	JIVE_DEBUG_ASSERT(index < noutputs());
 
+	auto output = std::move(outputs_[index]);
 	for (size_t n = index; n < noutputs()-1; n++) {
 		outputs_[n] = std::move(outputs_[n+1]);
 		outputs_[n]->index_ = n;
 	}
 	outputs_.pop_back();
+
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.remove_output(std::move(output), this, index);
 }
 
 void
@@ -311,9 +393,7 @@ producer(const jive::output * output) noexcept
 bool
 normalize(jive::node * node)
 {
-	const auto & op = node->operation();
-	auto nf = node->graph()->node_normal_form(typeid(op));
-	return nf->normalize_node(node);
+	return node->normal_form()->normalize_node(node);
 }
 
 }
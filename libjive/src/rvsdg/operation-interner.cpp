@@ -0,0 +1,106 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/common.hpp>
+#include <jive/rvsdg/operation-interner.hpp>
+
+#include <typeinfo>
+
+namespace jive {
+
+/*
+	Some operations, e.g., state merges, compare equal irrespective of their number of operands.
+	Their nodes must nevertheless not share an operation with different ports.
+*/
+static bool
+same_ports(const jive::operation & op1, const jive::operation & op2) noexcept
+{
+	auto sop1 = dynamic_cast<const jive::simple_op*>(&op1);
+	auto sop2 = dynamic_cast<const jive::simple_op*>(&op2);
+	if (!sop1 || !sop2)
+		return sop1 == nullptr && sop2 == nullptr;
+
+	if (sop1->narguments() != sop2->narguments() || sop1->nresults() != sop2->nresults())
+		return false;
+
+	for (size_t n = 0; n < sop1->narguments(); n++) {
+		if (sop1->argument(n) != sop2->argument(n))
+			return false;
+	}
+
+	for (size_t n = 0; n < sop1->nresults(); n++) {
+		if (sop1->result(n) != sop2->result(n))
+			return false;
+	}
+
+	return true;
+}
+
+const operation_interner::entry *
+operation_interner::lookup(const jive::operation & op, size_t hash) const noexcept
+{
+	auto range = operations_.equal_range(hash);
+	for (auto it = range.first; it != range.second; it++) {
+		auto & candidate = *it->second.operation;
+		if (typeid(candidate) == typeid(op) && candidate == op && same_ports(candidate, op))
+			return &it->second;
+	}
+
+	return nullptr;
+}
+
+const jive::operation &
+operation_interner::intern(const jive::operation & op)
+{
+	JIVE_DEBUG_ASSERT(op.internable());
+
+	auto hash = op.hash();
+	if (auto interned = lookup(op, hash)) {
+		interned->nreferences++;
+		return *interned->operation;
+	}
+
+	return *operations_.emplace(hash, entry({op.copy(), 1}))->second.operation;
+}
+
+const jive::operation &
+operation_interner::intern(std::unique_ptr<jive::operation> op)
+{
+	JIVE_DEBUG_ASSERT(op->internable());
+
+	auto hash = op->hash();
+	if (auto interned = lookup(*op, hash)) {
+		interned->nreferences++;
+		return *interned->operation;
+	}
+
+	return *operations_.emplace(hash, entry({std::move(op), 1}))->second.operation;
+}
+
+void
+operation_interner::release(const jive::operation & op)
+{
+	auto range = operations_.equal_range(op.hash());
+	for (auto it = range.first; it != range.second; it++) {
+		if (it->second.operation.get() != &op)
+			continue;
+
+		JIVE_DEBUG_ASSERT(it->second.nreferences != 0);
+		if (--it->second.nreferences == 0)
+			operations_.erase(it);
+		return;
+	}
+
+	JIVE_DEBUG_ASSERT(0 && "Operation is not interned.");
+}
+
+const jive::operation *
+operation_interner::find(const jive::operation & op) const
+{
+	auto interned = lookup(op, op.hash());
+	return interned ? interned->operation.get() : nullptr;
+}
+
+}
@@ -41,6 +41,18 @@ port::copy() const
 operation::~operation() noexcept
 {}
 
+size_t
+operation::hash() const
+{
+	return typeid(*this).hash_code() ^ std::hash<std::string>()(debug_string());
+}
+
+bool
+operation::internable() const noexcept
+{
+	return true;
+}
+
 jive::node_normal_form *
 operation::normal_form(jive::graph * graph) noexcept
 {
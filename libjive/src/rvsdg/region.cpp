@@ -4,6 +4,8 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <tuple>
+
 #include <jive/common.hpp>
 
 #include <jive/rvsdg/graph.hpp>
@@ -106,6 +108,8 @@ region::~region()
 
 	while (arguments_.size())
 		remove_argument(arguments_.size()-1);
+
+	graph()->region_ids().release(id_);
 }
 
 region::region(jive::region * parent, jive::graph * graph)
@@ -113,6 +117,7 @@ region::region(jive::region * parent, jive::graph * graph)
 	, graph_(graph)
 	, node_(nullptr)
 {
+	std::tie(id_, generation_) = graph->region_ids().allocate();
 	on_region_create(this);
 }
 
@@ -123,6 +128,7 @@ region::region(
 , graph_(node->graph())
 , node_(node)
 {
+	std::tie(id_, generation_) = graph_->region_ids().allocate();
 	on_region_create(this);
 }
 
@@ -141,6 +147,10 @@ region::append_argument(jive::argument * argument)
 	argument->index_ = narguments();
 	arguments_.push_back(argument);
 	on_output_create(argument);
+
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.argument_added(argument);
 }
 
 void
@@ -149,7 +159,12 @@ region::remove_argument(size_t index)
 	JIVE_DEBUG_ASSERT(index < narguments());
 	jive::argument * argument = arguments_[index];
 
-	delete argument;
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.remove_argument(argument, index);
+	else
+		delete argument;
+
 	for (size_t n = index; n < arguments_.size()-1; n++) {
 		arguments_[n] = arguments_[n+1];
 		arguments_[n]->index_ = n;
@@ -175,6 +190,10 @@ region::append_result(jive::result * result)
 	result->index_ = nresults();
 	results_.push_back(result);
 	on_input_create(result);
+
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.result_added(result);
 }
 
 void
@@ -183,7 +202,12 @@ region::remove_result(size_t index)
 	JIVE_DEBUG_ASSERT(index < results_.size());
 	jive::result * result = results_[index];
 
-	delete result;
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.remove_result(result, index);
+	else
+		delete result;
+
 	for (size_t n = index; n < results_.size()-1; n++) {
 		results_[n] = results_[n+1];
 		results_[n]->index_ = n;
@@ -194,7 +218,11 @@ region::remove_result(size_t index)
 void
 region::remove_node(jive::node * node)
 {
-	delete node;
+	auto & changes = graph()->changes();
+	if (changes.recording())
+		changes.remove_node(node);
+	else
+		delete node;
 }
 
 void
@@ -268,8 +296,7 @@ region::normalize(bool recursive)
 				structnode->subregion(n)->normalize(recursive);
 		}
 
-		const auto & op = node->operation();
-		graph()->node_normal_form(typeid(op))->normalize_node(node);
+		node->normal_form()->normalize_node(node);
 	}
 }
 
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/rewrite-profile.hpp>
+
+namespace jive {
+
+rewrite_attempt::rewrite_attempt(
+	jive::graph & graph,
+	std::string_view normal_form,
+	std::string_view rule_name)
+: rule_(nullptr)
+, timed_(false)
+{
+	auto & profile = graph.rewrites();
+	if (!profile.enabled())
+		return;
+
+	rule_ = &profile.lookup(normal_form, rule_name);
+	rule_->attempts++;
+
+	timed_ = profile.timed();
+	if (timed_)
+		start_ = std::chrono::steady_clock::now();
+}
+
+}
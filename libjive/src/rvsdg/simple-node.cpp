@@ -45,14 +45,17 @@ simple_output::~simple_output() noexcept
 
 simple_node::~simple_node()
 {
-	on_node_destroy(this);
+	if (!graph()->changes().destruction_notified(this)) {
+		graph()->node_destroy(this);
+		on_node_destroy(this);
+	}
 }
 
 simple_node::simple_node(
 	jive::region * region,
 	const jive::simple_op & op,
 	const std::vector<jive::output*> & operands)
-	: node(op.copy(), region)
+	: node(op, region)
 {
 	if (operation().narguments() != operands.size())
 		throw jive::compiler_error(jive::detail::strfmt("Argument error - expected ",
@@ -67,15 +70,14 @@ simple_node::simple_node(
 		node::add_output(std::unique_ptr<node_output>(
 			new simple_output(this, operation().result(n))));
 
+	graph()->node_create(this);
 	on_node_create(this);
 }
 
 jive::node *
 simple_node::copy(jive::region * region, const std::vector<jive::output*> & operands) const
 {
-	auto node = create(region, *static_cast<const simple_op*>(&operation()), operands);
-	graph()->mark_denormalized();
-	return node;
+	return create(region, *static_cast<const simple_op*>(&operation()), operands);
 }
 
 jive::node *
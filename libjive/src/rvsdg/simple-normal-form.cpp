@@ -9,15 +9,20 @@
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/simple-normal-form.hpp>
 
+/*
+	returns an existing node that is equivalent to op(arguments), other than the node \p skip.
+	\p op must be interned in the graph of \p region, or not be internable.
+*/
 static jive::node *
 node_cse(
 	jive::region * region,
 	const jive::operation & op,
-	const std::vector<jive::output*> & arguments)
+	const std::vector<jive::output*> & arguments,
+	const jive::node * skip = nullptr)
 {
 	auto cse_test = [&](const jive::node * node)
 	{
-		return node->operation() == op && arguments == jive::operands(node);
+		return node != skip && &node->operation() == &op && arguments == jive::operands(node);
 	};
 
 	if (!arguments.empty()) {
@@ -62,9 +67,8 @@ simple_normal_form::normalize_node(jive::node * node) const
 		return true;
 
 	if (get_cse()) {
-		auto new_node = node_cse(node->region(), node->operation(), operands(node));
-		JIVE_DEBUG_ASSERT(new_node);
-		if (new_node != node) {
+		auto new_node = node_cse(node->region(), node->operation(), operands(node), node);
+		if (new_node) {
 			divert_users(node, outputs(new_node));
 			remove(node);
 			return false;
@@ -80,9 +84,12 @@ simple_normal_form::normalized_create(
 	const jive::simple_op & op,
 	const std::vector<jive::output*> & arguments) const
 {
+	/* nodes compare operations by identity, such that only an interned operation can be shared */
+	auto interned_op = op.internable() ? region->graph()->operations().find(op) : &op;
+
 	jive::node * node = nullptr;
-	if (get_mutable() && get_cse())
-		node = node_cse(region, op, arguments);
+	if (interned_op && get_mutable() && get_cse())
+		node = node_cse(region, *interned_op, arguments);
 	if (!node)
 		node = simple_node::create(region, op, arguments);
 
@@ -128,17 +128,23 @@ mux_normal_form::normalize_node(jive::node * node) const
 	if (!get_mutable())
 		return true;
 
-	auto muxnode = is_mux_mux_reducible(operands(node));
-	if (get_mux_mux_reducible() && muxnode) {
-		divert_users(node, perform_mux_mux_reduction(*op, muxnode, operands(node)));
-		remove(node);
-		return false;
+	if (get_mux_mux_reducible()) {
+		rewrite_attempt attempt(*graph(), "mux", "mux_mux");
+		auto muxnode = is_mux_mux_reducible(operands(node));
+		if (attempt.applies(muxnode != nullptr)) {
+			divert_users(node, perform_mux_mux_reduction(*op, muxnode, operands(node)));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands(node))) {
-		divert_users(node, perform_multiple_origin_reduction(*op, operands(node)));
-		remove(node);
-		return false;
+	if (get_multiple_origin_reducible()) {
+		rewrite_attempt attempt(*graph(), "mux", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands(node)))) {
+			divert_users(node, perform_multiple_origin_reduction(*op, operands(node)));
+			remove(node);
+			return false;
+		}
 	}
 
 	return simple_normal_form::normalize_node(node);
@@ -156,12 +162,18 @@ mux_normal_form::normalized_create(
 	if (!get_mutable())
 		return simple_normal_form::normalized_create(region, op, operands);
 
-	auto muxnode = is_mux_mux_reducible(operands);
-	if (get_mux_mux_reducible() && muxnode)
-		return perform_mux_mux_reduction(*mop, muxnode, operands);
+	if (get_mux_mux_reducible()) {
+		rewrite_attempt attempt(*graph(), "mux", "mux_mux");
+		auto muxnode = is_mux_mux_reducible(operands);
+		if (attempt.applies(muxnode != nullptr))
+			return perform_mux_mux_reduction(*mop, muxnode, operands);
+	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands))
-		return perform_multiple_origin_reduction(*mop, operands);
+	if (get_multiple_origin_reducible()) {
+		rewrite_attempt attempt(*graph(), "mux", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands)))
+			return perform_multiple_origin_reduction(*mop, operands);
+	}
 
 	return simple_normal_form::normalized_create(region, op, operands);
 }
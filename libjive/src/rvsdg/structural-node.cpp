@@ -50,7 +50,10 @@ structural_output::structural_output(
 
 structural_node::~structural_node()
 {
-	on_node_destroy(this);
+	if (!graph()->changes().destruction_notified(this)) {
+		graph()->node_destroy(this);
+		on_node_destroy(this);
+	}
 
 	subregions_.clear();
 }
@@ -59,7 +62,7 @@ structural_node::structural_node(
 	const jive::structural_op & op,
 	jive::region * region,
 	size_t nsubregions)
-: node(op.copy(), region)
+: node(op, region)
 {
 	if (nsubregions == 0)
 		throw compiler_error("Number of subregions must be greater than zero.");
@@ -67,6 +70,7 @@ structural_node::structural_node(
 	for (size_t n = 0; n < nsubregions; n++)
 		subregions_.emplace_back(std::unique_ptr<jive::region>(new jive::region(this, n)));
 
+	graph()->node_create(this);
 	on_node_create(this);
 }
 
@@ -37,9 +37,10 @@ unary_normal_form::normalize_node(jive::node * node) const
 	const auto & op = static_cast<const jive::unary_op&>(node->operation());
 
 	if (get_reducible()) {
+		rewrite_attempt attempt(*graph(), "unary", "reduce");
 		auto tmp = node->input(0)->origin();
 		jive_unop_reduction_path_t reduction = op.can_reduce_operand(tmp);
-		if (reduction != jive_unop_reduction_none) {
+		if (attempt.applies(reduction != jive_unop_reduction_none)) {
 			divert_users(node, {op.reduce_operand(reduction, tmp)});
 			remove(node);
 			return false;
@@ -60,8 +61,9 @@ unary_normal_form::normalized_create(
 	if (get_mutable() && get_reducible()) {
 		const auto & un_op = static_cast<const jive::unary_op&>(op);
 
+		rewrite_attempt attempt(*graph(), "unary", "reduce");
 		jive_unop_reduction_path_t reduction = un_op.can_reduce_operand(arguments[0]);
-		if (reduction != jive_unop_reduction_none) {
+		if (attempt.applies(reduction != jive_unop_reduction_none)) {
 			return {un_op.reduce_operand(reduction, arguments[0])};
 		}
 	}
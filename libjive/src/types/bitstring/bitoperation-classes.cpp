@@ -18,6 +18,12 @@ namespace jive {
 bitunary_op::~bitunary_op() noexcept
 {}
 
+size_t
+bitunary_op::hash() const
+{
+	return typeid(*this).hash_code() ^ type().nbits();
+}
+
 jive_binop_reduction_path_t
 bitunary_op::can_reduce_operand(
 	const jive::output * arg) const noexcept
@@ -47,6 +53,12 @@ bitunary_op::reduce_operand(
 bitbinary_op::~bitbinary_op() noexcept
 {}
 
+size_t
+bitbinary_op::hash() const
+{
+	return typeid(*this).hash_code() ^ type().nbits();
+}
+
 jive_binop_reduction_path_t
 bitbinary_op::can_reduce_operand_pair(
 	const jive::output * arg1,
@@ -78,6 +90,12 @@ bitbinary_op::reduce_operand_pair(
 bitcompare_op::~bitcompare_op() noexcept
 {}
 
+size_t
+bitcompare_op::hash() const
+{
+	return typeid(*this).hash_code() ^ type().nbits();
+}
+
 jive_binop_reduction_path_t
 bitcompare_op::can_reduce_operand_pair(
 	const jive::output * arg1,
@@ -143,6 +143,8 @@ public:
 	std::vector<std::string> includepaths;
 	std::vector<std::string> flags;
 	std::vector<std::string> jlmopts;
+	/* the socket of a jlm-opt server, or empty if jlm-opt is always started as a new process */
+	std::string jlmOptServer;
 
 	std::vector<compilation> compilations;
 };
@@ -154,6 +154,11 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	, cl::desc("jlm-opt optimization. Run 'jlm-opt -help' for viable options.")
 	, cl::value_desc("jlmopt"));
 
+  cl::opt<std::string> jlmOptServer(
+    "jlm-opt-server",
+    cl::desc("Send jlm-opt invocations to the jlm-opt server listening on <socket>, if one is running."),
+    cl::value_desc("socket"));
+
 	cl::opt<bool> verbose(
 	  "v"
 	, cl::ValueDisallowed
@@ -243,6 +248,7 @@ parse_cmdline(int argc, char ** argv, jlm::cmdline_options & options)
 	options.generate_debug_information = generate_debug_information;
 	options.flags = flags;
 	options.jlmopts = jlmopts;
+  options.jlmOptServer = jlmOptServer;
 	options.verbose = verbose;
 	options.rdynamic = rdynamic;
 	options.suppress = suppress;
@@ -101,10 +101,25 @@ generate_commands(const jlm::cmdline_options & opts)
        * have been specified (-J) then use a default set of optimizations.
        */
       std::vector<JlmOptCommand::Optimization> optimizations;
-      if (opts.jlmopts.empty() && opts.Olvl == optlvl::O3) {
+      std::optional<size_t> inliningThreshold, inliningGrowth;
+      if (opts.jlmopts.empty() && opts.Olvl == optlvl::O2) {
         /*
-         * Only -O3 sets default optimizations
+         * -O2 inlines with jlm-opt's default budget and cleans up after it
          */
+        optimizations = {
+          JlmOptCommand::Optimization::FunctionInlining,
+          JlmOptCommand::Optimization::InvariantValueRedirection,
+          JlmOptCommand::Optimization::NodeReduction,
+          JlmOptCommand::Optimization::DeadNodeElimination,
+          JlmOptCommand::Optimization::CommonNodeElimination,
+          JlmOptCommand::Optimization::DeadNodeElimination
+        };
+      } else if (opts.jlmopts.empty() && opts.Olvl == optlvl::O3) {
+        /*
+         * -O3 inlines more aggressively
+         */
+        inliningThreshold = 100;
+        inliningGrowth = 50;
         optimizations = {
           JlmOptCommand::Optimization::FunctionInlining,
           JlmOptCommand::Optimization::InvariantValueRedirection,
@@ -131,7 +146,10 @@ generate_commands(const jlm::cmdline_options & opts)
         *pgraph,
         "/tmp/" + create_prscmd_ofile(c.ifile().base()),
         "/tmp/" + create_optcmd_ofile(c.ifile().base()),
-        optimizations);
+        optimizations,
+        inliningThreshold,
+        inliningGrowth,
+        opts.jlmOptServer.empty() ? std::nullopt : std::make_optional<filepath>(opts.jlmOptServer));
       last->AddEdge(optnode);
       last = &optnode;
     }
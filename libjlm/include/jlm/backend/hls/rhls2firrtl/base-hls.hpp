@@ -18,6 +18,14 @@ namespace jlm {
 
 		class BaseHLS {
 		public:
+			explicit
+			BaseHLS(bool instrument = false)
+			: instrument(instrument)
+			{}
+
+			virtual
+			~BaseHLS() = default;
+
 			std::string
 			run(jlm::RvsdgModule &rm) {
 				assert(node_map.empty());
@@ -31,6 +39,8 @@ namespace jlm {
 			extension() = 0;
 
 		protected:
+			// add handshake performance counters to the circuit
+			bool instrument;
 			std::unordered_map<const jive::node *, std::string> node_map;
 			std::unordered_map<jive::output *, std::string> output_map;
 
@@ -52,6 +62,16 @@ namespace jlm {
 			void
 			create_node_names(jive::region *r);
 
+			/*
+			 * All simple nodes of a region including the ones in nested loops, in the order
+			 * in which they are named by create_node_names.
+			 */
+			static void
+			collect_simple_nodes(jive::region *r, std::vector<jive::node *> &nodes);
+
+			std::string
+			get_perf_counter_name(const jive::node *node, const std::string &counter);
+
 			virtual std::string
 			get_text(jlm::RvsdgModule &rm) = 0;
 
@@ -7,6 +7,7 @@
 #define JLM_BACKEND_HLS_RHLS2FIRRTL_FIRRTL_HLS_HPP
 
 #include <string>
+#include <unordered_map>
 #include <jive/types/bitstring/type.hpp>
 #include <jlm/ir/operators/operators.hpp>
 #include <jive/types/bitstring/comparison.hpp>
@@ -39,6 +40,13 @@ namespace jlm {
 		int jlm_sizeof(const jive::type * t);
 
 		class FirrtlHLS : public BaseHLS {
+		public:
+			explicit
+			FirrtlHLS(bool instrument = false)
+			: BaseHLS(instrument)
+			{}
+
+		private:
 			std::string
 			extension() override {
 				return ".fir";
@@ -48,9 +56,21 @@ namespace jlm {
 			get_text(jlm::RvsdgModule &rm) override;
 
 		private:
-			std::vector<std::pair<const jive::operation*, FirrtlModule>> modules;
+			std::vector<FirrtlModule> modules;
+			// node modules by structural signature, see get_module_signature
+			std::unordered_map<std::string, size_t> module_index;
 			std::vector<std::string> mem_nodes;
 
+			/*
+			 * Key under which the module of a node is shared: the operation and the widths of its
+			 * ports, since operations of different types but same widths map to the same circuit.
+			 */
+			std::string
+			get_module_signature(const jive::node *node);
+
+			FirrtlModule &
+			add_module(const jive::node *node, FirrtlModule module);
+
 			std::string
 			get_module_name(const jive::node *node);
 
@@ -113,6 +133,12 @@ namespace jlm {
 			std::string
 			mux_mem(const std::vector<std::string> &mem_nodes) const;
 
+			std::string
+			perf_io(jive::region *sr);
+
+			std::string
+			perf_counters(jive::region *sr);
+
 			std::string
 			module_header(const jive::node *node, bool has_mem_io = false);
 
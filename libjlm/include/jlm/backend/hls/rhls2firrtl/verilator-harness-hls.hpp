@@ -13,6 +13,17 @@
 namespace jlm {
 	namespace hls {
 		class VerilatorHarnessHLS : public BaseHLS {
+		public:
+			/*
+			 * If instrument is set, the circuit is expected to be generated with performance counters,
+			 * which are then included in the report written at the end of the simulation.
+			 */
+			explicit
+			VerilatorHarnessHLS(bool instrument = false)
+			: BaseHLS(instrument)
+			{}
+
+		private:
 			std::string
 			extension() override {
 				return "_harness.cpp";
@@ -21,7 +32,16 @@ namespace jlm {
 			std::string
 			get_text(jlm::RvsdgModule &rm) override;
 
-		private:
+			std::string
+			perf_report(const jlm::lambda::node *ln);
+
+			/*
+			 * Returns s as the contents of a C string literal, i.e., with quotes, backslashes, and
+			 * non-printable characters escaped.
+			 */
+			static std::string
+			escape_c_string(const std::string &s);
+
 			std::string
 			convert_to_c_type(const jive::type* type);
 
@@ -7,8 +7,11 @@
 #define JLM_BACKEND_HLS_RVSDG2RHLS_ADD_BUFFERS_HPP
 
 #include <jive/rvsdg/region.hpp>
+#include <jlm/ir/hls/hls.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
 
+#include <vector>
+
 namespace jlm{
 	namespace hls{
 		void
@@ -16,6 +19,46 @@ namespace jlm{
 
 		void
 		add_buffers(jlm::RvsdgModule &rm, bool pass_through);
+
+		/*
+		 * Number of cycles a token needs to pass through the circuit generated for node.
+		 * Pass-through buffers and combinational operations have a latency of zero.
+		 */
+		size_t
+		node_latency(const jive::node *node);
+
+		/*
+		 * Recurrence-constrained initiation interval of a loop, i.e., the maximum cycle mean
+		 * of the latencies between its backedge_argument/backedge_result pairs.
+		 */
+		size_t
+		estimate_rec_ii(const loop_node *loop);
+
+		/*
+		 * Estimated initiation interval of a loop, i.e., the maximum of the recurrence-constrained
+		 * II and the number of memory operations sharing the single memory port.
+		 */
+		size_t
+		estimate_ii(const loop_node *loop);
+
+		struct loop_estimate {
+			const loop_node *loop;
+			size_t ii;
+			size_t slots;
+		};
+
+		/*
+		 * Sizes pass-through buffers on the short paths of reconverging forks such
+		 * that a throughput of one token every target_ii cycles is sustained, and
+		 * returns the estimated initiation interval and the inserted buffer slots
+		 * of every loop. Expects the 1:1 input/output relationship established by
+		 * add_forks.
+		 */
+		std::vector<loop_estimate>
+		place_buffers(jive::region *region, size_t target_ii = 1);
+
+		std::vector<loop_estimate>
+		place_buffers(jlm::RvsdgModule &rm, size_t target_ii = 1);
 	}
 }
 #endif //JLM_BACKEND_HLS_RVSDG2RHLS_ADD_BUFFERS_HPP
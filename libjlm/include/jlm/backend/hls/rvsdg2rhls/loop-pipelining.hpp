@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_BACKEND_HLS_RVSDG2RHLS_LOOP_PIPELINING_HPP
+#define JLM_BACKEND_HLS_RVSDG2RHLS_LOOP_PIPELINING_HPP
+
+#include <jive/rvsdg/region.hpp>
+#include <jlm/ir/hls/hls.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+
+#include <vector>
+
+namespace jlm{
+	namespace hls{
+		struct pipeline_estimate {
+			const loop_node *loop;
+			/* estimated II before and after pipelining */
+			size_t initial_ii;
+			size_t ii;
+			/* number of memory states whose loop-carried dependency was removed */
+			size_t separated;
+		};
+
+		/*
+		 * Removes the loop-carried dependency of memory states that are only threaded through
+		 * loads, such that the loads of the next iteration do not wait for the responses of the
+		 * current one. Only the state after the loads of the last iteration leaves the loop.
+		 */
+		size_t
+		separate_memory_recurrences(loop_node *loop);
+
+		/*
+		 * Pipelines all loops between theta_conv and add_forks and returns the achieved initiation
+		 * interval of every loop, innermost loops first.
+		 */
+		std::vector<pipeline_estimate>
+		pipeline_loops(jive::region *region);
+
+		std::vector<pipeline_estimate>
+		pipeline_loops(jlm::RvsdgModule &rm);
+	}
+}
+#endif //JLM_BACKEND_HLS_RVSDG2RHLS_LOOP_PIPELINING_HPP
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_BACKEND_HLS_RVSDG2RHLS_MEMSTATE_CONV_HPP
+#define JLM_BACKEND_HLS_RVSDG2RHLS_MEMSTATE_CONV_HPP
+
+#include <jive/rvsdg/region.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+
+namespace jlm{
+	namespace hls{
+		/*
+		 * Replaces the memory state operators introduced by the memory state encoder: splits
+		 * become plain multiple uses of their operand, which add_forks turns into forks, and
+		 * all other operators become MemStateMerge nodes that join their operands.
+		 */
+		void
+		memstate_conv(jive::region *region);
+
+		/*
+		 * Encodes one memory state per disjoint memory region of the Steensgaard PointsToGraph,
+		 * such that loads and stores of distinct regions are no longer ordered with each other.
+		 */
+		void
+		split_memory_states(jlm::RvsdgModule &rm);
+	}
+}
+#endif //JLM_BACKEND_HLS_RVSDG2RHLS_MEMSTATE_CONV_HPP
@@ -20,7 +20,7 @@ namespace jlm{
 		}
 
 		void
-		rvsdg2rhls(jlm::RvsdgModule &rm);
+		rvsdg2rhls(jlm::RvsdgModule &rm, size_t target_ii = 1);
 
 		void
 		dump_ref(jlm::RvsdgModule &rhls);
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace jive {
 namespace rcd {
@@ -21,6 +22,7 @@ namespace rcd {
 namespace llvm {
 
 class BasicBlock;
+class MDNode;
 class Module;
 class StructType;
 class Value;
@@ -43,6 +45,7 @@ public:
 	context(ipgraph_module & im, llvm::Module & lm)
 	: lm_(lm)
 	, im_(im)
+	, alias_domain_(nullptr)
 	{}
 
 	context(const context&) = delete;
@@ -127,12 +130,56 @@ public:
 		structtypes_[dcl] = type;
 	}
 
+	inline llvm::MDNode *
+	alias_domain() const noexcept
+	{
+		return alias_domain_;
+	}
+
+	inline void
+	set_alias_domain(llvm::MDNode * domain) noexcept
+	{
+		alias_domain_ = domain;
+	}
+
+	inline llvm::MDNode *
+	alias_scope(size_t alias_class) const noexcept
+	{
+		auto it = alias_scopes_.find(alias_class);
+		return it != alias_scopes_.end() ? it->second : nullptr;
+	}
+
+	inline void
+	add_alias_scope(size_t alias_class, llvm::MDNode * scope)
+	{
+		JLM_ASSERT(alias_scopes_.find(alias_class) == alias_scopes_.end());
+		alias_scopes_[alias_class] = scope;
+	}
+
+	/*
+		Sorted alias classes of all loads and stores in the function that is currently converted.
+	*/
+	inline const std::vector<size_t> &
+	alias_classes() const noexcept
+	{
+		return alias_classes_;
+	}
+
+	inline void
+	set_alias_classes(std::vector<size_t> alias_classes)
+	{
+		alias_classes_ = std::move(alias_classes);
+	}
+
 private:
 	llvm::Module & lm_;
 	ipgraph_module & im_;
 	std::unordered_map<const jlm::variable*, llvm::Value*> variables_;
 	std::unordered_map<const jlm::cfg_node*, llvm::BasicBlock*> nodes_;
 	std::unordered_map<const jive::rcddeclaration*, llvm::StructType*> structtypes_;
+	llvm::MDNode * alias_domain_;
+	std::unordered_map<size_t, llvm::MDNode*> alias_scopes_;
+	std::vector<size_t> alias_classes_;
 };
 
 }}
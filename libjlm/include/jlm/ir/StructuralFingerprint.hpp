@@ -0,0 +1,53 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_IR_STRUCTURALFINGERPRINT_HPP
+#define JLM_IR_STRUCTURALFINGERPRINT_HPP
+
+#include <string>
+
+namespace jive {
+  class output;
+}
+
+namespace jlm {
+
+namespace lambda {
+  class node;
+}
+
+/** \brief Computes a structural fingerprint of a lambda node
+ *
+ * The fingerprint is a SHA-256 digest of a canonical serialization of the lambda's operation, i.e., its name,
+ * type, linkage, and attributes, and the operations, types, and edges of all nodes that are reachable from the
+ * results of the lambda's region, including all nested regions. The digest of a node is computed from its operation
+ * and the digests of its operands, and the digest of a region from the digests of its results. The fingerprint is
+ * therefore independent of the identity and the order of nodes and outputs, and two structurally identical lambdas
+ * in different graphs have the same fingerprint. Dead nodes do not contribute to the fingerprint.
+ *
+ * Context variables contribute the symbol name of their origin (see GetSymbolName()) instead of the origin's
+ * structure. Operations contribute their debug string and the attributes that their debug string omits, such as
+ * the alignment of loads, stores, and allocas, or the indices of ExtractValue and shufflevector operations. Types
+ * contribute their debug string, with function and pointer types expanded. The fingerprint is computed in time
+ * linear to the number of nodes and edges of the lambda, and it is stable across program runs.
+ *
+ * @param lambdaNode The lambda node for which the fingerprint is computed.
+ * @return The fingerprint of \p lambdaNode as 64 hexadecimal digits.
+ */
+std::string
+ComputeStructuralFingerprint(const lambda::node & lambdaNode);
+
+/** \brief Returns the symbol name of an output in the root region
+ *
+ * @param output An output.
+ * @return The name of the import if \p output is a root region argument, the name of the lambda or delta node if
+ * \p output is the output of a lambda or delta node in the root region, and an empty string otherwise.
+ */
+std::string
+GetSymbolName(const jive::output & output);
+
+}
+
+#endif
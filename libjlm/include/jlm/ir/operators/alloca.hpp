@@ -35,6 +35,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual bool
+	internable() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -29,6 +29,9 @@ public:
 	bool
  	operator==(const operation & other) const noexcept override;
 
+	size_t
+	hash() const override;
+
 	[[nodiscard]] std::string
 	debug_string() const override;
 
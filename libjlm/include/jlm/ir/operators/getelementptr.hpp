@@ -32,6 +32,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -107,6 +107,9 @@ public:
 	virtual bool
 	operator==(const jive::operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const override;
+
 	virtual std::unique_ptr<jive::operation>
 	copy() const override;
 
@@ -280,6 +283,22 @@ public:
 		jive::region * region,
 		jive::substitution_map & smap) const override;
 
+	/**
+	* Creates a copy of the lambda node in its own region that only differs in its name, linkage, and
+	* attributes. The copy has the same context variables and function argument attributes.
+	*
+	* \param name The copy's name.
+	* \param linkage The copy's linkage.
+	* \param attributes The copy's attributes.
+	*
+	* \return The copied lambda node.
+	*/
+	lambda::node *
+	copy(
+		const std::string & name,
+		const jlm::linkage & linkage,
+		const attributeset & attributes) const;
+
 	/**
 	* Creates a lambda node in the region \p parent with the function type \p type and name \p name.
 	* After the invocation of \ref create(), the lambda node only features the function arguments.
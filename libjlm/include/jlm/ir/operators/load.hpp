@@ -133,6 +133,10 @@ private:
 /** \brief LoadOperation class
  *
  * This operator is the Jlm equivalent of LLVM's load instruction.
+ *
+ * A load operation can carry the alias classes of the memory locations it might access. Two memory
+ * operations with disjoint alias classes never access the same memory location. An empty set of alias
+ * classes indicates that nothing is known about the accessed memory locations.
  */
 class LoadOperation final : public jive::simple_op {
 public:
@@ -141,14 +145,19 @@ public:
   LoadOperation(
     const PointerType & pointerType,
     size_t numStates,
-    size_t alignment)
+    size_t alignment,
+    std::vector<size_t> aliasClasses = {})
     : simple_op(CreatePorts(pointerType, numStates), CreatePorts(pointerType.GetElementType(), numStates))
     , alignment_(alignment)
+    , aliasClasses_(std::move(aliasClasses))
   {}
 
   bool
   operator==(const operation & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -173,6 +182,14 @@ public:
     return alignment_;
   }
 
+  /** \brief Returns the sorted alias classes of the memory locations the load might access.
+   */
+  [[nodiscard]] const std::vector<size_t> &
+  GetAliasClasses() const noexcept
+  {
+    return aliasClasses_;
+  }
+
   static jlm::load_normal_form *
   GetNormalForm(jive::graph * graph) noexcept
   {
@@ -211,6 +228,7 @@ private:
   }
 
   size_t alignment_;
+  std::vector<size_t> aliasClasses_;
 };
 
 class LoadNode final : public jive::simple_node {
@@ -298,6 +316,12 @@ public:
     return GetOperation().GetAlignment();
   }
 
+  [[nodiscard]] const std::vector<size_t> &
+  GetAliasClasses() const noexcept
+  {
+    return GetOperation().GetAliasClasses();
+  }
+
   [[nodiscard]] jive::input *
   GetAddressInput() const noexcept
   {
@@ -314,18 +338,22 @@ public:
     return valueOutput;
   }
 
+  jive::node *
+  copy(jive::region * region, const std::vector<jive::output*> & operands) const override;
+
   static std::vector<jive::output*>
   Create(
     jive::output * address,
     const std::vector<jive::output*> & states,
-    size_t alignment)
+    size_t alignment,
+    std::vector<size_t> aliasClasses = {})
   {
     auto & pointerType = CheckAndConvertType(address->type());
 
     std::vector<jive::output*> operands({address});
     operands.insert(operands.end(), states.begin(), states.end());
 
-    LoadOperation loadOperation(pointerType, states.size(), alignment);
+    LoadOperation loadOperation(pointerType, states.size(), alignment, std::move(aliasClasses));
     return jive::outputs(new LoadNode(
       *address->region(),
       loadOperation,
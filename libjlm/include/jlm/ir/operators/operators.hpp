@@ -780,6 +780,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -964,6 +967,9 @@ public:
   bool
   operator==(const operation & other) const noexcept override;
 
+  size_t
+  hash() const override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -1578,6 +1584,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -2409,6 +2418,9 @@ public:
 	: simple_op(create_portvector(noperands), create_portvector(nresults))
 	{}
 
+	virtual size_t
+	hash() const override;
+
 private:
 	static std::vector<jive::port>
 	create_portvector(size_t size)
@@ -2502,6 +2514,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual bool
+	internable() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -2556,6 +2571,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual bool
+	internable() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -2645,6 +2663,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual bool
+	internable() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -2715,6 +2736,95 @@ private:
 	}
 };
 
+/* memset operation */
+
+class Memset final : public jive::simple_op {
+public:
+	virtual
+	~Memset();
+
+	Memset(
+		const std::vector<jive::port> & operandPorts,
+		const std::vector<jive::port> & resultPorts)
+	: simple_op(operandPorts, resultPorts)
+	{}
+
+	virtual bool
+	operator==(const operation & other) const noexcept override;
+
+	virtual bool
+	internable() const noexcept override;
+
+	virtual std::string
+	debug_string() const override;
+
+	virtual std::unique_ptr<jive::operation>
+	copy() const override;
+
+	static std::unique_ptr<jlm::tac>
+	create(
+		const variable * destination,
+		const variable * value,
+		const variable * length,
+		const variable * isVolatile,
+		const std::vector<const variable*> & memoryStates)
+	{
+		auto operandPorts = CheckAndCreateOperandPorts(length->type(), memoryStates.size());
+		auto resultPorts = CreateResultPorts(memoryStates.size());
+
+		std::vector<const variable*> operands = {destination, value, length, isVolatile};
+		operands.insert(operands.end(), memoryStates.begin(), memoryStates.end());
+
+		Memset op(operandPorts, resultPorts);
+		return tac::create(op, operands);
+	}
+
+	static std::vector<jive::output*>
+	create(
+		jive::output * destination,
+		jive::output * value,
+		jive::output * length,
+		jive::output * isVolatile,
+		const std::vector<jive::output*> & memoryStates)
+	{
+		auto operandPorts = CheckAndCreateOperandPorts(length->type(), memoryStates.size());
+		auto resultPorts = CreateResultPorts(memoryStates.size());
+
+		std::vector<jive::output*> operands = {destination, value, length, isVolatile};
+		operands.insert(operands.end(), memoryStates.begin(), memoryStates.end());
+
+		Memset op(operandPorts, resultPorts);
+		return jive::simple_node::create_normalized(destination->region(), op, operands);
+	}
+
+private:
+	static std::vector<jive::port>
+	CheckAndCreateOperandPorts(
+		const jive::type & length,
+		size_t nMemoryStates)
+	{
+		if (length != jive::bit32
+		&& length != jive::bit64)
+			throw jlm::error("Expected 32 bit or 64 bit integer type.");
+
+		if (nMemoryStates == 0)
+			throw jlm::error("Number of memory states cannot be zero.");
+
+		PointerType pt(jive::bit8);
+
+		std::vector<jive::port> ports = {pt, jive::bit8, length, jive::bit1};
+		ports.insert(ports.end(), nMemoryStates, {MemoryStateType::Create()});
+
+		return ports;
+	}
+
+	static std::vector<jive::port>
+	CreateResultPorts(size_t nMemoryStates)
+	{
+		return std::vector<jive::port>(nMemoryStates, {MemoryStateType::Create()});
+	}
+};
+
 /*
 	FIXME: This function should be in jive and not in jlm.
 */
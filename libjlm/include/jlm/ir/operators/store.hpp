@@ -82,6 +82,8 @@ private:
 /** \brief Store Operation
  *
  * This operator is the Jlm equivalent of LLVM's store instruction.
+ *
+ * Like LoadOperation, a store operation can carry the alias classes of the memory locations it might access.
  */
 class StoreOperation final : public jive::simple_op {
 public:
@@ -90,16 +92,21 @@ public:
   StoreOperation(
     const PointerType & pointerType,
     size_t numStates,
-    size_t alignment)
+    size_t alignment,
+    std::vector<size_t> aliasClasses = {})
     : simple_op(
     CreateArgumentPorts(pointerType, numStates),
     std::vector<jive::port>(numStates, {MemoryStateType::Create()}))
     , Alignment_(alignment)
+    , AliasClasses_(std::move(aliasClasses))
   {}
 
   bool
   operator==(const operation & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -130,6 +137,14 @@ public:
     return Alignment_;
   }
 
+  /** \brief Returns the sorted alias classes of the memory locations the store might access.
+   */
+  [[nodiscard]] const std::vector<size_t> &
+  GetAliasClasses() const noexcept
+  {
+    return AliasClasses_;
+  }
+
   static jlm::store_normal_form *
   GetNormalForm(jive::graph * graph) noexcept
   {
@@ -165,6 +180,7 @@ private:
   }
 
   size_t Alignment_;
+  std::vector<size_t> AliasClasses_;
 };
 
 /** \brief StoreNode class
@@ -255,6 +271,12 @@ public:
     return GetOperation().GetAlignment();
   }
 
+  [[nodiscard]] const std::vector<size_t> &
+  GetAliasClasses() const noexcept
+  {
+    return GetOperation().GetAliasClasses();
+  }
+
   [[nodiscard]] jive::input *
   GetAddressInput() const noexcept
   {
@@ -271,19 +293,23 @@ public:
     return valueInput;
   }
 
+  jive::node *
+  copy(jive::region * region, const std::vector<jive::output*> & operands) const override;
+
   static std::vector<jive::output*>
   Create(
     jive::output * address,
     jive::output * value,
     const std::vector<jive::output*> & states,
-    size_t alignment)
+    size_t alignment,
+    std::vector<size_t> aliasClasses = {})
   {
     auto & pointerType = CheckAndConvertType(address->type());
 
     std::vector<jive::output*> operands({address, value});
     operands.insert(operands.end(), states.begin(), states.end());
 
-    StoreOperation storeOperation(pointerType, states.size(), alignment);
+    StoreOperation storeOperation(pointerType, states.size(), alignment, std::move(aliasClasses));
     return jive::outputs(new StoreNode(
       *address->region(),
       storeOperation,
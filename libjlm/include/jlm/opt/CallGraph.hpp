@@ -0,0 +1,243 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_CALLGRAPH_HPP
+#define JLM_OPT_CALLGRAPH_HPP
+
+#include <jlm/ir/operators/call.hpp>
+#include <jlm/ir/operators/lambda.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm {
+
+class RvsdgModule;
+
+/** \brief Call graph of an RVSDG module
+ *
+ * The call graph contains a node for every lambda of a module and a call site for every call node within these
+ * lambdas. Call sites are classified with CallNode::ClassifyCall(), and only direct calls are attributed to a callee.
+ *
+ * The strongly connected components of the call graph are given by the phi nodes of the module: all lambdas of a phi
+ * node form a single component, and every other lambda forms a component on its own. The components are ordered
+ * bottom-up, i.e., a component is only preceded by components it calls.
+ */
+class CallGraph final {
+public:
+  class CallSite;
+  class Node;
+
+  using CallType = CallTypeClassifier::CallType;
+
+  ~CallGraph();
+
+  CallGraph(const CallGraph&) = delete;
+
+  CallGraph(CallGraph&&) = delete;
+
+  CallGraph &
+  operator=(const CallGraph&) = delete;
+
+  CallGraph &
+  operator=(CallGraph&&) = delete;
+
+private:
+  CallGraph() = default;
+
+public:
+  /** \brief Returns the call graph node of \p lambda.
+   *
+   * @param lambda A lambda node of the module the call graph was created from.
+   */
+  [[nodiscard]] Node &
+  GetNode(const lambda::node & lambda) const;
+
+  [[nodiscard]] size_t
+  NumNodes() const noexcept
+  {
+    return Nodes_.size();
+  }
+
+  [[nodiscard]] size_t
+  NumCallSites() const noexcept
+  {
+    return CallSites_.size();
+  }
+
+  /** \brief Returns the strongly connected components in bottom-up order.
+   */
+  [[nodiscard]] const std::vector<std::vector<lambda::node*>> &
+  GetSccs() const noexcept
+  {
+    return Sccs_;
+  }
+
+  /** \brief Checks whether \p lambda is part of a recursion.
+   *
+   * A lambda is recursive if it shares its strongly connected component with other lambdas or calls itself.
+   */
+  [[nodiscard]] bool
+  IsRecursive(const lambda::node & lambda) const;
+
+  static std::unique_ptr<CallGraph>
+  Create(const RvsdgModule & rvsdgModule);
+
+private:
+  void
+  AddScc(const std::vector<lambda::node*> & lambdas);
+
+  void
+  CollectCallSites(
+    Node & caller,
+    jive::region & region,
+    size_t loopDepth);
+
+  std::unordered_map<const lambda::node*, std::unique_ptr<Node>> Nodes_;
+  std::vector<std::unique_ptr<CallSite>> CallSites_;
+  std::vector<std::vector<lambda::node*>> Sccs_;
+};
+
+/** \brief Call site of a call graph
+ */
+class CallGraph::CallSite final {
+public:
+  CallSite(
+    CallNode & callNode,
+    Node & caller,
+    Node * callee,
+    CallType callType,
+    size_t loopDepth)
+    : CallNode_(&callNode)
+    , Caller_(&caller)
+    , Callee_(callee)
+    , CallType_(callType)
+    , LoopDepth_(loopDepth)
+  {}
+
+  [[nodiscard]] CallNode &
+  GetCallNode() const noexcept
+  {
+    return *CallNode_;
+  }
+
+  [[nodiscard]] Node &
+  GetCaller() const noexcept
+  {
+    return *Caller_;
+  }
+
+  /** \brief Returns the called function.
+   *
+   * @return The called function for direct calls, otherwise nullptr.
+   */
+  [[nodiscard]] Node *
+  GetCallee() const noexcept
+  {
+    return Callee_;
+  }
+
+  [[nodiscard]] CallType
+  GetCallType() const noexcept
+  {
+    return CallType_;
+  }
+
+  /** \brief Returns the number of theta nodes within the caller that enclose the call.
+   */
+  [[nodiscard]] size_t
+  GetLoopDepth() const noexcept
+  {
+    return LoopDepth_;
+  }
+
+  /** \brief Returns the nullary node that produces the n-th argument of the call.
+   *
+   * Constants are traced through gamma entry variables.
+   *
+   * @return The node that produces the argument if it is a constant, otherwise nullptr.
+   */
+  [[nodiscard]] jive::simple_node *
+  GetConstantArgument(size_t n) const;
+
+  /** \brief Returns the number of arguments that are constants at the call site.
+   */
+  [[nodiscard]] size_t
+  NumConstantArguments() const;
+
+private:
+  CallNode * CallNode_;
+  Node * Caller_;
+  Node * Callee_;
+  CallType CallType_;
+  size_t LoopDepth_;
+};
+
+/** \brief Call graph node
+ */
+class CallGraph::Node final {
+  friend CallGraph;
+
+public:
+  Node(
+    lambda::node & lambda,
+    size_t scc)
+    : Lambda_(&lambda)
+    , Scc_(scc)
+    , HasOnlyDirectCalls_(lambda.direct_calls())
+  {}
+
+  [[nodiscard]] lambda::node &
+  GetLambda() const noexcept
+  {
+    return *Lambda_;
+  }
+
+  /** \brief Returns the index of the node's strongly connected component in CallGraph::GetSccs().
+   */
+  [[nodiscard]] size_t
+  GetScc() const noexcept
+  {
+    return Scc_;
+  }
+
+  /** \brief Returns the call sites within the lambda.
+   */
+  [[nodiscard]] const std::vector<CallSite*> &
+  GetCallSites() const noexcept
+  {
+    return CallSites_;
+  }
+
+  /** \brief Returns the direct call sites of the lambda.
+   */
+  [[nodiscard]] const std::vector<CallSite*> &
+  GetCallers() const noexcept
+  {
+    return Callers_;
+  }
+
+  /** \brief Checks whether the lambda is only used by direct calls.
+   *
+   * The lambda is neither exported nor does its address escape.
+   */
+  [[nodiscard]] bool
+  HasOnlyDirectCalls() const noexcept
+  {
+    return HasOnlyDirectCalls_;
+  }
+
+private:
+  lambda::node * Lambda_;
+  size_t Scc_;
+  bool HasOnlyDirectCalls_;
+  std::vector<CallSite*> CallSites_;
+  std::vector<CallSite*> Callers_;
+};
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_COMPILATIONBUDGET_HPP
+#define JLM_OPT_COMPILATIONBUDGET_HPP
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace jlm {
+
+class optimization;
+class RvsdgModule;
+class StatisticsDescriptor;
+
+namespace lambda {
+  class node;
+}
+
+/** \brief Compile-time budgets for an optimization pipeline
+ *
+ * A compilation budget bounds the time and the node growth of a pass pipeline. The budgets are checked between
+ * passes: Once the time budget or the growth budget is exceeded, all remaining passes of the pipeline are skipped,
+ * except for dead node elimination and node reduction. A single pass can therefore still exceed the time budget.
+ *
+ * The budgets are enforced for the module, and optionally for every lambda individually. Lambdas with their own
+ * budget are extracted into separate modules and optimized in isolation, which is only correct for pipelines of
+ * intraprocedural optimizations. It is the responsibility of the caller to ensure this.
+ *
+ * Cold lambdas, i.e., lambdas with the cold attribute or with fewer nodes than the cold threshold, take a fast path
+ * that only runs dead node elimination and node reduction. They are extracted from the module while the pipeline
+ * runs on it, and are therefore neither inlined nor specialized.
+ *
+ * All decisions are reported with the CompilationBudget statistics: one line per module and per extracted lambda.
+ */
+class CompilationBudget final {
+public:
+  /**
+   * A time budget in milliseconds and a growth budget in percent of the initial number of nodes. A budget without
+   * value is unlimited.
+   */
+  struct Limits {
+    std::optional<size_t> Time;
+    std::optional<size_t> Growth;
+  };
+
+  /**
+   * @param moduleLimits The budgets of the module.
+   * @param lambdaLimits The budgets of every lambda. If any of them is set, then every extractable lambda is
+   * optimized in isolation.
+   * @param coldThreshold Lambdas with fewer nodes take the cold fast path. Zero only considers lambdas with the cold
+   * attribute as cold.
+   */
+  CompilationBudget(
+    Limits moduleLimits,
+    Limits lambdaLimits,
+    size_t coldThreshold)
+    : ModuleLimits_(moduleLimits)
+    , LambdaLimits_(lambdaLimits)
+    , ColdThreshold_(coldThreshold)
+  {}
+
+  /**
+   * Runs \p optimizations on \p rvsdgModule within the budgets.
+   */
+  void
+  Run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor,
+    const std::vector<optimization*> & optimizations) const;
+
+  /**
+   * @return True if \p lambdaNode has the cold attribute or fewer than \p coldThreshold nodes.
+   */
+  static bool
+  IsCold(
+    const lambda::node & lambdaNode,
+    size_t coldThreshold);
+
+private:
+  Limits ModuleLimits_;
+  Limits LambdaLimits_;
+  size_t ColdThreshold_;
+};
+
+}
+
+#endif
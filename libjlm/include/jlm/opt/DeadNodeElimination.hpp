@@ -8,6 +8,7 @@
 
 #include <jlm/opt/optimization.hpp>
 
+#include <jive/rvsdg/side-table.hpp>
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/structural-node.hpp>
 
@@ -68,27 +69,27 @@ class DeadNodeElimination final : public optimization {
     MarkAlive(const jive::output & output)
     {
       if (auto simpleOutput = dynamic_cast<const jive::simple_output*>(&output)) {
-          simpleNodes_.insert(simpleOutput->node());
+          simpleNodes_[*simpleOutput->node()] = true;
           return;
       }
 
-      outputs_.insert(&output);
+      outputs_[output] = true;
     }
 
     bool
     IsAlive(const jive::output & output) const noexcept
     {
       if (auto simpleOutput = dynamic_cast<const jive::simple_output*>(&output))
-        return simpleNodes_.find(simpleOutput->node()) != simpleNodes_.end();
+        return simpleNodes_.contains(*simpleOutput->node());
 
-      return outputs_.find(&output) != outputs_.end();
+      return outputs_.contains(output);
     }
 
     bool
     IsAlive(const jive::node & node) const noexcept
     {
       if (auto simpleNode = dynamic_cast<const jive::simple_node*>(&node))
-        return simpleNodes_.find(simpleNode) != simpleNodes_.end();
+        return simpleNodes_.contains(*simpleNode);
 
       for (size_t n = 0; n < node.noutputs(); n++) {
         if (IsAlive(*node.output(n)))
@@ -106,8 +107,8 @@ class DeadNodeElimination final : public optimization {
     }
 
   private:
-    std::unordered_set<const jive::simple_node*> simpleNodes_;
-    std::unordered_set<const jive::output*> outputs_;
+    jive::NodeMap<bool> simpleNodes_;
+    jive::OutputMap<bool> outputs_;
   };
 
   class Statistics;
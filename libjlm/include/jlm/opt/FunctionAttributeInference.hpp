@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_FUNCTIONATTRIBUTEINFERENCE_HPP
+#define JLM_OPT_FUNCTIONATTRIBUTEINFERENCE_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Function Attribute Inference
+ *
+ * Function Attribute Inference infers the read_none, read_only, and no_recurse function attributes as well as the
+ * no_capture attribute of pointer arguments, and attaches them to the lambda nodes of a module. The lambdas are
+ * visited bottom-up along the strongly connected components of the call graph such that the attributes of callees are
+ * known when their callers are processed. The lambdas of a strongly connected component are iterated optimistically
+ * until a fixed point is reached.
+ *
+ * ### Memory Effects
+ * A lambda is read_none if it does not access memory, and read_only if it only reads memory. Loads and stores of
+ * memory that was allocated by the lambda itself are not visible to its callers and are therefore ignored, as long as
+ * the lambda is not recursive. This is determined with the points-to graph of the Steensgaard alias analysis. Calls
+ * contribute the memory effects of their callee, while external and indirect calls are assumed to read and write
+ * memory.
+ *
+ * ### No Capture
+ * A pointer argument is no_capture if no copy of it outlives the call. This is the case if it, or a pointer derived
+ * from it, is only used as the address of loads and stores, in pointer comparisons, or as a no_capture argument of
+ * direct calls.
+ *
+ * ### No Recurse
+ * A lambda is no_recurse if it is not part of a recursion and only performs direct calls to no_recurse lambdas.
+ */
+class FunctionAttributeInference final : public optimization {
+public:
+  ~FunctionAttributeInference() override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+};
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_FUNCTIONCACHE_HPP
+#define JLM_OPT_FUNCTIONCACHE_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <string>
+#include <vector>
+
+namespace jlm {
+
+class optimization;
+class RvsdgModule;
+class StatisticsDescriptor;
+
+namespace lambda {
+  class node;
+}
+
+/** \brief On-disk cache of optimized lambdas
+ *
+ * The function cache maps the structural fingerprint of a lambda node (see ComputeStructuralFingerprint()) and a
+ * pass pipeline to the lambda that resulted from optimizing it with the pipeline. Lambdas with a cache entry are
+ * replaced by imports before the pipeline runs and restored from the cache afterwards, such that unchanged
+ * functions skip optimization entirely.
+ *
+ * Entries are stored in a directory as LLVM IR files that are named after a key. The key is a SHA-256 digest of the
+ * fingerprint, the pipeline, the version of the entry format, and an identifier of the optimizer build, such that
+ * entries are neither shared between different lambdas nor restored by another build of the optimizer. The file
+ * <key>.ll contains the lambda after optimization, i.e., a single function definition and declarations for the
+ * context variables of the lambda. A lookup only computes the key, such that a miss costs a single file system
+ * access. If no build identifier can be determined, the cache is not used.
+ *
+ * Only lambdas in the root region whose context variables originate from imports, lambdas, or deltas are cached.
+ * The cache is only correct for pipelines of intraprocedural optimizations, i.e., optimizations that transform a
+ * lambda independently of all other lambdas. It is the responsibility of the caller to ensure this.
+ */
+class FunctionCache final {
+public:
+  /**
+   * @param directory The directory that stores the cache entries. It is created if it does not exist.
+   * @param pipeline A description of the pass pipeline. Entries are only shared between identical descriptions.
+   */
+  FunctionCache(
+    jlm::filepath directory,
+    std::string pipeline);
+
+  /** \brief Optimizes a module with the help of the cache
+   *
+   * Runs \p optimizations on all lambdas of \p rvsdgModule without a cache entry, and restores all other lambdas
+   * from the cache. Entries are added for all optimized lambdas.
+   *
+   * @param rvsdgModule The module that is optimized.
+   * @param statisticsDescriptor The statistics descriptor for the optimizations and the cache statistics.
+   * @param optimizations The pass pipeline.
+   */
+  void
+  Run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor,
+    const std::vector<optimization*> & optimizations) const;
+
+  /**
+   * @return True if all context variables of \p lambdaNode originate from imports, lambdas, or deltas in the root
+   * region, i.e., if \p lambdaNode can be cached.
+   */
+  static bool
+  IsCacheable(const lambda::node & lambdaNode);
+
+private:
+  jlm::filepath Directory_;
+  std::string Pipeline_;
+};
+
+}
+
+#endif
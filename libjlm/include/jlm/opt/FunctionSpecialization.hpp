@@ -0,0 +1,61 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_FUNCTIONSPECIALIZATION_HPP
+#define JLM_OPT_FUNCTIONSPECIALIZATION_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+#include <cstddef>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Function Specialization
+ *
+ * Function specialization creates copies of functions for the constant arguments of their direct call sites. The
+ * direct call sites of every non-recursive lambda are grouped by the constants they pass to the arguments that are
+ * used within the lambda. For every group, the lambda is copied and the uses of the specialized arguments are
+ * diverted to the respective constants in the copy. The call sites of the group are then redirected to the copy.
+ * The normal forms, e.g., the predicate reduction of gamma nodes, can afterwards fold the computations that depend on
+ * the constants.
+ *
+ * If a lambda is neither exported nor escapes, and all its call sites pass the same constants, then the lambda is
+ * specialized in place instead of copied. Otherwise, copies are only created as long as the module does not grow
+ * beyond its growth budget. Copies have internal linkage and are only reachable from the redirected call sites, such
+ * that a lambda without any remaining callers is removed by dead node elimination.
+ */
+class FunctionSpecialization final : public optimization {
+public:
+  ~FunctionSpecialization() override;
+
+  /**
+   * @param growth The maximal growth of the module in percent of its number of nodes.
+   */
+  explicit
+  FunctionSpecialization(size_t growth = 20)
+    : Growth_(growth)
+  {}
+
+  [[nodiscard]] size_t
+  GetGrowth() const noexcept
+  {
+    return Growth_;
+  }
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+
+private:
+  size_t Growth_;
+};
+
+}
+
+#endif
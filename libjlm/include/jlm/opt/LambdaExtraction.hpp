@@ -0,0 +1,104 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_LAMBDAEXTRACTION_HPP
+#define JLM_OPT_LAMBDAEXTRACTION_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jive {
+  class graph;
+  class input;
+  class region;
+}
+
+namespace jlm {
+
+class RvsdgModule;
+
+namespace lambda {
+  class node;
+}
+
+/**
+ * @return The lambda node with name \p name in \p region, or nullptr if there is none.
+ */
+lambda::node *
+FindLambda(
+  jive::region & region,
+  const std::string & name);
+
+/**
+ * @return True if \p lambdaNode is in the root region and all its context variables originate from imports,
+ * lambdas, or deltas, i.e., if \p lambdaNode can be extracted with ExtractLambda().
+ */
+bool
+IsExtractable(const lambda::node & lambdaNode);
+
+/**
+ * Copies \p lambdaNode into a new module. The context variables of the lambda are replaced by imports that have
+ * the same names as their original origins.
+ */
+std::unique_ptr<RvsdgModule>
+ExtractLambda(
+  const lambda::node & lambdaNode,
+  const RvsdgModule & rvsdgModule);
+
+/** \brief Lambda that is temporarily removed from its graph
+ *
+ * A detached lambda is replaced by an import with the same name, such that optimizations of the graph leave it
+ * untouched. The origins of its context variables are kept alive by temporary exports. Reattach() replaces the
+ * import with the lambda of a separate module, e.g., a module that was created with ExtractLambda() and optimized
+ * independently, and removes the temporary exports.
+ */
+class DetachedLambda final {
+public:
+  /**
+   * Replaces \p lambdaNode with an import.
+   *
+   * @param lambdaNode An extractable lambda node, see IsExtractable().
+   * @param module A module with a lambda of the same name as \p lambdaNode. The imports of the module must have
+   * the names of the context variable origins of \p lambdaNode.
+   */
+  DetachedLambda(
+    lambda::node & lambdaNode,
+    std::unique_ptr<RvsdgModule> module);
+
+  DetachedLambda(const DetachedLambda &) = delete;
+
+  DetachedLambda &
+  operator=(const DetachedLambda &) = delete;
+
+  const std::string &
+  Name() const noexcept
+  {
+    return Name_;
+  }
+
+  RvsdgModule &
+  Module() const noexcept
+  {
+    return *Module_;
+  }
+
+  /**
+   * Replaces the import of the detached lambda in \p graph with a copy of the lambda from Module(). The lambda is
+   * not restored if the import was removed from \p graph, e.g., because it became dead.
+   */
+  void
+  Reattach(jive::graph & graph);
+
+private:
+  std::string Name_;
+  std::unique_ptr<RvsdgModule> Module_;
+  std::vector<std::pair<std::string, jive::input*>> Dependencies_;
+};
+
+}
+
+#endif
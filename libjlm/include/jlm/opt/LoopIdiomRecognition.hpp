@@ -0,0 +1,43 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_LOOPIDIOMRECOGNITION_HPP
+#define JLM_OPT_LOOPIDIOMRECOGNITION_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Loop Idiom Recognition
+ *
+ * Loop Idiom Recognition replaces theta nodes that initialize or copy arrays element by element with a single Memset or
+ * Memcpy node. A theta node is replaced if:
+ *
+ * 1. Its induction variable, as recognized by unrollinfo, starts at an arbitrary value and is incremented by one in
+ *    every iteration. The number of iterations is either known or computed from the induction variable's start and
+ *    end value.
+ * 2. Its only side effect is a single store to the element of an array that is indexed by the induction variable, or
+ *    by the induction variable's value from the previous iteration as introduced by theta-gamma inversion.
+ * 3. The stored value is either loop-invariant and consists of identical bytes (Memset), or is loaded from the element
+ *    of another array that is indexed by the induction variable (Memcpy). The arrays of a Memcpy must be distinct
+ *    allocas, or one of them must be a noalias function argument.
+ * 4. All other loop variables are loop-invariant or memory states threaded through the load and store.
+ */
+class LoopIdiomRecognition final : public optimization {
+public:
+  ~LoopIdiomRecognition() override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+};
+
+}
+
+#endif
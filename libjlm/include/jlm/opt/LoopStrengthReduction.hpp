@@ -0,0 +1,57 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_LOOPSTRENGTHREDUCTION_HPP
+#define JLM_OPT_LOOPSTRENGTHREDUCTION_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Loop Strength Reduction
+ *
+ * Loop strength reduction replaces expressions that are derived from induction variables of theta nodes with new
+ * loop variables that are updated additively. An induction variable is a loop variable i that is updated with
+ * i + step, where step is invariant in the theta node. The following expressions are reduced:
+ *
+ * - A multiplication i * c with an invariant c is replaced by a loop variable with the initial value init * c and
+ *   the update i' + step * c. The new loop variable is itself an induction variable.
+ * - An address getelementptr(base, ..., i) with an invariant base and invariant leading indices is replaced by a
+ *   pointer loop variable with the initial value getelementptr(base, ..., init) and the update
+ *   getelementptr(p, step).
+ *
+ * Afterwards, linear function test replacement rewrites the predicate of a theta node to test one of the derived
+ * loop variables if the only remaining use of an induction variable is the loop predicate. This requires a known
+ * number of iterations (see unrollinfo), such that the value of the derived loop variable in the last iteration can
+ * be computed. The original induction variable is then dead and removed by dead node elimination.
+ */
+class LoopStrengthReduction final : public optimization {
+public:
+  ~LoopStrengthReduction() override;
+
+  /**
+   * @param comparePointers Determines whether the predicate can be replaced with a comparison of pointer loop
+   * variables. Backends that do not support pointer comparisons, e.g., HLS, disable it.
+   */
+  explicit
+  LoopStrengthReduction(bool comparePointers = true)
+    : ComparePointers_(comparePointers)
+  {}
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+
+private:
+  bool ComparePointers_;
+};
+
+}
+
+#endif
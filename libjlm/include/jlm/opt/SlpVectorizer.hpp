@@ -0,0 +1,46 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_SLPVECTORIZER_HPP
+#define JLM_OPT_SLPVECTORIZER_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Superword-Level Parallelism Vectorizer
+ *
+ * The SLP vectorizer combines isomorphic scalar operations on adjacent memory locations into vector operations. It is
+ * most effective on theta bodies after loop unrolling, but considers all regions of a module.
+ *
+ * The vectorizer starts from groups of stores of the same type to consecutive array elements, i.e., getelementptr
+ * nodes with the same base and the same leading indices, whose last indices differ only by a constant. From the stored
+ * values, it builds a tree of isomorphic binary operations and loads from consecutive addresses. Values that cannot
+ * be combined are gathered into a vector element by element.
+ *
+ * A group is only vectorized if the memory states of its loads and stores form a chain without any other
+ * operations in between, and all loads can be moved before all stores, i.e., no load of a lane reads a location written
+ * by a store of another lane.
+ *
+ * The vectorizer assumes a target with 128 bit wide vector registers. A group is replaced if the number of operations
+ * in the vectorized tree is smaller than the number of scalar operations, where gathering a vector costs one operation
+ * per element.
+ */
+class SlpVectorizer final : public optimization {
+public:
+  ~SlpVectorizer() override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+};
+
+}
+
+#endif
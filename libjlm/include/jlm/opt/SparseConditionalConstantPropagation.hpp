@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_SPARSECONDITIONALCONSTANTPROPAGATION_HPP
+#define JLM_OPT_SPARSECONDITIONALCONSTANTPROPAGATION_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Sparse Conditional Constant Propagation
+ *
+ * Sparse Conditional Constant Propagation (SCCP) computes for every output and region argument of the RVSDG whether it
+ * is a bitstring or control constant. It uses the lattice Top > Constant > Bottom, and starts optimistically with Top
+ * for all values. The analysis propagates values through simple nodes by folding bitstring unary, binary, and
+ * comparison operations as well as match operations, and through structural nodes as follows:
+ *
+ * - The inputs of structural nodes are propagated to their arguments, e.g., gamma entry variables and lambda, phi,
+ *   and delta context variables.
+ * - A gamma output only considers the subregions that are selected by the gamma predicate. If the predicate is a
+ *   constant, then the results of all other subregions are ignored.
+ * - A theta argument is the meet of its input and its result. The result is only considered if the theta predicate
+ *   is not the constant that exits the loop after the first iteration.
+ * - Lambda function arguments, phi recursion variables, as well as the outputs of lambda, phi, and delta nodes are
+ *   Bottom.
+ *
+ * Every value is lowered at most twice and each lowering only revisits the users of the value. The analysis is
+ * therefore linear in the size of the graph.
+ *
+ * Afterwards, all users of outputs and arguments that are proven constant are diverted to new constant nodes, and the
+ * gamma nodes with constant predicates are reduced to the selected subregion using the predicate reduction of the
+ * gamma normal form.
+ */
+class SparseConditionalConstantPropagation final : public optimization {
+public:
+  ~SparseConditionalConstantPropagation() override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+};
+
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_STOREFORWARDING_HPP
+#define JLM_OPT_STOREFORWARDING_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+namespace jlm {
+
+class RvsdgModule;
+class StatisticsDescriptor;
+
+/** \brief Store Forwarding
+ *
+ * Store Forwarding forwards stored values to loads and removes dead stores. In contrast to the load and store
+ * reductions of the normal forms, which only match adjacent nodes, the optimization walks the memory state chains of
+ * loads and stores across other loads and stores that provably access different memory, as well as through gamma
+ * entry and exit variables and theta loop variables. The walk never leaves a lambda.
+ *
+ * It is most effective after a memory state encoding, such as AASteensgaardBasic, as the encoding only threads the
+ * states of memory locations that an operation might access through it.
+ *
+ * ### Store-to-Load Forwarding
+ * The states of a load are traced upwards until a store is found that might write to the load's address. If all states
+ * lead to the same store, the store writes to the same address, and stores a value of the loaded type, then the users
+ * of the loaded value are diverted to the stored value and the load is removed. The stored value is routed into
+ * nested gamma and theta nodes if necessary.
+ *
+ * ### Dead Store Elimination
+ * A store is removed if all its states lead to a store to the same address without a load of the address in between,
+ * i.e., the store is overwritten. Stores to an alloca are removed if the alloca's address is neither loaded from nor
+ * escapes, i.e., the stored values are never read before the end of the lambda.
+ */
+class StoreForwarding final : public optimization {
+public:
+  ~StoreForwarding() override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    const StatisticsDescriptor & statisticsDescriptor) override;
+};
+
+}
+
+#endif
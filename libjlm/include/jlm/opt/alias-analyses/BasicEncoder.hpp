@@ -70,6 +70,9 @@ private:
   void
   EncodeMemcpy(const jive::simple_node &memcpyNode) override;
 
+  void
+  EncodeMemset(const jive::simple_node & memsetNode) override;
+
   void
   Encode(const lambda::node &lambda) override;
 
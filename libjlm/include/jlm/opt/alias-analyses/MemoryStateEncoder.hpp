@@ -68,6 +68,9 @@ public:
 	virtual void
 	EncodeMemcpy(const jive::simple_node & node) = 0;
 
+	virtual void
+	EncodeMemset(const jive::simple_node & node) = 0;
+
 	virtual void
 	Encode(const lambda::node & lambda) = 0;
 
@@ -9,6 +9,8 @@
 #include <jlm/opt/alias-analyses/AliasAnalysis.hpp>
 #include <jlm/util/disjointset.hpp>
 
+#include <jive/rvsdg/side-table.hpp>
+
 #include <string>
 
 namespace jive {
@@ -167,7 +169,7 @@ private:
 
 	DisjointLocationSet DisjointLocationSet_;
 	std::vector<std::unique_ptr<Location>> Locations_;
-	std::unordered_map<const jive::output*, RegisterLocation*> LocationMap_;
+	jive::OutputMap<RegisterLocation*> LocationMap_;
 };
 
 /** \brief Steensgaard alias analysis
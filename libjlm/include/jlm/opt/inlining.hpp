@@ -16,19 +16,58 @@ class StatisticsDescriptor;
 
 /**
 * \brief Function Inlining
+*
+* Visits the strongly connected components of the call graph bottom-up and inlines direct calls
+* of non-recursive functions. The last call of a function that is neither exported nor escapes
+* is always inlined. Any other call is inlined if the size of the callee, reduced by the benefit
+* of the call site, does not exceed the threshold, and the module has not yet grown beyond its
+* growth budget.
 */
 class fctinline final : public optimization {
 public:
 	virtual
 	~fctinline();
 
+	/**
+	* @param threshold The maximal cost of a call site in number of nodes.
+	* @param growth The maximal growth of the module in percent of its number of nodes.
+	*/
+	explicit
+	fctinline(size_t threshold = 40, size_t growth = 20)
+	: threshold_(threshold)
+	, growth_(growth)
+	{}
+
+	size_t
+	threshold() const noexcept
+	{
+		return threshold_;
+	}
+
+	size_t
+	growth() const noexcept
+	{
+		return growth_;
+	}
+
 	virtual void
 	run(RvsdgModule & module, const StatisticsDescriptor & sd) override;
+
+private:
+	size_t threshold_;
+	size_t growth_;
 };
 
 jive::output *
 find_producer(jive::input * input);
 
+/**
+* Routes \p output into \p region by adding entry variables, loop variables, and context
+* variables to all structural nodes between the region of \p output and \p region.
+*/
+jive::output *
+route_to_region(jive::output * output, jive::region * region);
+
 void
 inlineCall(jive::simple_node * call, const lambda::node * lambda);
 
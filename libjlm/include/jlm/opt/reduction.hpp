@@ -15,14 +15,28 @@ class StatisticsDescriptor;
 
 /**
 * \brief Node Reduction Optimization
+*
+* If the ReduceNodes statistics are printed, then the reduction also reports the number of attempted and applied
+* rewrites of every rule of the normal forms, and optionally their time.
 */
 class nodereduction final : public optimization {
 public:
 	virtual
 	~nodereduction();
 
+  /**
+   * @param timeRewrites Measure the time of every rewrite rule in the ReduceNodes statistics.
+   */
+  explicit
+  nodereduction(bool timeRewrites = false)
+    : TimeRewrites_(timeRewrites)
+  {}
+
 	virtual void
 	run(RvsdgModule & module, const StatisticsDescriptor & sd) override;
+
+private:
+  bool TimeRewrites_;
 };
 
 }
@@ -32,6 +32,24 @@ public:
 	constexpr
 	loopunroll(size_t factor)
 	: factor_(factor)
+	, budget_(0)
+	{}
+
+	/**
+	* Creates a loop unrolling that decides for every loop individually how it is unrolled, such
+	* that the unrolled loop body does not exceed \p budget nodes. Loops with a known number of
+	* iterations are completely unrolled if the budget permits, and otherwise unrolled by the
+	* largest factor that divides the number of iterations. Loops that contain calls are not
+	* unrolled, and outer loops are only considered once all their inner loops are completely
+	* unrolled.
+	*
+	* \param factor The maximal unroll factor for loops that are not completely unrolled.
+	* \param budget The maximal number of nodes of an unrolled loop body.
+	*/
+	constexpr
+	loopunroll(size_t factor, size_t budget)
+	: factor_(factor)
+	, budget_(budget)
 	{}
 
 	/**
@@ -45,8 +63,25 @@ public:
 	virtual void
 	run(RvsdgModule & module, const StatisticsDescriptor & sd) override;
 
+	size_t
+	factor() const noexcept
+	{
+		return factor_;
+	}
+
+	/**
+	* \return The node budget of unrolled loop bodies, or zero if all innermost loops are unrolled
+	* by factor().
+	*/
+	size_t
+	budget() const noexcept
+	{
+		return budget_;
+	}
+
 private:
 	size_t factor_;
+	size_t budget_;
 };
 
 
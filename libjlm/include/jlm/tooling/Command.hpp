@@ -10,6 +10,7 @@
 #include <jlm/util/file.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace jlm {
@@ -341,24 +342,42 @@ public:
     AASteensgaardBasic,
     CommonNodeElimination,
     DeadNodeElimination,
+    FunctionAttributeInference,
     FunctionInlining,
+    FunctionSpecialization,
     InvariantValueRedirection,
+    LoopIdiomRecognition,
+    LoopStrengthReduction,
     LoopUnrolling,
     NodePullIn,
     NodePushOut,
     NodeReduction,
+    SlpVectorizer,
+    SparseConditionalConstantPropagation,
+    StoreForwarding,
     ThetaGammaInversion
   };
 
   ~JlmOptCommand() override;
 
+  /**
+   * The inlining threshold and growth budget are passed to jlm-opt if they are specified, otherwise
+   * jlm-opt uses its defaults. If a server socket is specified, then the command is sent to the jlm-opt server
+   * listening on the socket (see JlmOptServer). A new jlm-opt process is only started if no server is listening.
+   */
   JlmOptCommand(
     filepath inputFile,
     filepath outputFile,
-    std::vector<Optimization> optimizations)
+    std::vector<Optimization> optimizations,
+    std::optional<size_t> inliningThreshold = std::nullopt,
+    std::optional<size_t> inliningGrowth = std::nullopt,
+    std::optional<filepath> serverSocket = std::nullopt)
     : InputFile_(std::move(inputFile))
     , OutputFile_(std::move(outputFile))
     , Optimizations_(std::move(optimizations))
+    , InliningThreshold_(inliningThreshold)
+    , InliningGrowth_(inliningGrowth)
+    , ServerSocket_(std::move(serverSocket))
   {}
 
   [[nodiscard]] std::string
@@ -372,19 +391,34 @@ public:
     CommandGraph & commandGraph,
     const filepath & inputFile,
     const filepath & outputFile,
-    const std::vector<Optimization> & optimizations)
+    const std::vector<Optimization> & optimizations,
+    std::optional<size_t> inliningThreshold = std::nullopt,
+    std::optional<size_t> inliningGrowth = std::nullopt,
+    const std::optional<filepath> & serverSocket = std::nullopt)
   {
-    std::unique_ptr<JlmOptCommand> command(new JlmOptCommand(inputFile, outputFile, optimizations));
+    std::unique_ptr<JlmOptCommand> command(new JlmOptCommand(
+      inputFile,
+      outputFile,
+      optimizations,
+      inliningThreshold,
+      inliningGrowth,
+      serverSocket));
     return CommandGraph::Node::Create(commandGraph, std::move(command));
   }
 
 private:
+  [[nodiscard]] std::vector<std::string>
+  GetArguments() const;
+
   static std::string
   ToString(const Optimization & optimization);
 
   filepath InputFile_;
   filepath OutputFile_;
   std::vector<Optimization> Optimizations_;
+  std::optional<size_t> InliningThreshold_;
+  std::optional<size_t> InliningGrowth_;
+  std::optional<filepath> ServerSocket_;
 };
 
 /**
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_TOOLING_JLMOPTSERVER_HPP
+#define JLM_TOOLING_JLMOPTSERVER_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace jlm {
+
+/** \brief Resident jlm-opt server
+ *
+ * The server keeps jlm-opt resident and listens on a Unix domain socket for requests. A request consists of the
+ * command line arguments of a jlm-opt invocation, the working directory of the client, and the standard input,
+ * output, and error file descriptors of the client. The server answers a request with the exit status of the
+ * invocation, such that a request behaves like running jlm-opt as a separate process, but without paying for
+ * process startup, dynamic linking, and static initialization.
+ *
+ * Every request is run in a process forked from the server. The RVSDG and the normal forms are not thread-safe,
+ * and forking isolates requests from each other and from the server, while the forked process starts from the
+ * already initialized state of the server. Requests are handled concurrently.
+ *
+ * Requests run with the privileges of the server. The socket is therefore only accessible by the user of the server,
+ * and connections from processes of other users are rejected.
+ */
+class JlmOptServer final {
+public:
+  /**
+   * A request handler receives the command line arguments of a request and returns its exit status.
+   */
+  using Handler = std::function<int(int argc, char ** argv)>;
+
+  /**
+   * @param socket The path of the Unix domain socket.
+   */
+  explicit
+  JlmOptServer(filepath socket)
+    : Socket_(std::move(socket))
+  {}
+
+  /**
+   * Listens on the socket and invokes \p handler for every request. A stale socket from a previous server is
+   * removed. The function only returns if the socket cannot be created or connections cannot be accepted, and the
+   * socket is removed when the server is terminated with SIGINT or SIGTERM.
+   *
+   * @return EXIT_FAILURE if the socket cannot be created or connections cannot be accepted.
+   */
+  int
+  Run(const Handler & handler) const;
+
+  /**
+   * Sends a request with the command line \p arguments to the server listening on \p socket. The standard input,
+   * output, and error of the calling process and its working directory are passed along.
+   *
+   * @return The exit status of the request, or std::nullopt if no server is listening on \p socket.
+   */
+  static std::optional<int>
+  SendRequest(
+    const filepath & socket,
+    const std::vector<std::string> & arguments);
+
+private:
+  filepath Socket_;
+};
+
+}
+
+#endif
@@ -21,12 +21,19 @@ public:
     Annotation,
     BasicEncoderEncoding,
     CommonNodeElimination,
+    CompilationBudget,
     ControlFlowRecovery,
     DataNodeToDelta,
     DeadNodeElimination,
+    FirrtlGeneration,
+    FunctionAttributeInference,
+    FunctionCache,
     FunctionInlining,
+    FunctionSpecialization,
     InvariantValueRedirection,
     JlmToRvsdgConversion,
+    LoopIdiomRecognition,
+    LoopStrengthReduction,
     LoopUnrolling,
     PullNodes,
     PushNodes,
@@ -34,8 +41,11 @@ public:
     RvsdgConstruction,
     RvsdgDestruction,
     RvsdgOptimization,
+    SlpVectorizer,
+    SparseConditionalConstantPropagation,
     SteensgaardAnalysis,
     SteensgaardPointsToGraphConstruction,
+    StoreForwarding,
     ThetaGammaInversion
   };
 
@@ -113,6 +113,22 @@ jlm::hls::BaseHLS::create_node_names(jive::region *r) {
 	}
 }
 
+void
+jlm::hls::BaseHLS::collect_simple_nodes(jive::region *r, std::vector<jive::node *> &nodes) {
+	for (auto &node : r->nodes) {
+		if (dynamic_cast<jive::simple_node *>(&node)) {
+			nodes.push_back(&node);
+		} else if (auto oln = dynamic_cast<jlm::hls::loop_node *>(&node)) {
+			collect_simple_nodes(oln->subregion(), nodes);
+		}
+	}
+}
+
+std::string
+jlm::hls::BaseHLS::get_perf_counter_name(const jive::node *node, const std::string &counter) {
+	return "perf_" + get_node_name(node) + "_" + counter;
+}
+
 const jlm::lambda::node *
 jlm::hls::BaseHLS::get_hls_lambda(jlm::RvsdgModule &rm) {
 	auto region = rm.Rvsdg().root();
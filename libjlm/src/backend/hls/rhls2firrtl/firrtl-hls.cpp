@@ -20,8 +20,8 @@ jlm::hls::FirrtlHLS::get_text(jlm::RvsdgModule &rm) {
 	std::ostringstream firrtl;
 	auto module = lambda_node_to_firrtl(get_hls_lambda(rm));
 	firrtl << indent(0) << "circuit " << module.name << ":\n";
-	for (auto module: modules) {
-		firrtl << module.second.firrtl;
+	for (const auto &module: modules) {
+		firrtl << module.firrtl;
 	}
 	return firrtl.str();
 }
@@ -55,19 +55,69 @@ jlm::hls::FirrtlHLS::mux_mem(const std::vector<std::string> &mem_nodes) const {
 		mem << indent(2) << node_name << ".mem_req.ready <= " << UInt(1, 0) << "\n";
 		mem << indent(2) << "when and(not(" << previous_granted << ")," << node_name
 			<< ".mem_req.valid):\n";
-		mem << indent(3) << node_name << ".mem_req.ready <= " << UInt(1, 1) << "\n";
+		mem << indent(3) << node_name << ".mem_req.ready <= mem_req.ready\n";
 		mem << indent(3) << "mem_req.addr <= " << node_name << ".mem_req.addr\n";
 		mem << indent(3) << "mem_req.write <= " << node_name << ".mem_req.write\n";
 		mem << indent(3) << "mem_req.valid <= " << UInt(1, 1) << "\n";
 		mem << indent(3) << "mem_req.data <= " << node_name << ".mem_req.data\n";
 		mem << indent(3) << "mem_req.width <= " << node_name << ".mem_req.width\n";
 		mem << indent(2) << "node previous_granted_" << node_name << " = or(" << previous_granted << ", "
-			<< node_name << ".mem_req.ready)\n";
+			<< node_name << ".mem_req.valid)\n";
 		previous_granted = "previous_granted_" + node_name;
 	}
 	return mem.str();
 }
 
+std::string
+jlm::hls::FirrtlHLS::perf_io(jive::region *sr) {
+	std::ostringstream io;
+	if (!instrument) {
+		return io.str();
+	}
+	std::vector<jive::node *> nodes;
+	collect_simple_nodes(sr, nodes);
+	for (auto node : nodes) {
+		io << indent(2) << "output " << get_perf_counter_name(node, "backpressure") << ": UInt<64>\n";
+		io << indent(2) << "output " << get_perf_counter_name(node, "starvation") << ": UInt<64>\n";
+	}
+	return io.str();
+}
+
+std::string
+jlm::hls::FirrtlHLS::perf_counters(jive::region *sr) {
+	std::ostringstream perf;
+	if (!instrument) {
+		return perf.str();
+	}
+	perf << indent(2) << "; performance counters\n";
+	std::vector<jive::node *> nodes;
+	collect_simple_nodes(sr, nodes);
+	for (auto node : nodes) {
+		auto inst_name = get_node_name(node);
+		// valid without ready on any output
+		std::string backpressure = UInt(1, 0);
+		for (size_t i = 0; i < node->noutputs(); ++i) {
+			auto port = inst_name + "." + get_port_name(node->output(i));
+			backpressure = "or(" + backpressure + ", and(" + port + ".valid, not(" + port + ".ready)))";
+		}
+		// ready without valid on any input
+		std::string starvation = UInt(1, 0);
+		for (size_t i = 0; i < node->ninputs(); ++i) {
+			auto port = inst_name + "." + get_port_name(node->input(i));
+			starvation = "or(" + starvation + ", and(" + port + ".ready, not(" + port + ".valid)))";
+		}
+		for (auto counter : {std::make_pair("backpressure", backpressure), std::make_pair("starvation", starvation)}) {
+			auto name = get_perf_counter_name(node, counter.first);
+			perf << indent(2) << "reg " << name << "_reg: UInt<64>, clk with: (reset => (reset, " << UInt(64, 0)
+				 << "))\n";
+			perf << indent(2) << "when " << counter.second << ":\n";
+			perf << indent(3) << name << "_reg <= tail(add(" << name << "_reg, " << UInt(64, 1) << "), 1)\n";
+			perf << indent(2) << name << " <= " << name << "_reg\n";
+		}
+	}
+	return perf.str();
+}
+
 std::string
 jlm::hls::FirrtlHLS::module_header(const jive::node *node, bool has_mem_io) {
 	std::ostringstream module;
@@ -172,8 +222,7 @@ jlm::hls::FirrtlHLS::mem_node_to_firrtl(const jive::simple_node *n) {
 		module << indent(3) << "o" << i << "_valid_reg <= " << UInt(1, 0) << "\n";
 	}
 
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), true});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), true});
 }
 
 jlm::hls::FirrtlModule &
@@ -197,8 +246,7 @@ jlm::hls::FirrtlHLS::pred_buffer_to_firrtl(const jive::simple_node *n) {
 	module << indent(3) << "buf_data_reg <= " << data(i0) << "\n";
 	module << indent(2) << "when " << fire(o0) << ":\n";
 	module << indent(3) << "buf_valid_reg <= " << UInt(1, 0) << "\n";
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -259,8 +307,7 @@ jlm::hls::FirrtlHLS::buffer_to_firrtl(const jive::simple_node *n) {
 		module << indent(4) << "buf" << i << "_data_reg <= " << data(i0) << "\n";
 
 	}
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -287,8 +334,7 @@ jlm::hls::FirrtlHLS::ndmux_to_firrtl(const jive::simple_node *n) {
 		module << indent(3) << ready(in) << " <= " << ready(o0) << "\n";
 		module << indent(3) << ready(ipred) << " <= and(" << ready(o0) << "," << valid(in) << ")\n";
 	}
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -342,8 +388,7 @@ jlm::hls::FirrtlHLS::dmux_to_firrtl(const jive::simple_node *n) {
 	}
 	module << indent(2) << "when " << fire(o0) << ":\n";
 	module << indent(3) << "processed_reg <= " << UInt(1, 0) << "\n";
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -364,8 +409,7 @@ jlm::hls::FirrtlHLS::merge_to_firrtl(const jive::simple_node *n) {
 		module << indent(3) << valid(o0) << " <= " << valid(in) << "\n";
 		module << indent(3) << data(o0) << " <= " << data(in) << "\n";
 	}
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -400,8 +444,7 @@ jlm::hls::FirrtlHLS::fork_to_firrtl(const jive::simple_node *n) {
 	for (size_t i = 0; i < n->noutputs(); ++i) {
 		module << indent(3) << "out" << i << "_fired <= " << UInt(1, 0) << "\n";
 	}
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -412,8 +455,7 @@ jlm::hls::FirrtlHLS::sink_to_firrtl(const jive::simple_node *n) {
 	auto i0 = n->input(0);
 	module << indent(2) << ready(i0) << " <= " << UInt(1, 1) << "\n";
 
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 
@@ -437,8 +479,7 @@ jlm::hls::FirrtlHLS::print_to_firrtl(const jive::simple_node *n) {
 		   << ", 64))\n";
 
 
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -463,8 +504,7 @@ jlm::hls::FirrtlHLS::branch_to_firrtl(const jive::simple_node *n) {
 		module << indent(3) << valid(out) << " <= " << valid(ival) << "\n";
 		module << indent(3) << data(out) << " <= " << data(ival) << "\n";
 	}
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule &
@@ -481,8 +521,7 @@ jlm::hls::FirrtlHLS::trigger_to_firrtl(const jive::simple_node *n) {
 	module << indent(2) << ready(ival) << " <= and(" << ready(out) << "," << valid(itrig) << ")\n";
 	module << indent(2) << valid(out) << " <= and(" << valid(ival) << "," << valid(itrig) << ")\n";
 	module << indent(2) << data(out) << " <= " << data(ival) << "\n";
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 
@@ -604,6 +643,9 @@ jlm::hls::FirrtlHLS::simple_op_to_firrtl(const jive::simple_node *n) {
 		return jive::detail::strfmt("UInt<", value.nbits(), ">(", value.to_uint(), ")");
 	} else if (dynamic_cast<const jlm::UndefValueOperation *>(&(n->operation()))) {
 		return UInt(1, 0);  // TODO: Fix?
+	} else if (dynamic_cast<const jlm::MemStateMergeOperator *>(&(n->operation()))) {
+		// join of memory states, the handshaking waits for all of them
+		return data(n->input(0));
 	} else if (auto o = dynamic_cast<const jive::ctlconstant_op *>(&(n->operation()))) {
 		return UInt(ceil(log2(o->value().nalternatives())), o->value().alternative());
 	} else if (dynamic_cast<const jlm::getelementptr_op *>(&(n->operation()))) {
@@ -644,17 +686,15 @@ jlm::hls::FirrtlHLS::single_out_simple_node_to_firrtl(const jive::simple_node *n
 		module << indent(2) + ready(n->input(i)) + "<= and(" << ready(n->output(0)) << ", inputs_valid)\n";
 	}
 
-	modules.emplace_back(&n->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	return add_module(n, FirrtlModule{module_name, module.str(), false});
 }
 
 jlm::hls::FirrtlModule
 jlm::hls::FirrtlHLS::node_to_firrtl(const jive::node *node, const int depth) {
-	// check if module for operation was already generated
-	for (auto pair: modules) {
-		if(pair.first != nullptr && *pair.first == node->operation()) {
-			return pair.second;
-		}
+	// check if a structurally identical module was already generated
+	auto it = module_index.find(get_module_signature(node));
+	if (it != module_index.end()) {
+		return modules[it->second];
 	}
 	if (auto n = dynamic_cast<const jive::simple_node *>(node)) {
 		if (dynamic_cast<const jlm::LoadOperation *>(&(n->operation()))) {
@@ -778,6 +818,7 @@ jlm::hls::FirrtlHLS::subregion_to_firrtl(jive::region *sr) {
 			   to_firrtl_type(&sr->result(i)->type()) << "}\n";
 	}
 	module << mem_io();
+	module << perf_io(sr);
 	module << indent(2) << "; instances\n";
 	for (size_t i = 0; i < sr->narguments(); ++i) {
 		output_map[sr->argument(i)] = get_port_name(sr->argument(i));
@@ -810,9 +851,10 @@ jlm::hls::FirrtlHLS::subregion_to_firrtl(jive::region *sr) {
 	}
 
 	module << mux_mem(mem_nodes);
+	module << perf_counters(sr);
 
-	modules.emplace_back(nullptr, FirrtlModule{module_name, module.str(), true});
-	return modules.back().second;
+	modules.emplace_back(module_name, module.str(), true);
+	return modules.back();
 }
 
 jlm::hls::FirrtlModule
@@ -839,6 +881,7 @@ jlm::hls::FirrtlHLS::lambda_node_to_firrtl(const jlm::lambda::node *ln) {
 	}
 	module << "}\n";
 	module << mem_io();
+	module << perf_io(sr);
 	// registers
 	module << indent(2) << "; registers" << "\n";
 	for (size_t i = 0; i < sr->narguments(); ++i) {
@@ -906,8 +949,41 @@ jlm::hls::FirrtlHLS::lambda_node_to_firrtl(const jlm::lambda::node *ln) {
 	}
 
 	module << mux_mem({"sr",});
-	modules.emplace_back(&ln->operation(), FirrtlModule{module_name, module.str(), false});
-	return modules.back().second;
+	if (instrument) {
+		std::vector<jive::node *> nodes;
+		collect_simple_nodes(sr, nodes);
+		for (auto node : nodes) {
+			for (auto counter : {"backpressure", "starvation"}) {
+				auto name = get_perf_counter_name(node, counter);
+				module << indent(2) << name << " <= sr." << name << "\n";
+			}
+		}
+	}
+	modules.emplace_back(module_name, module.str(), false);
+	return modules.back();
+}
+
+std::string
+jlm::hls::FirrtlHLS::get_module_signature(const jive::node *node) {
+	// the generated module only depends on the operation and the widths of its ports
+	auto signature = node->operation().debug_string();
+	for (size_t i = 0; i < node->ninputs(); ++i) {
+		signature += jive::detail::strfmt("_I", jlm_sizeof(&node->input(i)->type()));
+	}
+	for (size_t i = 0; i < node->noutputs(); ++i) {
+		signature += jive::detail::strfmt("_O", jlm_sizeof(&node->output(i)->type()));
+	}
+	if (auto o = dynamic_cast<const jlm::getelementptr_op *>(&node->operation())) {
+		signature += "_" + o->pointee_type().debug_string();
+	}
+	return signature;
+}
+
+jlm::hls::FirrtlModule &
+jlm::hls::FirrtlHLS::add_module(const jive::node *node, FirrtlModule module) {
+	module_index[get_module_signature(node)] = modules.size();
+	modules.push_back(std::move(module));
+	return modules.back();
 }
 
 std::string
@@ -239,6 +239,9 @@ jlm::hls::MLIRGenImpl::MlirGenSimpleNode(const jive::simple_node *node) {
 		Connect(body, outData, AddBitsOp(body, asUInt, 63, 0));
 	} else if (dynamic_cast<const jlm::UndefValueOperation *>(&(node->operation()))) {
 		Connect(body, outData, GetConstant(body, 1, 0));
+	} else if (dynamic_cast<const jlm::MemStateMergeOperator *>(&(node->operation()))) {
+		// join of memory states, the handshaking waits for all of them
+		Connect(body, outData, GetSubfield(body, inBundles[0], "data"));
 	} else {
 		throw std::logic_error("Simple node " + node->operation().debug_string() + " not implemented!");
 	}
@@ -1665,6 +1668,7 @@ jlm::hls::MLIRGenImpl::MlirGen(const jlm::lambda::node *lambdaNode) {
 	auto memResData  = GetSubfield(body, memResBundle, "data");
 
 	auto memReqBundle = body->getArgument(args-2);
+	auto memReqReady = GetSubfield(body, memReqBundle, "ready");
 	auto memReqValid = GetSubfield(body, memReqBundle, "valid");
 	auto memReqAddr  = GetSubfield(body, memReqBundle, "addr");
 	auto memReqData  = GetSubfield(body, memReqBundle, "data");
@@ -1693,7 +1697,8 @@ jlm::hls::MLIRGenImpl::MlirGen(const jlm::lambda::node *lambdaNode) {
 	// getThenBlock() cause an error during commpilation
 	// So we first get the builder and then its associated body
 	thenBody = whenOp.getThenBodyBuilder().getBlock();
-	Connect(thenBody, srMemReqReady, oneBitValue);
+	// The harness may model memory latency by deasserting ready
+	Connect(thenBody, srMemReqReady, memReqReady);
 	Connect(thenBody, memReqValid, oneBitValue);
 	Connect(thenBody, memReqAddr, srMemReqAddr);
 	Connect(thenBody, memReqData, srMemReqData);
@@ -6,6 +6,8 @@
 #include <jlm/ir/operators/delta.hpp>
 #include "jlm/backend/hls/rhls2firrtl/verilator-harness-hls.hpp"
 
+#include <iomanip>
+
 std::string
 jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 	std::ostringstream cpp;
@@ -37,6 +39,10 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"#include \"V" << file_name << ".h\"\n" <<
 		"#define V_NAME V" << file_name << "\n" <<
 		"#define TIMEOUT 10000000\n"
+		"// cycles from accepting a memory request to its response, overridden by HLS_MEM_LATENCY\n"
+		"#ifndef MEM_LATENCY\n"
+		"#define MEM_LATENCY 1\n"
+		"#endif\n"
 		"#define xstr(s) str(s)\n"
 		"#define str(s) #s\n"
 		"void clock_cycle();\n"
@@ -55,6 +61,15 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"#endif\n"
 		"bool terminate = false;\n"
 		"\n"
+		"// memory latency model and performance counters\n"
+		"uint64_t mem_latency = MEM_LATENCY;\n"
+		"uint64_t mem_wait = 0;\n"
+		"uint64_t perf_cycles = 0;\n"
+		"uint64_t perf_mem_reads = 0;\n"
+		"uint64_t perf_mem_writes = 0;\n"
+		"uint64_t perf_mem_stalls = 0;\n"
+		"void perf_report();\n"
+		"\n"
 		"void term(int signum) {\n"
 		"    terminate = true;\n"
 		"}\n"
@@ -63,6 +78,7 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"    // Final model cleanup\n"
 		"    tfp->dump(main_time * 2);\n"
 		"    top->final();\n"
+		"    perf_report();\n"
 		"\n"
 		"    //  Coverage analysis (since test passed)\n"
 		"#if VM_COVERAGE\n"
@@ -86,6 +102,11 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"\n"
 		"	atexit(verilator_finish);\n"
 		"\n"
+		"    if (getenv(\"HLS_MEM_LATENCY\")) {\n"
+		"        mem_latency = strtoull(getenv(\"HLS_MEM_LATENCY\"), NULL, 10);\n"
+		"    }\n"
+		"    assert(mem_latency > 0);\n"
+		"\n"
 		"    // Set debug level, 0 is off, 9 is highest presently used\n"
 		"    // May be overridden by commandArgs\n"
 		"    Verilated::debug(0);\n"
@@ -146,8 +167,27 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"    top->mem_res_data = mem_resp_data;\n"
 		"    // dump before trying to access memory\n"
         "    tfp->dump(main_time * 2);\n"
-		"    if (!top->reset && top->mem_req_valid) {\n"
+		"    if (!top->reset) {\n"
+		"        perf_cycles++;\n"
+		"    }\n"
+		"    // a response becomes valid mem_latency cycles after its request was accepted. The circuit\n"
+		"    // broadcasts responses to all memory operations, so only one request can be outstanding.\n"
+		"    mem_resp_valid = false;\n"
+		"    if (mem_wait && --mem_wait == 0) {\n"
 		"        mem_resp_valid = true;\n"
+		"    }\n"
+		"    top->mem_req_ready = !mem_wait && !mem_resp_valid;\n"
+		"    if (!top->reset && top->mem_req_valid && !top->mem_req_ready) {\n"
+		"        perf_mem_stalls++;\n"
+		"    }\n"
+		"    if (!top->reset && top->mem_req_valid && top->mem_req_ready) {\n"
+		"        mem_wait = mem_latency - 1;\n"
+		"        mem_resp_valid = mem_wait == 0;\n"
+		"        if (top->mem_req_write) {\n"
+		"            perf_mem_writes++;\n"
+		"        } else {\n"
+		"            perf_mem_reads++;\n"
+		"        }\n"
 		"        void *addr = (void *) top->mem_req_addr;\n"
 		"        uint64_t data = top->mem_req_data;\n"
 		"        if (top->mem_req_write) {\n"
@@ -191,8 +231,6 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"            default:\n"
 		"                assert(false);\n"
 		"        }\n"
-		"    } else {\n"
-		"        mem_resp_valid = false;\n"
 		"    }\n"
 		"    assert(!Verilated::gotFinish());\n"
 		"    top->clk = 0;\n"
@@ -200,6 +238,7 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 		"    tfp->dump(main_time * 2 + 1);\n"
 		"    main_time++;\n"
 		"}\n"
+		"\n" << perf_report(ln) <<
 		"extern \"C\"\n"// TODO: parameter for linkage type here
 		"{\n";
 	// imports
@@ -296,6 +335,55 @@ jlm::hls::VerilatorHarnessHLS::get_text(jlm::RvsdgModule &rm) {
 	return cpp.str();
 }
 
+std::string
+jlm::hls::VerilatorHarnessHLS::perf_report(const jlm::lambda::node *ln) {
+	std::ostringstream cpp;
+	cpp <<
+		"void perf_report() {\n"
+		"    const char *path = getenv(\"HLS_PERF_REPORT\");\n"
+		"    FILE *report = fopen(path ? path : xstr(V_NAME)\".perf\", \"w\");\n"
+		"    if (!report) {\n"
+		"        return;\n"
+		"    }\n"
+		"    fprintf(report, \"mem_latency %lu\\n\", (unsigned long) mem_latency);\n"
+		"    fprintf(report, \"cycles %lu\\n\", (unsigned long) perf_cycles);\n"
+		"    fprintf(report, \"mem_reads %lu\\n\", (unsigned long) perf_mem_reads);\n"
+		"    fprintf(report, \"mem_writes %lu\\n\", (unsigned long) perf_mem_writes);\n"
+		"    fprintf(report, \"mem_stalls %lu\\n\", (unsigned long) perf_mem_stalls);\n";
+	if (instrument) {
+		// node name, RVSDG operation, cycles with valid but not ready outputs, cycles with ready but not valid inputs
+		std::vector<jive::node *> nodes;
+		collect_simple_nodes(ln->subregion(), nodes);
+		for (auto node : nodes) {
+			auto name = get_node_name(node) + " " + node->operation().debug_string();
+			cpp << "    fprintf(report, \"%s backpressure %lu starvation %lu\\n\", \""
+				<< escape_c_string(name) << "\", (unsigned long) top->"
+				<< get_perf_counter_name(node, "backpressure") << ", (unsigned long) top->"
+				<< get_perf_counter_name(node, "starvation") << ");\n";
+		}
+	}
+	cpp <<
+		"    fclose(report);\n"
+		"}\n";
+	return cpp.str();
+}
+
+std::string
+jlm::hls::VerilatorHarnessHLS::escape_c_string(const std::string &s) {
+	std::ostringstream escaped;
+	for (unsigned char c : s) {
+		if (c == '"' || c == '\\') {
+			escaped << '\\' << c;
+		} else if (c < 0x20 || c >= 0x7f) {
+			// three octal digits, such that a following digit is not taken as part of the escape
+			escaped << '\\' << std::oct << std::setw(3) << std::setfill('0') << (unsigned) c << std::dec;
+		} else {
+			escaped << c;
+		}
+	}
+	return escaped.str();
+}
+
 std::string
 jlm::hls::VerilatorHarnessHLS::convert_to_c_type(const jive::type *type) {
 	if (auto t = dynamic_cast<const jive::bittype *>(type)) {
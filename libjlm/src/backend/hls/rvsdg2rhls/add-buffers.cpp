@@ -4,10 +4,16 @@
  */
 
 #include <jlm/ir/hls/hls.hpp>
+#include <jlm/ir/operators/load.hpp>
+#include <jlm/ir/operators/store.hpp>
 #include <jive/rvsdg/traverser.hpp>
 #include <jlm/backend/hls/rvsdg2rhls/rvsdg2rhls.hpp>
 #include "jlm/backend/hls/rvsdg2rhls/add-buffers.hpp"
 
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
 void
 jlm::hls::add_buffers(jive::region *region, bool pass_through) {
 	for (auto &node : jive::topdown_traverser(region)) {
@@ -53,3 +59,203 @@ jlm::hls::add_buffers(jlm::RvsdgModule &rm, bool pass_through) {
 	auto root = graph.root();
 	add_buffers(root, pass_through);
 }
+
+static inline bool
+is_memory_node(const jive::node *node) {
+	return jive::is<jlm::LoadOperation>(node) || jive::is<jlm::StoreOperation>(node);
+}
+
+size_t
+jlm::hls::node_latency(const jive::node *node) {
+	if (auto buf = dynamic_cast<const hls::buffer_op *>(&node->operation())) {
+		return buf->pass_through ? 0 : 1;
+	} else if (is_memory_node(node)) {
+		// registered request followed by a registered response
+		return 2;
+	} else if (auto loop = dynamic_cast<const hls::loop_node *>(node)) {
+		// the trip count is unknown, so a single iteration is a lower bound
+		return estimate_ii(loop);
+	}
+	return 0;
+}
+
+/*
+ * Longest latency from the region arguments to every reachable output. If source is set, only
+ * paths starting at this argument are considered.
+ */
+static std::unordered_map<const jive::output *, size_t>
+longest_paths(jive::region *region, const jive::argument *source = nullptr) {
+	std::unordered_map<const jive::output *, size_t> arrival;
+	for (size_t i = 0; i < region->narguments(); ++i) {
+		auto arg = region->argument(i);
+		if (!source || arg == source) {
+			arrival[arg] = 0;
+		}
+	}
+	for (auto &node : jive::topdown_traverser(region)) {
+		bool reached = node->ninputs() == 0 && !source;
+		size_t latest = 0;
+		for (size_t i = 0; i < node->ninputs(); ++i) {
+			auto it = arrival.find(node->input(i)->origin());
+			if (it != arrival.end()) {
+				reached = true;
+				latest = std::max(latest, it->second);
+			}
+		}
+		if (!reached) {
+			continue;
+		}
+		auto latency = jlm::hls::node_latency(node);
+		for (size_t i = 0; i < node->noutputs(); ++i) {
+			arrival[node->output(i)] = latest + latency;
+		}
+	}
+	return arrival;
+}
+
+size_t
+jlm::hls::estimate_rec_ii(const loop_node *loop) {
+	auto region = loop->subregion();
+	std::vector<backedge_argument *> backedges;
+	for (size_t i = 0; i < region->narguments(); ++i) {
+		if (auto ba = dynamic_cast<backedge_argument *>(region->argument(i))) {
+			backedges.push_back(ba);
+		}
+	}
+
+	// latency[j][k] is the longest path from backedge argument j to backedge result k, or -1
+	auto n = backedges.size();
+	std::vector<std::vector<long>> latency(n, std::vector<long>(n, -1));
+	for (size_t j = 0; j < n; ++j) {
+		auto arrival = longest_paths(region, backedges[j]);
+		for (size_t k = 0; k < n; ++k) {
+			auto it = arrival.find(backedges[k]->result()->origin());
+			if (it != arrival.end()) {
+				latency[j][k] = it->second;
+			}
+		}
+	}
+
+	// Every backedge holds one token, so the II is the maximum cycle mean of the backedge graph
+	// (Karp's algorithm). walk[l][v] is the maximum latency of a walk with l edges ending in v.
+	const long none = std::numeric_limits<long>::min();
+	std::vector<std::vector<long>> walk(n + 1, std::vector<long>(n, none));
+	std::fill(walk[0].begin(), walk[0].end(), 0);
+	for (size_t l = 1; l <= n; ++l) {
+		for (size_t u = 0; u < n; ++u) {
+			if (walk[l - 1][u] == none) {
+				continue;
+			}
+			for (size_t v = 0; v < n; ++v) {
+				if (latency[u][v] >= 0) {
+					walk[l][v] = std::max(walk[l][v], walk[l - 1][u] + latency[u][v]);
+				}
+			}
+		}
+	}
+	double mean = 1;
+	for (size_t v = 0; v < n; ++v) {
+		if (walk[n][v] == none) {
+			continue;
+		}
+		double vmean = std::numeric_limits<double>::max();
+		for (size_t l = 0; l < n; ++l) {
+			if (walk[l][v] != none) {
+				vmean = std::min(vmean, double(walk[n][v] - walk[l][v]) / double(n - l));
+			}
+		}
+		mean = std::max(mean, vmean);
+	}
+	return std::ceil(mean - 1e-9);
+}
+
+size_t
+jlm::hls::estimate_ii(const loop_node *loop) {
+	// all memory operations share one port and each one waits for its response before the next request
+	size_t nmem = 0;
+	for (auto &node : loop->subregion()->nodes) {
+		if (is_memory_node(&node)) {
+			nmem++;
+		}
+	}
+	size_t res_ii = nmem ? std::max(nmem, (size_t) 2) : 1;
+	return std::max(estimate_rec_ii(loop), res_ii);
+}
+
+static void
+insert_buffer(jive::input *input, size_t capacity) {
+	auto origin = input->origin();
+	auto node = jive::node_output::node(origin);
+	auto buf = node ? dynamic_cast<const jlm::hls::buffer_op *>(&node->operation()) : nullptr;
+	if (buf && buf->pass_through && origin->nusers() == 1) {
+		// grow the existing buffer instead of chaining a second one
+		auto merged = jlm::hls::buffer_op::create(*node->input(0)->origin(), buf->capacity + capacity, true)[0];
+		input->divert_to(merged);
+		jive::remove(node);
+		return;
+	}
+	input->divert_to(jlm::hls::buffer_op::create(*origin, capacity, true)[0]);
+}
+
+static size_t
+place_buffers(jive::region *region, size_t target_ii, std::vector<jlm::hls::loop_estimate> &estimates) {
+	// nested regions first, so that the latencies of loop nodes include their buffering
+	for (auto &node : jive::topdown_traverser(region)) {
+		if (auto loop = dynamic_cast<jlm::hls::loop_node *>(node)) {
+			auto slots = place_buffers(loop->subregion(), target_ii, estimates);
+			estimates.push_back({loop, jlm::hls::estimate_ii(loop), slots});
+		} else if (auto structnode = dynamic_cast<jive::structural_node *>(node)) {
+			for (size_t n = 0; n < structnode->nsubregions(); n++) {
+				place_buffers(structnode->subregion(n), target_ii, estimates);
+			}
+		}
+	}
+
+	auto arrival = longest_paths(region);
+	std::vector<jive::node *> nodes;
+	for (auto &node : jive::topdown_traverser(region)) {
+		nodes.push_back(node);
+	}
+
+	size_t slots = 0;
+	for (auto node : nodes) {
+		if (node->ninputs() < 2) {
+			continue;
+		}
+		size_t latest = 0;
+		for (size_t i = 0; i < node->ninputs(); ++i) {
+			latest = std::max(latest, arrival[node->input(i)->origin()]);
+		}
+		for (size_t i = 0; i < node->ninputs(); ++i) {
+			auto origin = node->input(i)->origin();
+			auto onode = jive::node_output::node(origin);
+			if (onode && jlm::hls::is_constant(onode)) {
+				continue;
+			}
+			auto slack = latest - arrival[origin];
+			if (slack == 0) {
+				continue;
+			}
+			// a token arrives every target_ii cycles, so the short path has to hold slack/target_ii of them
+			auto capacity = (slack + target_ii - 1) / target_ii;
+			insert_buffer(node->input(i), capacity);
+			slots += capacity;
+		}
+	}
+	return slots;
+}
+
+std::vector<jlm::hls::loop_estimate>
+jlm::hls::place_buffers(jive::region *region, size_t target_ii) {
+	JLM_ASSERT(target_ii > 0);
+	std::vector<loop_estimate> estimates;
+	::place_buffers(region, target_ii, estimates);
+	return estimates;
+}
+
+std::vector<jlm::hls::loop_estimate>
+jlm::hls::place_buffers(jlm::RvsdgModule &rm, size_t target_ii) {
+	auto &graph = rm.Rvsdg();
+	auto root = graph.root();
+	return place_buffers(root, target_ii);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/load.hpp>
+#include <jive/rvsdg/traverser.hpp>
+#include <jlm/backend/hls/rvsdg2rhls/add-buffers.hpp>
+#include "jlm/backend/hls/rvsdg2rhls/loop-pipelining.hpp"
+
+/*
+ * Origin of the loop variable at the start of an iteration, i.e., the output of the buffer
+ * behind the mux created by loop_node::add_loopvar, or nullptr if the structure differs.
+ */
+static jive::output *
+iteration_start(jlm::hls::backedge_argument *ba) {
+	if (ba->nusers() != 1) {
+		return nullptr;
+	}
+	auto mux = dynamic_cast<jive::node_input *>(*ba->begin());
+	if (!mux || !jive::is<jlm::hls::mux_op>(mux->node()) || mux->node()->output(0)->nusers() != 1) {
+		return nullptr;
+	}
+	auto buf = dynamic_cast<jive::node_input *>(*mux->node()->output(0)->begin());
+	if (!buf || !jive::is<jlm::hls::buffer_op>(buf->node())) {
+		return nullptr;
+	}
+	return buf->node()->output(0);
+}
+
+size_t
+jlm::hls::separate_memory_recurrences(loop_node *loop) {
+	auto sr = loop->subregion();
+	size_t separated = 0;
+	for (size_t i = 0; i < sr->narguments(); ++i) {
+		auto ba = dynamic_cast<backedge_argument *>(sr->argument(i));
+		if (!ba || !dynamic_cast<const jlm::MemoryStateType *>(&ba->type())) {
+			continue;
+		}
+		auto branch = jive::node_output::node(ba->result()->origin());
+		if (!branch || !jive::is<branch_op>(branch)) {
+			continue;
+		}
+		auto start = iteration_start(ba);
+		auto end = branch->input(1)->origin();
+		if (!start || start == end || end->nusers() != 1) {
+			continue;
+		}
+		// the state has to be a single chain of loads from the start to the end of the iteration
+		bool only_loads = true;
+		for (auto state = start; state != end;) {
+			auto user = state->nusers() == 1 ? dynamic_cast<jive::node_input *>(*state->begin()) : nullptr;
+			if (!user || !jive::is<jlm::LoadOperation>(user->node()) || user->index() == 0) {
+				only_loads = false;
+				break;
+			}
+			state = user->node()->output(user->index());
+		}
+		if (!only_loads) {
+			continue;
+		}
+		// the next iteration continues with the state of this one before the loads
+		auto predicate = branch->input(0)->origin();
+		auto bypass = branch_op::create(*predicate, *start, true);
+		ba->result()->divert_to(bypass[1]);
+		// the unused exits of both branches are sunk by add_sinks
+		separated++;
+	}
+	return separated;
+}
+
+static void
+pipeline_loops(jive::region *region, std::vector<jlm::hls::pipeline_estimate> &estimates) {
+	for (auto &node : jive::topdown_traverser(region)) {
+		if (auto loop = dynamic_cast<jlm::hls::loop_node *>(node)) {
+			pipeline_loops(loop->subregion(), estimates);
+			auto initial_ii = jlm::hls::estimate_ii(loop);
+			auto separated = jlm::hls::separate_memory_recurrences(loop);
+			estimates.push_back({loop, initial_ii, jlm::hls::estimate_ii(loop), separated});
+		} else if (auto structnode = dynamic_cast<jive::structural_node *>(node)) {
+			for (size_t n = 0; n < structnode->nsubregions(); n++) {
+				pipeline_loops(structnode->subregion(n), estimates);
+			}
+		}
+	}
+}
+
+std::vector<jlm::hls::pipeline_estimate>
+jlm::hls::pipeline_loops(jive::region *region) {
+	std::vector<pipeline_estimate> estimates;
+	::pipeline_loops(region, estimates);
+	return estimates;
+}
+
+std::vector<jlm::hls::pipeline_estimate>
+jlm::hls::pipeline_loops(jlm::RvsdgModule &rm) {
+	auto &graph = rm.Rvsdg();
+	auto root = graph.root();
+	return pipeline_loops(root);
+}
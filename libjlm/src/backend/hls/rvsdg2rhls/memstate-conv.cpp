@@ -0,0 +1,50 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "jlm/backend/hls/rvsdg2rhls/memstate-conv.hpp"
+#include <jive/rvsdg/traverser.hpp>
+#include <jlm/ir/operators/operators.hpp>
+#include <jlm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/util/Statistics.hpp>
+
+void
+jlm::hls::memstate_conv(jive::region *region) {
+	for (auto &node : jive::topdown_traverser(region)) {
+		if (auto structnode = dynamic_cast<jive::structural_node *>(node)) {
+			for (size_t n = 0; n < structnode->nsubregions(); n++) {
+				memstate_conv(structnode->subregion(n));
+			}
+		} else if (dynamic_cast<const jlm::MemStateOperator *>(&node->operation())) {
+			if (node->ninputs() == 1) {
+				for (size_t i = 0; i < node->noutputs(); ++i) {
+					node->output(i)->divert_users(node->input(0)->origin());
+				}
+			} else if (node->noutputs() == 1) {
+				if (jive::is<jlm::MemStateMergeOperator>(node)) {
+					continue;
+				}
+				std::vector<jive::output *> operands;
+				for (size_t i = 0; i < node->ninputs(); ++i) {
+					operands.push_back(node->input(i)->origin());
+				}
+				node->output(0)->divert_users(jlm::MemStateMergeOperator::Create(operands));
+			} else {
+				throw jlm::error("Unsupported memory state operator: " + node->operation().debug_string());
+			}
+			jive::remove(node);
+		}
+	}
+}
+
+void
+jlm::hls::split_memory_states(jlm::RvsdgModule &rm) {
+	jlm::StatisticsDescriptor sd;
+	jlm::aa::SteensgaardBasic aa;
+	aa.run(rm, sd);
+	memstate_conv(rm.Rvsdg().root());
+	jlm::DeadNodeElimination dne;
+	dne.run(rm, sd);
+}
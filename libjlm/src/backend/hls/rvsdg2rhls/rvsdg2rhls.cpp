@@ -11,8 +11,12 @@
 #include <jlm/backend/hls/rvsdg2rhls/theta-conv.hpp>
 #include <jlm/backend/hls/rvsdg2rhls/add-sinks.hpp>
 #include <jlm/backend/hls/rvsdg2rhls/add-forks.hpp>
+#include <jlm/backend/hls/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/backend/hls/rvsdg2rhls/loop-pipelining.hpp>
+#include <jlm/backend/hls/rvsdg2rhls/memstate-conv.hpp>
 #include <jlm/backend/hls/rvsdg2rhls/rhls-dne.hpp>
 #include <jlm/opt/InvariantValueRedirection.hpp>
+#include <jlm/opt/LoopStrengthReduction.hpp>
 #include <jlm/opt/inversion.hpp>
 #include <jlm/opt/cne.hpp>
 #include <jlm/backend/hls/rvsdg2rhls/check-rhls.hpp>
@@ -42,12 +46,15 @@ pre_opt(jlm::RvsdgModule &rm) {
 	jlm::DeadNodeElimination dne;
 	jlm::cne cne;
 	jlm::InvariantValueRedirection ivr;
+	jlm::LoopStrengthReduction lsr(false);
 	jlm::tginversion tgi;
 	jlm::StatisticsDescriptor sd;
 	tgi.run(rm, sd);
 	dne.run(rm, sd);
 	cne.run(rm, sd);
 	ivr.run(rm, sd);
+	lsr.run(rm, sd);
+	dne.run(rm, sd);
 }
 
 namespace jlm {
@@ -275,12 +282,15 @@ jlm::hls::split_hls_function(jlm::RvsdgModule &rm, std::string &function_name) {
 }
 
 void
-jlm::hls::rvsdg2rhls(jlm::RvsdgModule &rhls) {
+jlm::hls::rvsdg2rhls(jlm::RvsdgModule &rhls, size_t target_ii) {
 	pre_opt(rhls);
 
 //	jlm::hls::add_prints(rhls);
 //	dump_ref(rhls);
 
+	// order memory operations only within disjoint memory regions
+	jlm::hls::split_memory_states(rhls);
+
 	// run conversion on copy
 	jlm::hls::remove_unused_state(rhls);
 	// main conversion steps
@@ -289,10 +299,21 @@ jlm::hls::rvsdg2rhls(jlm::RvsdgModule &rhls) {
 	jlm::hls::theta_conv(rhls);
 	// rhls optimization
 	jlm::hls::dne(rhls);
+	// shorten loop recurrences
+	auto pipelined = jlm::hls::pipeline_loops(rhls);
+	for (size_t i = 0; i < pipelined.size(); ++i) {
+		std::cout << "loop " << i << ": II " << pipelined[i].initial_ii << " -> " << pipelined[i].ii << ", "
+				  << pipelined[i].separated << " memory states separated\n";
+	}
 	// enforce 1:1 input output relationship
 	jlm::hls::add_sinks(rhls);
 	jlm::hls::add_forks(rhls);
-//	jlm::hls::add_buffers(*rhls, true);
+	// size buffers for the requested throughput
+	auto estimates = jlm::hls::place_buffers(rhls, target_ii);
+	for (size_t i = 0; i < estimates.size(); ++i) {
+		std::cout << "loop " << i << ": estimated II " << estimates[i].ii << ", "
+				  << estimates[i].slots << " buffer slots\n";
+	}
 	// ensure that all rhls rules are met
 	jlm::hls::check_rhls(rhls);
 }
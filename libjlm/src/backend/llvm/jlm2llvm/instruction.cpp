@@ -19,8 +19,11 @@
 #include <jlm/backend/llvm/jlm2llvm/type.hpp>
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/MDBuilder.h>
 #include <llvm/IR/Module.h>
 
+#include <algorithm>
+
 namespace jlm {
 namespace jlm2llvm {
 
@@ -279,6 +282,50 @@ convert_phi(
 	return builder.CreatePHI(t, op.narguments());
 }
 
+static llvm::MDNode *
+get_alias_scope(size_t alias_class, context & ctx)
+{
+	if (auto scope = ctx.alias_scope(alias_class))
+		return scope;
+
+	llvm::MDBuilder mdbuilder(ctx.llvm_module().getContext());
+	if (!ctx.alias_domain())
+		ctx.set_alias_domain(mdbuilder.createAnonymousAliasScopeDomain("jlm"));
+
+	auto scope = mdbuilder.createAnonymousAliasScope(ctx.alias_domain(), strfmt("class", alias_class));
+	ctx.add_alias_scope(alias_class, scope);
+	return scope;
+}
+
+/*
+	Every alias class forms its own scope. A memory operation is within the scopes of its alias
+	classes, and does not alias with the scopes of all other alias classes of the function.
+*/
+static void
+set_alias_metadata(
+	llvm::Instruction & instruction,
+	const std::vector<size_t> & alias_classes,
+	context & ctx)
+{
+	if (alias_classes.empty())
+		return;
+
+	std::vector<llvm::Metadata*> scopes;
+	for (auto & alias_class : alias_classes)
+		scopes.push_back(get_alias_scope(alias_class, ctx));
+
+	std::vector<llvm::Metadata*> noalias;
+	for (auto & alias_class : ctx.alias_classes()) {
+		if (!std::binary_search(alias_classes.begin(), alias_classes.end(), alias_class))
+			noalias.push_back(get_alias_scope(alias_class, ctx));
+	}
+
+	auto & llvmctx = instruction.getContext();
+	instruction.setMetadata(llvm::LLVMContext::MD_alias_scope, llvm::MDNode::get(llvmctx, scopes));
+	if (!noalias.empty())
+		instruction.setMetadata(llvm::LLVMContext::MD_noalias, llvm::MDNode::get(llvmctx, noalias));
+}
+
 static llvm::Value *
 convert(
 	const LoadOperation & operation,
@@ -289,6 +336,7 @@ convert(
   auto type = convert_type(operation.GetPointerType().GetElementType(), ctx);
 	auto loadInstruction = builder.CreateLoad(type, ctx.value(args[0]));
 	loadInstruction->setAlignment(llvm::Align(operation.GetAlignment()));
+	set_alias_metadata(*loadInstruction, operation.GetAliasClasses(), ctx);
 	return loadInstruction;
 }
 
@@ -304,6 +352,7 @@ convert_store(
 
 	auto i = builder.CreateStore(ctx.value(args[1]), ctx.value(args[0]));
 	i->setAlignment(llvm::Align(store->GetAlignment()));
+	set_alias_metadata(*i, store->GetAliasClasses(), ctx);
 	return nullptr;
 }
 
@@ -812,7 +861,7 @@ convert(
 	auto destination = ctx.value(operands[0]);
 	auto source = ctx.value(operands[1]);
 	auto length = ctx.value(operands[2]);
-	auto isVolatile = ctx.value(operands[3]);
+	auto isVolatile = llvm::cast<llvm::ConstantInt>(ctx.value(operands[3]));
 
 	return builder.CreateMemCpy(
 		destination,
@@ -820,7 +869,27 @@ convert(
 		source,
 		llvm::MaybeAlign(),
 		length,
-		isVolatile);
+		isVolatile->isOne());
+}
+
+static llvm::Value *
+convert(
+	const Memset & op,
+	const std::vector<const variable*> & operands,
+	llvm::IRBuilder<> & builder,
+	context & ctx)
+{
+	auto destination = ctx.value(operands[0]);
+	auto value = ctx.value(operands[1]);
+	auto length = ctx.value(operands[2]);
+	auto isVolatile = llvm::cast<llvm::ConstantInt>(ctx.value(operands[3]));
+
+	return builder.CreateMemSet(
+		destination,
+		value,
+		length,
+		llvm::MaybeAlign(),
+		isVolatile->isOne());
 }
 
 static llvm::Value *
@@ -948,6 +1017,7 @@ convert_operation(
           {typeid(malloc_op),                       convert<malloc_op>},
           {typeid(free_op),                         convert<free_op>},
           {typeid(Memcpy),                          convert<Memcpy>},
+          {typeid(Memset),                          convert<Memset>},
           {typeid(fpneg_op),                        convert_fpneg},
           {typeid(bitcast_op),                      convert_cast<llvm::Instruction::BitCast>},
           {typeid(fpext_op),                        convert_cast<llvm::Instruction::FPExt>},
@@ -10,7 +10,9 @@
 #include <jlm/ir/cfg-structure.hpp>
 #include <jlm/ir/cfg-node.hpp>
 #include <jlm/ir/ipgraph-module.hpp>
+#include <jlm/ir/operators/load.hpp>
 #include <jlm/ir/operators/operators.hpp>
+#include <jlm/ir/operators/store.hpp>
 
 #include <jlm/backend/llvm/jlm2llvm/context.hpp>
 #include <jlm/backend/llvm/jlm2llvm/instruction.hpp>
@@ -22,6 +24,7 @@
 #include <llvm/IR/Module.h>
 
 #include <deque>
+#include <set>
 #include <unordered_map>
 
 namespace jlm {
@@ -310,6 +313,26 @@ convert_attributes(const jlm::function_node & f, context & ctx)
 	return llvm::AttributeList::get(llvmctx, fctset, retset, argsets);
 }
 
+static std::vector<size_t>
+collect_alias_classes(const std::vector<cfg_node*> & nodes)
+{
+	std::set<size_t> alias_classes;
+	for (const auto & node : nodes) {
+		auto bb = dynamic_cast<const basic_block*>(node);
+		if (!bb)
+			continue;
+
+		for (const auto & tac : bb->tacs()) {
+			if (auto load = dynamic_cast<const LoadOperation*>(&tac->operation()))
+				alias_classes.insert(load->GetAliasClasses().begin(), load->GetAliasClasses().end());
+			else if (auto store = dynamic_cast<const StoreOperation*>(&tac->operation()))
+				alias_classes.insert(store->GetAliasClasses().begin(), store->GetAliasClasses().end());
+		}
+	}
+
+	return {alias_classes.begin(), alias_classes.end()};
+}
+
 static inline void
 convert_cfg(jlm::cfg & cfg, llvm::Function & f, context & ctx)
 {
@@ -337,6 +360,7 @@ convert_cfg(jlm::cfg & cfg, llvm::Function & f, context & ctx)
 	}
 
 	add_arguments(cfg, f, ctx);
+	ctx.set_alias_classes(collect_alias_classes(nodes));
 
 	/* create non-terminator instructions */
 	for (const auto & node : nodes) {
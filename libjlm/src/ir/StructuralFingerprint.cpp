@@ -0,0 +1,335 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/alloca.hpp>
+#include <jlm/ir/operators/delta.hpp>
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/operators/load.hpp>
+#include <jlm/ir/operators/operators.hpp>
+#include <jlm/ir/operators/store.hpp>
+#include <jlm/ir/StructuralFingerprint.hpp>
+#include <jlm/ir/types.hpp>
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/side-table.hpp>
+#include <jive/types/record.hpp>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA256.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <typeinfo>
+
+namespace jlm {
+
+/**
+ * A SHA-256 digest. The digests of nodes and regions are computed from the digests of their operands and results,
+ * such that the fingerprint does not depend on the order of nodes.
+ */
+typedef std::array<uint8_t, 32> Digest;
+
+/**
+ * Serializes values unambiguously into a SHA-256 digest. Strings are prefixed with their length and integers are
+ * serialized with a fixed width and byte order, such that the digest is stable across program runs and platforms.
+ */
+class Serializer final {
+public:
+  void
+  AddInteger(uint64_t value)
+  {
+    uint8_t bytes[8];
+    for (size_t n = 0; n < 8; n++)
+      bytes[n] = static_cast<uint8_t>(value >> (8*n));
+
+    Sha256_.update(llvm::ArrayRef<uint8_t>(bytes));
+  }
+
+  void
+  AddString(const std::string & s)
+  {
+    AddInteger(s.size());
+    Sha256_.update(s);
+  }
+
+  void
+  AddDigest(const Digest & digest)
+  {
+    Sha256_.update(llvm::ArrayRef<uint8_t>(digest));
+  }
+
+  Digest
+  Finalize()
+  {
+    auto result = Sha256_.final();
+
+    Digest digest;
+    std::copy(result.begin(), result.end(), digest.begin());
+    return digest;
+  }
+
+private:
+  llvm::SHA256 Sha256_;
+};
+
+static void
+SerializeType(
+  Serializer & serializer,
+  const jive::type & type)
+{
+  serializer.AddString(type.debug_string());
+
+  if (auto pointerType = dynamic_cast<const PointerType*>(&type)) {
+    SerializeType(serializer, pointerType->GetElementType());
+    return;
+  }
+
+  if (auto functionType = dynamic_cast<const FunctionType*>(&type)) {
+    serializer.AddInteger(functionType->NumArguments());
+    for (size_t n = 0; n < functionType->NumArguments(); n++)
+      SerializeType(serializer, functionType->ArgumentType(n));
+    serializer.AddInteger(functionType->NumResults());
+    for (size_t n = 0; n < functionType->NumResults(); n++)
+      SerializeType(serializer, functionType->ResultType(n));
+    return;
+  }
+
+  /*
+   * Struct types can be recursive. Their elements therefore only contribute their debug string.
+   */
+  if (auto structType = dynamic_cast<const structtype*>(&type)) {
+    serializer.AddString(structType->name());
+    serializer.AddInteger(structType->packed());
+    auto declaration = structType->declaration();
+    serializer.AddInteger(declaration->nelements());
+    for (size_t n = 0; n < declaration->nelements(); n++)
+      serializer.AddString(declaration->element(n).debug_string());
+  }
+}
+
+static void
+SerializeAttributes(
+  Serializer & serializer,
+  const attributeset & attributes)
+{
+  for (auto & attribute : attributes) {
+    if (auto stringAttribute = dynamic_cast<const string_attribute*>(&attribute)) {
+      serializer.AddString("string");
+      serializer.AddString(stringAttribute->kind());
+      serializer.AddString(stringAttribute->value());
+    } else if (auto intAttribute = dynamic_cast<const int_attribute*>(&attribute)) {
+      serializer.AddString("int");
+      serializer.AddInteger(static_cast<uint64_t>(intAttribute->kind()));
+      serializer.AddInteger(intAttribute->value());
+    } else if (auto typeAttribute = dynamic_cast<const type_attribute*>(&attribute)) {
+      serializer.AddString("type");
+      serializer.AddInteger(static_cast<uint64_t>(typeAttribute->kind()));
+      SerializeType(serializer, typeAttribute->type());
+    } else if (auto enumAttribute = dynamic_cast<const enum_attribute*>(&attribute)) {
+      serializer.AddString("enum");
+      serializer.AddInteger(static_cast<uint64_t>(enumAttribute->kind()));
+    }
+  }
+  serializer.AddString("end");
+}
+
+static void
+SerializeAliasClasses(
+  Serializer & serializer,
+  const std::vector<size_t> & aliasClasses)
+{
+  serializer.AddInteger(aliasClasses.size());
+  for (auto aliasClass : aliasClasses)
+    serializer.AddInteger(aliasClass);
+}
+
+/*
+ * The debug strings of the operations omit some of their attributes. These attributes are serialized here, such
+ * that operations with the same debug string but different attributes have different digests.
+ */
+static void
+SerializeOperation(
+  Serializer & serializer,
+  const jive::operation & operation)
+{
+  serializer.AddString(typeid(operation).name());
+  serializer.AddString(operation.debug_string());
+
+  if (auto loadOperation = dynamic_cast<const LoadOperation*>(&operation)) {
+    serializer.AddInteger(loadOperation->GetAlignment());
+    SerializeAliasClasses(serializer, loadOperation->GetAliasClasses());
+  } else if (auto storeOperation = dynamic_cast<const StoreOperation*>(&operation)) {
+    serializer.AddInteger(storeOperation->GetAlignment());
+    SerializeAliasClasses(serializer, storeOperation->GetAliasClasses());
+  } else if (auto allocaOperation = dynamic_cast<const alloca_op*>(&operation)) {
+    serializer.AddInteger(allocaOperation->alignment());
+  } else if (auto extractValue = dynamic_cast<const ExtractValue*>(&operation)) {
+    serializer.AddInteger(std::distance(extractValue->begin(), extractValue->end()));
+    for (auto index : *extractValue)
+      serializer.AddInteger(index);
+  } else if (auto shuffleVector = dynamic_cast<const shufflevector_op*>(&operation)) {
+    serializer.AddInteger(shuffleVector->Mask().size());
+    for (auto index : shuffleVector->Mask())
+      serializer.AddInteger(static_cast<uint64_t>(index));
+  } else if (auto vectorUnary = dynamic_cast<const vectorunary_op*>(&operation)) {
+    SerializeOperation(serializer, vectorUnary->operation());
+  } else if (auto vectorBinary = dynamic_cast<const vectorbinary_op*>(&operation)) {
+    SerializeOperation(serializer, vectorBinary->operation());
+  }
+}
+
+static Digest
+ComputeArgumentDigest(const jive::argument & argument)
+{
+  Serializer serializer;
+  if (auto cvArgument = dynamic_cast<const lambda::cvargument*>(&argument)) {
+    auto & origin = *cvArgument->input()->origin();
+    auto name = GetSymbolName(origin);
+    serializer.AddString("ctxvar");
+    serializer.AddString(name);
+    if (name.empty())
+      SerializeType(serializer, origin.type());
+    return serializer.Finalize();
+  }
+
+  serializer.AddString("argument");
+  serializer.AddInteger(argument.index());
+  SerializeType(serializer, argument.type());
+  if (auto fctArgument = dynamic_cast<const lambda::fctargument*>(&argument))
+    SerializeAttributes(serializer, fctArgument->attributes());
+
+  return serializer.Finalize();
+}
+
+static Digest
+ComputeRegionDigest(
+  const jive::region & region,
+  jive::NodeMap<Digest> & nodeDigests);
+
+static void
+SerializeOrigin(
+  Serializer & serializer,
+  const jive::output & origin,
+  const std::vector<Digest> & argumentDigests,
+  const jive::NodeMap<Digest> & nodeDigests)
+{
+  if (auto output = dynamic_cast<const jive::node_output*>(&origin)) {
+    serializer.AddString("output");
+    serializer.AddDigest(*nodeDigests.lookup(*output->node()));
+    serializer.AddInteger(output->index());
+    return;
+  }
+
+  serializer.AddString("argument");
+  serializer.AddDigest(argumentDigests[origin.index()]);
+}
+
+static Digest
+ComputeNodeDigest(
+  const jive::node & node,
+  const std::vector<Digest> & argumentDigests,
+  jive::NodeMap<Digest> & nodeDigests)
+{
+  Serializer serializer;
+  SerializeOperation(serializer, node.operation());
+
+  serializer.AddInteger(node.ninputs());
+  for (size_t n = 0; n < node.ninputs(); n++)
+    SerializeOrigin(serializer, *node.input(n)->origin(), argumentDigests, nodeDigests);
+
+  serializer.AddInteger(node.noutputs());
+  for (size_t n = 0; n < node.noutputs(); n++)
+    SerializeType(serializer, node.output(n)->type());
+
+  if (auto structuralNode = dynamic_cast<const jive::structural_node*>(&node)) {
+    serializer.AddInteger(structuralNode->nsubregions());
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      serializer.AddDigest(ComputeRegionDigest(*structuralNode->subregion(n), nodeDigests));
+  }
+
+  return serializer.Finalize();
+}
+
+static Digest
+ComputeRegionDigest(
+  const jive::region & region,
+  jive::NodeMap<Digest> & nodeDigests)
+{
+  std::vector<Digest> argumentDigests;
+  argumentDigests.reserve(region.narguments());
+  for (size_t n = 0; n < region.narguments(); n++)
+    argumentDigests.push_back(ComputeArgumentDigest(*region.argument(n)));
+
+  /*
+   * The depth of a node is larger than the depths of the nodes of its operands. Visiting the nodes in order of
+   * their depths ensures that the operands of a node are serialized before the node itself.
+   */
+  std::vector<std::vector<const jive::node*>> levels;
+  for (auto & node : region.nodes) {
+    if (node.depth() >= levels.size())
+      levels.resize(node.depth()+1);
+    levels[node.depth()].push_back(&node);
+  }
+
+  for (auto & level : levels) {
+    for (auto & node : level)
+      nodeDigests[*node] = ComputeNodeDigest(*node, argumentDigests, nodeDigests);
+  }
+
+  Serializer serializer;
+  serializer.AddString("region");
+  serializer.AddInteger(region.narguments());
+  for (auto & argumentDigest : argumentDigests)
+    serializer.AddDigest(argumentDigest);
+
+  serializer.AddInteger(region.nresults());
+  for (size_t n = 0; n < region.nresults(); n++) {
+    auto result = region.result(n);
+    SerializeOrigin(serializer, *result->origin(), argumentDigests, nodeDigests);
+    SerializeType(serializer, result->type());
+  }
+
+  return serializer.Finalize();
+}
+
+std::string
+ComputeStructuralFingerprint(const lambda::node & lambdaNode)
+{
+  Serializer serializer;
+  serializer.AddString(lambdaNode.name());
+  SerializeType(serializer, lambdaNode.type());
+  serializer.AddInteger(static_cast<uint64_t>(lambdaNode.linkage()));
+  SerializeAttributes(serializer, lambdaNode.attributes());
+
+  jive::NodeMap<Digest> nodeDigests;
+  serializer.AddDigest(ComputeRegionDigest(*lambdaNode.subregion(), nodeDigests));
+
+  auto digest = serializer.Finalize();
+  return llvm::toHex(llvm::ArrayRef<uint8_t>(digest), true);
+}
+
+std::string
+GetSymbolName(const jive::output & output)
+{
+  if (output.region() != output.region()->graph()->root())
+    return "";
+
+  if (auto argument = dynamic_cast<const jive::argument*>(&output)) {
+    if (auto import = dynamic_cast<const jive::impport*>(&argument->port()))
+      return import->name();
+    return "";
+  }
+
+  if (auto lambdaOutput = dynamic_cast<const lambda::output*>(&output))
+    return lambdaOutput->node()->name();
+
+  if (auto deltaOutput = dynamic_cast<const delta::output*>(&output))
+    return deltaOutput->node()->name();
+
+  return "";
+}
+
+}
@@ -22,6 +22,12 @@ alloca_op::operator==(const operation & other) const noexcept
 	return this == &other;
 }
 
+bool
+alloca_op::internable() const noexcept
+{
+	return false;
+}
+
 std::string
 alloca_op::debug_string() const
 {
@@ -142,6 +142,12 @@ CallOperation::operator==(const operation & other) const noexcept
 	return true;
 }
 
+size_t
+CallOperation::hash() const
+{
+	return typeid(*this).hash_code() ^ (narguments() << 16) ^ nresults();
+}
+
 std::string
 CallOperation::debug_string() const
 {
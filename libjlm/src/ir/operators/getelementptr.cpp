@@ -27,6 +27,12 @@ getelementptr_op::operator==(const operation & other) const noexcept
 	return op->result(0) == result(0);
 }
 
+size_t
+getelementptr_op::hash() const
+{
+	return typeid(*this).hash_code() ^ narguments();
+}
+
 std::string
 getelementptr_op::debug_string() const
 {
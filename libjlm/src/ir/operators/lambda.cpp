@@ -38,6 +38,12 @@ operation::operator==(const jive::operation & other) const noexcept
 			&& op->attributes() == attributes();
 }
 
+size_t
+operation::hash() const
+{
+	return typeid(*this).hash_code() ^ std::hash<std::string>()(name());
+}
+
 std::unique_ptr<jive::operation>
 operation::copy() const
 {
@@ -211,38 +217,67 @@ node::copy(
 	return static_cast<lambda::node*>(jive::node::copy(region, operands));
 }
 
-lambda::node *
-node::copy(jive::region * region, jive::substitution_map & smap) const
+/*
+	Copies the function arguments and the body of \p lambda into \p copy, and finalizes \p copy.
+	The context variables of \p copy must correspond to the ones of \p lambda.
+*/
+static lambda::output *
+copy_body(const lambda::node & lambda, lambda::node & copy)
 {
-	auto lambda = create(region, type(), name(), linkage(), attributes());
-
-	/* add context variables */
 	jive::substitution_map subregionmap;
-	for (auto & cv : ctxvars()) {
-		auto origin = smap.lookup(cv.origin());
-		auto newcv = lambda->add_ctxvar(origin);
-		subregionmap.insert(cv.argument(), newcv);
-	}
+	for (size_t n = 0; n < lambda.ncvarguments(); n++)
+		subregionmap.insert(lambda.cvargument(n), copy.cvargument(n));
 
 	/* collect function arguments */
-	for (size_t n = 0; n < nfctarguments(); n++)
-		subregionmap.insert(fctargument(n), lambda->fctargument(n));
+	for (size_t n = 0; n < lambda.nfctarguments(); n++) {
+		copy.fctargument(n)->set_attributes(lambda.fctargument(n)->attributes());
+		subregionmap.insert(lambda.fctargument(n), copy.fctargument(n));
+	}
 
 	/* copy subregion */
-	subregion()->copy(lambda->subregion(), subregionmap, false, false);
+	lambda.subregion()->copy(copy.subregion(), subregionmap, false, false);
 
 	/* collect function results */
 	std::vector<jive::output*> results;
-	for (auto & result : fctresults())
+	for (auto & result : lambda.fctresults())
 		results.push_back(subregionmap.lookup(result.origin()));
 
 	/* finalize lambda */
-	auto o = lambda->finalize(results);
+	return copy.finalize(results);
+}
+
+lambda::node *
+node::copy(jive::region * region, jive::substitution_map & smap) const
+{
+	auto lambda = create(region, type(), name(), linkage(), attributes());
+
+	/* add context variables */
+	for (auto & cv : ctxvars())
+		lambda->add_ctxvar(smap.lookup(cv.origin()));
+
+	auto o = copy_body(*this, *lambda);
 	smap.insert(output(), o);
 
 	return lambda;
 }
 
+lambda::node *
+node::copy(
+	const std::string & name,
+	const jlm::linkage & linkage,
+	const attributeset & attributes) const
+{
+	auto lambda = create(region(), type(), name, linkage, attributes);
+
+	/* add context variables */
+	for (auto & cv : ctxvars())
+		lambda->add_ctxvar(cv.origin());
+
+	copy_body(*this, *lambda);
+
+	return lambda;
+}
+
 /*
 	FIXME: This function should be in jive.
 */
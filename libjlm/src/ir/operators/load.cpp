@@ -3,6 +3,7 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/statemux.hpp>
 
 #include <jlm/ir/operators/alloca.hpp>
@@ -22,7 +23,14 @@ LoadOperation::operator==(const operation & other) const noexcept
   return op
       && op->narguments() == narguments()
       && op->GetPointerType() == GetPointerType()
-      && op->GetAlignment() == GetAlignment();
+      && op->GetAlignment() == GetAlignment()
+      && op->GetAliasClasses() == GetAliasClasses();
+}
+
+size_t
+LoadOperation::hash() const
+{
+  return typeid(*this).hash_code() ^ (narguments() << 16) ^ alignment_;
 }
 
 std::string
@@ -37,6 +45,12 @@ LoadOperation::copy() const
 	return std::unique_ptr<jive::operation>(new LoadOperation(*this));
 }
 
+jive::node *
+LoadNode::copy(jive::region * region, const std::vector<jive::output*> & operands) const
+{
+  return new LoadNode(*region, GetOperation(), operands);
+}
+
 /* load normal form */
 
 /*
@@ -253,7 +267,7 @@ perform_load_mux_reduction(
 {
 	auto memStateMergeNode = jive::node_output::node(operands[1]);
 
-	auto ld = LoadNode::Create(operands[0], jive::operands(memStateMergeNode), op.GetAlignment());
+	auto ld = LoadNode::Create(operands[0], jive::operands(memStateMergeNode), op.GetAlignment(), op.GetAliasClasses());
 
 	std::vector<jive::output*> states = {std::next(ld.begin()), ld.end()};
 	auto mx = MemStateMergeOperator::Create(states);
@@ -278,7 +292,7 @@ perform_load_alloca_reduction(
 			otherstates.push_back(operands[n]);
 	}
 
-	auto ld = LoadNode::Create(operands[0], loadstates, op.GetAlignment());
+	auto ld = LoadNode::Create(operands[0], loadstates, op.GetAlignment(), op.GetAliasClasses());
 
 	std::vector<jive::output*> results(1, ld[0]);
 	results.insert(results.end(), std::next(ld.begin()), ld.end());
@@ -303,7 +317,7 @@ perform_load_store_state_reduction(
 		else new_loadstates.push_back(state);
 	}
 
-	auto ld = LoadNode::Create(operands[0], new_loadstates, op.GetAlignment());
+	auto ld = LoadNode::Create(operands[0], new_loadstates, op.GetAlignment(), op.GetAliasClasses());
 
 	results[0] = ld[0];
 	for (size_t n = 1, s = 1; n < results.size(); n++) {
@@ -332,7 +346,7 @@ perform_multiple_origin_reduction(
 		seen_state.insert(state);
 	}
 
-	auto ld = LoadNode::Create(operands[0], new_loadstates, op.GetAlignment());
+	auto ld = LoadNode::Create(operands[0], new_loadstates, op.GetAlignment(), op.GetAliasClasses());
 
 	results[0] = ld[0];
 	for (size_t n = 1, s = 1; n < results.size(); n++) {
@@ -406,7 +420,7 @@ perform_load_load_state_reduction(
 	for (size_t n = 1; n < operands.size(); n++)
 		ldstates.push_back(reduce_state(n-1, operands[n], mxstates));
 
-	auto ld = LoadNode::Create(operands[0], ldstates, op.GetAlignment());
+	auto ld = LoadNode::Create(operands[0], ldstates, op.GetAlignment(), op.GetAliasClasses());
 	for (size_t n = 0; n < mxstates.size(); n++) {
 		auto & states = mxstates[n];
 		if (!states.empty()) {
@@ -445,46 +459,67 @@ load_normal_form::normalize_node(jive::node * node) const
 	if (!get_mutable())
 		return true;
 
-	if (get_load_mux_reducible() && is_load_mux_reducible(operands)) {
-		divert_users(node, perform_load_mux_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_mux_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_mux");
+		if (attempt.applies(is_load_mux_reducible(operands))) {
+			divert_users(node, perform_load_mux_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_load_store_reducible() && is_load_store_reducible(*op, operands)) {
-		divert_users(node, perform_load_store_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_store_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store");
+		if (attempt.applies(is_load_store_reducible(*op, operands))) {
+			divert_users(node, perform_load_store_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_load_alloca_reducible() && is_load_alloca_reducible(operands)) {
-		divert_users(node, perform_load_alloca_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_alloca");
+		if (attempt.applies(is_load_alloca_reducible(operands))) {
+			divert_users(node, perform_load_alloca_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_load_store_state_reducible() && is_load_store_state_reducible(*op, operands)) {
-		divert_users(node, perform_load_store_state_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_store_state_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store_state");
+		if (attempt.applies(is_load_store_state_reducible(*op, operands))) {
+			divert_users(node, perform_load_store_state_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands)) {
-		divert_users(node, perform_multiple_origin_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_multiple_origin_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands))) {
+			divert_users(node, perform_multiple_origin_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_load_store_alloca_reducible() && is_load_store_alloca_reducible(operands)) {
-		divert_users(node, perform_load_store_alloca_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_store_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store_alloca");
+		if (attempt.applies(is_load_store_alloca_reducible(operands))) {
+			divert_users(node, perform_load_store_alloca_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_load_load_state_reducible() && is_load_load_state_reducible(operands)) {
-		divert_users(node, perform_load_load_state_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_load_load_state_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_load_state");
+		if (attempt.applies(is_load_load_state_reducible(operands))) {
+			divert_users(node, perform_load_load_state_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
 	return simple_normal_form::normalize_node(node);
@@ -502,26 +537,47 @@ load_normal_form::normalized_create(
 	if (!get_mutable())
 		return simple_normal_form::normalized_create(region, op, operands);
 
-	if (get_load_mux_reducible() && is_load_mux_reducible(operands))
-		return perform_load_mux_reduction(*lop, operands);
+	if (get_load_mux_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_mux");
+		if (attempt.applies(is_load_mux_reducible(operands)))
+			return perform_load_mux_reduction(*lop, operands);
+	}
 
-	if (get_load_store_reducible() && is_load_store_reducible(*lop, operands))
-		return perform_load_store_reduction(*lop, operands);
+	if (get_load_store_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store");
+		if (attempt.applies(is_load_store_reducible(*lop, operands)))
+			return perform_load_store_reduction(*lop, operands);
+	}
 
-	if (get_load_alloca_reducible() && is_load_alloca_reducible(operands))
-		return perform_load_alloca_reduction(*lop, operands);
+	if (get_load_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_alloca");
+		if (attempt.applies(is_load_alloca_reducible(operands)))
+			return perform_load_alloca_reduction(*lop, operands);
+	}
 
-	if (get_load_store_state_reducible() && is_load_store_state_reducible(*lop, operands))
-		return perform_load_store_state_reduction(*lop, operands);
+	if (get_load_store_state_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store_state");
+		if (attempt.applies(is_load_store_state_reducible(*lop, operands)))
+			return perform_load_store_state_reduction(*lop, operands);
+	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands))
-		return perform_multiple_origin_reduction(*lop, operands);
+	if (get_multiple_origin_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands)))
+			return perform_multiple_origin_reduction(*lop, operands);
+	}
 
-	if (get_load_store_alloca_reducible() && is_load_store_alloca_reducible(operands))
-		return perform_load_store_alloca_reduction(*lop, operands);
+	if (get_load_store_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_store_alloca");
+		if (attempt.applies(is_load_store_alloca_reducible(operands)))
+			return perform_load_store_alloca_reduction(*lop, operands);
+	}
 
-	if (get_load_load_state_reducible() && is_load_load_state_reducible(operands))
-		return perform_load_load_state_reduction(*lop, operands);
+	if (get_load_load_state_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "load", "load_load_state");
+		if (attempt.applies(is_load_load_state_reducible(operands)))
+			return perform_load_load_state_reduction(*lop, operands);
+	}
 
 	return simple_normal_form::normalized_create(region, op, operands);
 }
@@ -434,6 +434,12 @@ zext_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+zext_op::hash() const
+{
+	return typeid(*this).hash_code() ^ (nsrcbits() << 16) ^ ndstbits();
+}
+
 std::string
 zext_op::debug_string() const
 {
@@ -565,6 +571,12 @@ UndefValueOperation::operator==(const operation & other) const noexcept
       && op->GetType() == GetType();
 }
 
+size_t
+UndefValueOperation::hash() const
+{
+  return typeid(*this).hash_code();
+}
+
 std::string
 UndefValueOperation::debug_string() const
 {
@@ -735,6 +747,12 @@ fptrunc_op::operator==(const operation & other) const noexcept
 	return op && op->srcsize() == srcsize() && op->dstsize() == dstsize();
 }
 
+size_t
+trunc_op::hash() const
+{
+	return typeid(*this).hash_code() ^ (nsrcbits() << 16) ^ ndstbits();
+}
+
 std::string
 fptrunc_op::debug_string() const
 {
@@ -1256,6 +1274,14 @@ loopstatemux_op::copy() const
 	return std::unique_ptr<jive::operation>(new loopstatemux_op(*this));
 }
 
+/* MemState operator */
+
+size_t
+MemStateOperator::hash() const
+{
+	return typeid(*this).hash_code() ^ (narguments() << 16) ^ nresults();
+}
+
 /* MemStateMerge operator */
 
 MemStateMergeOperator::~MemStateMergeOperator()
@@ -1316,6 +1342,12 @@ malloc_op::operator==(const operation & other) const noexcept
 	return this == &other;
 }
 
+bool
+malloc_op::internable() const noexcept
+{
+	return false;
+}
+
 std::string
 malloc_op::debug_string() const
 {
@@ -1342,6 +1374,12 @@ free_op::operator==(const operation & other) const noexcept
 	return this == &other;
 }
 
+bool
+free_op::internable() const noexcept
+{
+	return false;
+}
+
 std::string
 free_op::debug_string() const
 {
@@ -1368,6 +1406,12 @@ Memcpy::operator==(const operation & other) const noexcept
 	return this == &other;
 }
 
+bool
+Memcpy::internable() const noexcept
+{
+	return false;
+}
+
 std::string
 Memcpy::debug_string() const
 {
@@ -1380,4 +1424,36 @@ Memcpy::copy() const
 	return std::unique_ptr<jive::operation>(new Memcpy(*this));
 }
 
+/* memset operator */
+
+Memset::~Memset()
+{}
+
+bool
+Memset::operator==(const operation & other) const noexcept
+{
+	/*
+		Avoid CNE for memset operator
+	*/
+	return this == &other;
+}
+
+bool
+Memset::internable() const noexcept
+{
+	return false;
+}
+
+std::string
+Memset::debug_string() const
+{
+	return "Memset";
+}
+
+std::unique_ptr<jive::operation>
+Memset::copy() const
+{
+	return std::unique_ptr<jive::operation>(new Memset(*this));
+}
+
 }
@@ -82,6 +82,12 @@ sext_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+sext_op::hash() const
+{
+	return typeid(*this).hash_code() ^ (nsrcbits() << 16) ^ ndstbits();
+}
+
 std::string
 sext_op::debug_string() const
 {
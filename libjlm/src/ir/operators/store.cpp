@@ -22,7 +22,14 @@ StoreOperation::operator==(const operation & other) const noexcept
   return op
       && op->NumStates() == NumStates()
       && op->GetPointerType() == GetPointerType()
-      && op->GetAlignment() == GetAlignment();
+      && op->GetAlignment() == GetAlignment()
+      && op->GetAliasClasses() == GetAliasClasses();
+}
+
+size_t
+StoreOperation::hash() const
+{
+  return typeid(*this).hash_code() ^ (narguments() << 16) ^ Alignment_;
 }
 
 std::string
@@ -37,6 +44,12 @@ StoreOperation::copy() const
 	return std::unique_ptr<jive::operation>(new StoreOperation(*this));
 }
 
+jive::node *
+StoreNode::copy(jive::region * region, const std::vector<jive::output*> & operands) const
+{
+  return new StoreNode(*region, GetOperation(), operands);
+}
+
 /* store normal form */
 
 static bool
@@ -120,7 +133,7 @@ perform_store_mux_reduction(
 	auto memStateMergeNode = jive::node_output::node(operands[2]);
 	auto memStateMergeOperands = jive::operands(memStateMergeNode);
 
-	auto states = StoreNode::Create(operands[0], operands[1], memStateMergeOperands, op.GetAlignment());
+	auto states = StoreNode::Create(operands[0], operands[1], memStateMergeOperands, op.GetAlignment(), op.GetAliasClasses());
 	return {MemStateMergeOperator::Create(states)};
 }
 
@@ -134,7 +147,7 @@ perform_store_store_reduction(
 
 	auto storeops = jive::operands(storenode);
 	std::vector<jive::output*> states(std::next(std::next(storeops.begin())), storeops.end());
-	return StoreNode::Create(operands[0], operands[1], states, op.GetAlignment());
+	return StoreNode::Create(operands[0], operands[1], states, op.GetAlignment(), op.GetAliasClasses());
 }
 
 static std::vector<jive::output*>
@@ -147,7 +160,7 @@ perform_store_alloca_reduction(
 	auto alloca_state = jive::node_output::node(address)->output(1);
 	std::unordered_set<jive::output*> states(std::next(std::next(operands.begin())), operands.end());
 
-	auto outputs = StoreNode::Create(address, value, {alloca_state}, op.GetAlignment());
+	auto outputs = StoreNode::Create(address, value, {alloca_state}, op.GetAlignment(), op.GetAliasClasses());
 	states.erase(alloca_state);
 	states.insert(outputs[0]);
 	return {states.begin(), states.end()};
@@ -160,7 +173,7 @@ perform_multiple_origin_reduction(
 {
 	std::unordered_set<jive::output*> states(std::next(std::next(operands.begin())), operands.end());
 	return StoreNode::Create(operands[0], operands[1], {states.begin(), states.end()},
-                                op.GetAlignment());
+                                op.GetAlignment(), op.GetAliasClasses());
 }
 
 store_normal_form::~store_normal_form()
@@ -193,42 +206,54 @@ store_normal_form::normalize_node(jive::node * node) const
 	if (!get_mutable())
 		return true;
 
-	if (get_store_mux_reducible() && is_store_mux_reducible(operands)) {
-		divert_users(node, perform_store_mux_reduction(*op, operands));
-		node->region()->remove_node(node);
-		return false;
-	}
-
-	if (get_store_store_reducible() && is_store_store_reducible(*op, operands)) {
-		divert_users(node, perform_store_store_reduction(*op, operands));
-		remove(node);
-		return false;
+	if (get_store_mux_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "store_mux");
+		if (attempt.applies(is_store_mux_reducible(operands))) {
+			divert_users(node, perform_store_mux_reduction(*op, operands));
+			node->region()->remove_node(node);
+			return false;
+		}
 	}
 
-	if (get_store_alloca_reducible() && is_store_alloca_reducible(operands)) {
-		divert_users(node, perform_store_alloca_reduction(*op, operands));
-		node->region()->remove_node(node);
-		return false;
+	if (get_store_store_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "store_store");
+		if (attempt.applies(is_store_store_reducible(*op, operands))) {
+			divert_users(node, perform_store_store_reduction(*op, operands));
+			remove(node);
+			return false;
+		}
 	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands)) {
-		auto outputs = perform_multiple_origin_reduction(*op, operands);
-		auto new_node = jive::node_output::node(outputs[0]);
-
-		std::unordered_map<jive::output*, jive::output*> origin2output;
-		for (size_t n = 0; n < outputs.size(); n++) {
-			auto origin = new_node->input(n+2)->origin();
-			JLM_ASSERT(origin2output.find(origin) == origin2output.end());
-			origin2output[origin] = outputs[n];
+	if (get_store_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "store_alloca");
+		if (attempt.applies(is_store_alloca_reducible(operands))) {
+			divert_users(node, perform_store_alloca_reduction(*op, operands));
+			node->region()->remove_node(node);
+			return false;
 		}
+	}
 
-		for (size_t n = 2; n < node->ninputs(); n++) {
-			auto origin = node->input(n)->origin();
-			JLM_ASSERT(origin2output.find(origin) != origin2output.end());
-			node->output(n-2)->divert_users(origin2output[origin]);
+	if (get_multiple_origin_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands))) {
+			auto outputs = perform_multiple_origin_reduction(*op, operands);
+			auto new_node = jive::node_output::node(outputs[0]);
+
+			std::unordered_map<jive::output*, jive::output*> origin2output;
+			for (size_t n = 0; n < outputs.size(); n++) {
+				auto origin = new_node->input(n+2)->origin();
+				JLM_ASSERT(origin2output.find(origin) == origin2output.end());
+				origin2output[origin] = outputs[n];
+			}
+
+			for (size_t n = 2; n < node->ninputs(); n++) {
+				auto origin = node->input(n)->origin();
+				JLM_ASSERT(origin2output.find(origin) != origin2output.end());
+				node->output(n-2)->divert_users(origin2output[origin]);
+			}
+			remove(node);
+			return false;
 		}
-		remove(node);
-		return false;
 	}
 
 	return simple_normal_form::normalize_node(node);
@@ -247,14 +272,23 @@ store_normal_form::normalized_create(
 		return simple_normal_form::normalized_create(region, op, ops);
 
 	auto operands = ops;
-	if (get_store_mux_reducible() && is_store_mux_reducible(operands))
-		return perform_store_mux_reduction(*sop, operands);
+	if (get_store_mux_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "store_mux");
+		if (attempt.applies(is_store_mux_reducible(operands)))
+			return perform_store_mux_reduction(*sop, operands);
+	}
 
-	if (get_store_alloca_reducible() && is_store_alloca_reducible(operands))
-		return perform_store_alloca_reduction(*sop, operands);
+	if (get_store_alloca_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "store_alloca");
+		if (attempt.applies(is_store_alloca_reducible(operands)))
+			return perform_store_alloca_reduction(*sop, operands);
+	}
 
-	if (get_multiple_origin_reducible() && is_multiple_origin_reducible(operands))
-		return perform_multiple_origin_reduction(*sop, operands);
+	if (get_multiple_origin_reducible()) {
+		jive::rewrite_attempt attempt(*graph(), "store", "multiple_origin");
+		if (attempt.applies(is_multiple_origin_reducible(operands)))
+			return perform_multiple_origin_reduction(*sop, operands);
+	}
 
 	return simple_normal_form::normalized_create(region, op, operands);
 }
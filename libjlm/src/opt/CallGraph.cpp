@@ -0,0 +1,155 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/call.hpp>
+#include <jlm/ir/operators/gamma.hpp>
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/operators/Phi.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CallGraph.hpp>
+
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/rvsdg/traverser.hpp>
+
+namespace jlm {
+
+jive::simple_node *
+CallGraph::CallSite::GetConstantArgument(size_t n) const
+{
+  auto origin = CallNode_->input(n+1)->origin();
+
+  /*
+   * Constants are routed into gamma nodes as entry variables.
+   */
+  while (auto argument = is_gamma_argument(origin))
+    origin = argument->input()->origin();
+
+  auto node = jive::node_output::node(origin);
+  if (is<jive::simple_op>(node) && node->ninputs() == 0)
+    return static_cast<jive::simple_node*>(node);
+
+  return nullptr;
+}
+
+size_t
+CallGraph::CallSite::NumConstantArguments() const
+{
+  size_t numConstantArguments = 0;
+  for (size_t n = 0; n < CallNode_->NumArguments(); n++) {
+    if (GetConstantArgument(n) != nullptr)
+      numConstantArguments++;
+  }
+
+  return numConstantArguments;
+}
+
+CallGraph::~CallGraph()
+= default;
+
+CallGraph::Node &
+CallGraph::GetNode(const lambda::node & lambda) const
+{
+  auto it = Nodes_.find(&lambda);
+  JLM_ASSERT(it != Nodes_.end());
+  return *it->second;
+}
+
+bool
+CallGraph::IsRecursive(const lambda::node & lambda) const
+{
+  auto & node = GetNode(lambda);
+  if (Sccs_[node.GetScc()].size() > 1)
+    return true;
+
+  for (auto & callSite : node.GetCallSites()) {
+    if (callSite->GetCallee() == &node)
+      return true;
+  }
+
+  return false;
+}
+
+void
+CallGraph::AddScc(const std::vector<lambda::node*> & lambdas)
+{
+  if (lambdas.empty())
+    return;
+
+  for (auto & lambda : lambdas)
+    Nodes_[lambda] = std::make_unique<Node>(*lambda, Sccs_.size());
+
+  Sccs_.push_back(lambdas);
+}
+
+void
+CallGraph::CollectCallSites(
+  Node & caller,
+  jive::region & region,
+  size_t loopDepth)
+{
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<jive::structural_node*>(&node)) {
+      auto depth = is<jive::theta_op>(structuralNode) ? loopDepth + 1 : loopDepth;
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectCallSites(caller, *structuralNode->subregion(n), depth);
+      continue;
+    }
+
+    if (!is<CallOperation>(&node))
+      continue;
+
+    auto & callNode = *AssertedCast<CallNode>(&node);
+    auto classifier = CallNode::ClassifyCall(callNode);
+
+    Node * callee = nullptr;
+    if (classifier->GetCallType() == CallType::DirectCall)
+      callee = &GetNode(*classifier->GetLambdaOutput().node());
+
+    CallSites_.push_back(std::make_unique<CallSite>(
+      callNode,
+      caller,
+      callee,
+      classifier->GetCallType(),
+      loopDepth));
+
+    auto callSite = CallSites_.back().get();
+    caller.CallSites_.push_back(callSite);
+    if (callee != nullptr)
+      callee->Callers_.push_back(callSite);
+  }
+}
+
+std::unique_ptr<CallGraph>
+CallGraph::Create(const RvsdgModule & rvsdgModule)
+{
+  std::unique_ptr<CallGraph> callGraph(new CallGraph());
+
+  /*
+   * The top-down traversal of the root region visits callees before their callers, as the lambda of a callee
+   * is a dependency of its callers. Mutually recursive lambdas are tied together in a single phi node.
+   */
+  for (auto & node : jive::topdown_traverser(rvsdgModule.Rvsdg().root())) {
+    if (auto lambda = dynamic_cast<lambda::node*>(node)) {
+      callGraph->AddScc({lambda});
+    } else if (auto phi = dynamic_cast<const phi::node*>(node)) {
+      std::vector<lambda::node*> lambdas;
+      for (auto & phiNode : phi->subregion()->nodes) {
+        if (auto lambda = dynamic_cast<lambda::node*>(&phiNode))
+          lambdas.push_back(lambda);
+      }
+      callGraph->AddScc(lambdas);
+    }
+  }
+
+  for (auto & scc : callGraph->Sccs_) {
+    for (auto & lambda : scc)
+      callGraph->CollectCallSites(callGraph->GetNode(*lambda), *lambda->subregion(), 0);
+  }
+
+  return callGraph;
+}
+
+}
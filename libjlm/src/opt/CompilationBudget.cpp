@@ -0,0 +1,261 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CompilationBudget.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/LambdaExtraction.hpp>
+#include <jlm/opt/optimization.hpp>
+#include <jlm/opt/reduction.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <chrono>
+
+namespace jlm {
+
+class CompilationBudgetStatistics final : public Statistics {
+public:
+  ~CompilationBudgetStatistics() override
+  = default;
+
+  CompilationBudgetStatistics(
+    jlm::filepath sourceFile,
+    std::string function,
+    const char * path)
+    : Statistics(StatisticsDescriptor::StatisticsId::CompilationBudget)
+    , NumNodesBefore_(0)
+    , NumNodesAfter_(0)
+    , NumSkippedPasses_(0)
+    , Exceeded_("none")
+    , Path_(path)
+    , Function_(std::move(function))
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start(const jive::graph & graph) noexcept
+  {
+    NumNodesBefore_ = jive::nnodes(graph.root());
+    Timer_.start();
+  }
+
+  void
+  Stop(const jive::graph & graph) noexcept
+  {
+    Timer_.stop();
+    NumNodesAfter_ = jive::nnodes(graph.root());
+  }
+
+  void
+  SetExceeded(const char * budget) noexcept
+  {
+    Exceeded_ = budget;
+  }
+
+  void
+  AddSkippedPass() noexcept
+  {
+    NumSkippedPasses_++;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("CompilationBudget ",
+                  SourceFile_.to_str(), " ",
+                  "Function:", Function_, " ",
+                  "Path:", Path_, " ",
+                  "Exceeded:", Exceeded_, " ",
+                  "#SkippedPasses:", NumSkippedPasses_, " ",
+                  "#RvsdgNodesBefore:", NumNodesBefore_, " ",
+                  "#RvsdgNodesAfter:", NumNodesAfter_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumNodesBefore_;
+  size_t NumNodesAfter_;
+  size_t NumSkippedPasses_;
+  const char * Exceeded_;
+  const char * Path_;
+  std::string Function_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+/**
+ * A time budget that starts with the construction of the deadline.
+ */
+class Deadline final {
+public:
+  explicit
+  Deadline(std::optional<size_t> milliseconds)
+    : Milliseconds_(milliseconds)
+    , Start_(std::chrono::steady_clock::now())
+  {}
+
+  bool
+  IsExceeded() const
+  {
+    return Milliseconds_.has_value()
+        && std::chrono::steady_clock::now() - Start_ > std::chrono::milliseconds(Milliseconds_.value());
+  }
+
+private:
+  std::optional<size_t> Milliseconds_;
+  std::chrono::steady_clock::time_point Start_;
+};
+
+/*
+ * Dead node elimination and node reduction only shrink the graph and are linear in its size. They still run after
+ * a budget is exceeded.
+ */
+static bool
+IsCheap(const optimization & optimization)
+{
+  return dynamic_cast<const DeadNodeElimination*>(&optimization)
+      || dynamic_cast<const nodereduction*>(&optimization);
+}
+
+static bool
+HasAttribute(
+  const attributeset & attributes,
+  const attribute::kind & kind)
+{
+  for (auto & attribute : attributes) {
+    auto enumAttribute = dynamic_cast<const enum_attribute*>(&attribute);
+    if (enumAttribute && enumAttribute->kind() == kind)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Runs \p optimizations on \p rvsdgModule. The budgets are checked before every pass, and once one of them is
+ * exceeded, only cheap passes are run.
+ *
+ * @param moduleDeadline The time budget of the entire module, which also bounds extracted lambdas.
+ * @param deadline The time budget of \p rvsdgModule.
+ * @param growth The growth budget of \p rvsdgModule.
+ */
+static void
+RunWithinBudget(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor,
+  const std::vector<optimization*> & optimizations,
+  const Deadline & moduleDeadline,
+  const Deadline & deadline,
+  std::optional<size_t> growth,
+  CompilationBudgetStatistics & statistics)
+{
+  auto & graph = rvsdgModule.Rvsdg();
+  auto numNodesBefore = jive::nnodes(graph.root());
+  auto IsGrowthExceeded = [&]()
+  {
+    return growth.has_value() && jive::nnodes(graph.root()) * 100 > numNodesBefore * (100 + growth.value());
+  };
+
+  statistics.Start(graph);
+  bool isExceeded = false;
+  for (auto & optimization : optimizations) {
+    if (!isExceeded) {
+      if (deadline.IsExceeded()) {
+        statistics.SetExceeded("time");
+        isExceeded = true;
+      } else if (moduleDeadline.IsExceeded()) {
+        statistics.SetExceeded("module-time");
+        isExceeded = true;
+      } else if (IsGrowthExceeded()) {
+        statistics.SetExceeded("growth");
+        isExceeded = true;
+      }
+    }
+
+    if (isExceeded && !IsCheap(*optimization)) {
+      statistics.AddSkippedPass();
+      continue;
+    }
+
+    optimization->run(rvsdgModule, statisticsDescriptor);
+  }
+  statistics.Stop(graph);
+}
+
+bool
+CompilationBudget::IsCold(
+  const lambda::node & lambdaNode,
+  size_t coldThreshold)
+{
+  return HasAttribute(lambdaNode.attributes(), attribute::kind::cold)
+      || jive::nnodes(lambdaNode.subregion()) < coldThreshold;
+}
+
+void
+CompilationBudget::Run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor,
+  const std::vector<optimization*> & optimizations) const
+{
+  auto & graph = rvsdgModule.Rvsdg();
+  Deadline moduleDeadline(ModuleLimits_.Time);
+
+  nodereduction nodeReduction;
+  DeadNodeElimination deadNodeElimination;
+  std::vector<optimization*> fastPath({&nodeReduction, &deadNodeElimination});
+
+  std::vector<lambda::node*> lambdaNodes;
+  for (auto & node : graph.root()->nodes) {
+    if (auto lambdaNode = dynamic_cast<lambda::node*>(&node))
+      lambdaNodes.push_back(lambdaNode);
+  }
+
+  /*
+   * Cold lambdas, and all lambdas with a budget of their own, are optimized in separate modules.
+   */
+  bool hasLambdaBudget = LambdaLimits_.Time.has_value() || LambdaLimits_.Growth.has_value();
+  std::vector<std::unique_ptr<DetachedLambda>> detachedLambdas;
+  for (auto lambdaNode : lambdaNodes) {
+    if (!IsExtractable(*lambdaNode))
+      continue;
+
+    bool isCold = IsCold(*lambdaNode, ColdThreshold_);
+    if (!isCold && !hasLambdaBudget)
+      continue;
+
+    auto module = ExtractLambda(*lambdaNode, rvsdgModule);
+    auto extractedLambda = FindLambda(*module->Rvsdg().root(), lambdaNode->name());
+    module->Rvsdg().add_export(extractedLambda->output(), {extractedLambda->output()->type(), lambdaNode->name()});
+
+    CompilationBudgetStatistics statistics(
+      rvsdgModule.SourceFileName(),
+      lambdaNode->name(),
+      isCold ? "cold" : "isolated");
+    if (isCold) {
+      RunWithinBudget(*module, statisticsDescriptor, fastPath, moduleDeadline, Deadline(std::nullopt), std::nullopt,
+        statistics);
+    } else {
+      RunWithinBudget(*module, statisticsDescriptor, optimizations, moduleDeadline, Deadline(LambdaLimits_.Time),
+        LambdaLimits_.Growth, statistics);
+    }
+    statisticsDescriptor.PrintStatistics(statistics);
+
+    detachedLambdas.push_back(std::make_unique<DetachedLambda>(*lambdaNode, std::move(module)));
+  }
+
+  CompilationBudgetStatistics statistics(rvsdgModule.SourceFileName(), "<module>", "module");
+  RunWithinBudget(rvsdgModule, statisticsDescriptor, optimizations, moduleDeadline, moduleDeadline,
+    ModuleLimits_.Growth, statistics);
+
+  for (auto & detachedLambda : detachedLambdas)
+    detachedLambda->Reattach(graph);
+
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/opt/CallGraph.hpp>
+#include <jlm/opt/FunctionAttributeInference.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/statemux.hpp>
+#include <jive/rvsdg/theta.hpp>
+
+#include <unordered_set>
+
+namespace jlm {
+
+class FunctionAttributeInferenceStatistics final : public Statistics {
+public:
+  ~FunctionAttributeInferenceStatistics() override
+  = default;
+
+  explicit
+  FunctionAttributeInferenceStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::FunctionAttributeInference)
+    , NumLambdas_(0)
+    , NumReadNone_(0)
+    , NumReadOnly_(0)
+    , NumNoRecurse_(0)
+    , NumNoCapture_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    size_t numLambdas,
+    size_t numReadNone,
+    size_t numReadOnly,
+    size_t numNoRecurse,
+    size_t numNoCapture) noexcept
+  {
+    Timer_.stop();
+    NumLambdas_ = numLambdas;
+    NumReadNone_ = numReadNone;
+    NumReadOnly_ = numReadOnly;
+    NumNoRecurse_ = numNoRecurse;
+    NumNoCapture_ = numNoCapture;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("FunctionAttributeInference ",
+                  SourceFile_.to_str(), " ",
+                  "#Lambdas:", NumLambdas_, " ",
+                  "#ReadNone:", NumReadNone_, " ",
+                  "#ReadOnly:", NumReadOnly_, " ",
+                  "#NoRecurse:", NumNoRecurse_, " ",
+                  "#NoCapture:", NumNoCapture_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumLambdas_;
+  size_t NumReadNone_;
+  size_t NumReadOnly_;
+  size_t NumNoRecurse_;
+  size_t NumNoCapture_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+/** \brief Memory effects of a lambda, ordered from weakest to strongest.
+ */
+enum class MemoryEffect {
+  None,
+  Read,
+  Write
+};
+
+/** \brief Inferred properties of a lambda
+ */
+struct FunctionSummary {
+  MemoryEffect Effect = MemoryEffect::None;
+  bool NoRecurse = true;
+  std::vector<bool> NoCapture;
+
+  bool
+  operator==(const FunctionSummary & other) const noexcept
+  {
+    return Effect == other.Effect
+        && NoRecurse == other.NoRecurse
+        && NoCapture == other.NoCapture;
+  }
+};
+
+using FunctionSummaryMap = std::unordered_map<const lambda::node*, FunctionSummary>;
+
+static bool
+HasAttribute(
+  const attributeset & attributes,
+  const attribute::kind & kind)
+{
+  for (auto & attribute : attributes) {
+    auto enumAttribute = dynamic_cast<const enum_attribute*>(&attribute);
+    if (enumAttribute && enumAttribute->kind() == kind)
+      return true;
+  }
+
+  return false;
+}
+
+static bool
+IsContainedIn(
+  const jive::region & region,
+  const lambda::node & lambda)
+{
+  auto current = &region;
+  while (current != nullptr) {
+    if (current == lambda.subregion())
+      return true;
+
+    current = current->node() ? current->node()->region() : nullptr;
+  }
+
+  return false;
+}
+
+/**
+ * Checks whether \p address only points to memory that was allocated within \p lambda. Such memory is not visible to
+ * the callers of the lambda.
+ */
+static bool
+IsLocalAddress(
+  const jive::output & address,
+  const lambda::node & lambda,
+  const aa::PointsToGraph & pointsToGraph)
+{
+  auto & registerNode = pointsToGraph.GetRegisterNode(address);
+  if (registerNode.NumTargets() == 0)
+    return false;
+
+  for (auto & target : registerNode.Targets()) {
+    auto allocaNode = dynamic_cast<const aa::PointsToGraph::AllocaNode*>(&target);
+    if (allocaNode == nullptr || !IsContainedIn(*allocaNode->GetAllocaNode().region(), lambda))
+      return false;
+  }
+
+  return true;
+}
+
+static const FunctionSummary *
+GetCalleeSummary(
+  const CallNode & callNode,
+  const FunctionSummaryMap & summaries)
+{
+  auto classifier = CallNode::ClassifyCall(callNode);
+  if (classifier->GetCallType() != CallTypeClassifier::CallType::DirectCall)
+    return nullptr;
+
+  auto it = summaries.find(classifier->GetLambdaOutput().node());
+  return it != summaries.end() ? &it->second : nullptr;
+}
+
+static MemoryEffect
+ComputeMemoryEffect(
+  const jive::region & region,
+  const lambda::node & lambda,
+  bool ignoreLocalMemory,
+  const aa::PointsToGraph & pointsToGraph,
+  const FunctionSummaryMap & summaries)
+{
+  auto effect = MemoryEffect::None;
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<const jive::structural_node*>(&node)) {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++) {
+        auto subregionEffect = ComputeMemoryEffect(
+          *structuralNode->subregion(n),
+          lambda,
+          ignoreLocalMemory,
+          pointsToGraph,
+          summaries);
+        effect = std::max(effect, subregionEffect);
+      }
+      continue;
+    }
+
+    if (auto loadNode = dynamic_cast<const LoadNode*>(&node)) {
+      auto & address = *loadNode->GetAddressInput()->origin();
+      if (!ignoreLocalMemory || !IsLocalAddress(address, lambda, pointsToGraph))
+        effect = std::max(effect, MemoryEffect::Read);
+      continue;
+    }
+
+    if (auto storeNode = dynamic_cast<const StoreNode*>(&node)) {
+      auto & address = *storeNode->GetAddressInput()->origin();
+      if (!ignoreLocalMemory || !IsLocalAddress(address, lambda, pointsToGraph))
+        effect = std::max(effect, MemoryEffect::Write);
+      continue;
+    }
+
+    if (auto callNode = dynamic_cast<const CallNode*>(&node)) {
+      auto calleeSummary = GetCalleeSummary(*callNode, summaries);
+      effect = std::max(effect, calleeSummary ? calleeSummary->Effect : MemoryEffect::Write);
+      continue;
+    }
+
+    if (is<alloca_op>(&node)
+        || is<MemStateOperator>(&node)
+        || is<jive::mux_op>(&node))
+      continue;
+
+    /*
+     * Be conservative with all other operations that touch memory or I/O state.
+     */
+    for (size_t n = 0; n < node.ninputs(); n++) {
+      auto & type = node.input(n)->type();
+      if (is<MemoryStateType>(type) || is<iostatetype>(type))
+        effect = MemoryEffect::Write;
+    }
+    for (size_t n = 0; n < node.noutputs(); n++) {
+      auto & type = node.output(n)->type();
+      if (is<MemoryStateType>(type) || is<iostatetype>(type))
+        effect = MemoryEffect::Write;
+    }
+  }
+
+  return effect;
+}
+
+/**
+ * Checks whether a copy of the pointer \p argument might outlive the invocation of its lambda.
+ */
+static bool
+IsCaptured(
+  const jive::output & argument,
+  const FunctionSummaryMap & summaries)
+{
+  std::unordered_set<const jive::output*> visited({&argument});
+  std::vector<const jive::output*> worklist({&argument});
+
+  auto push = [&](const jive::output * output)
+  {
+    if (visited.insert(output).second)
+      worklist.push_back(output);
+  };
+
+  while (!worklist.empty()) {
+    auto output = worklist.back();
+    worklist.pop_back();
+
+    for (auto & user : *output) {
+      if (auto result = dynamic_cast<const jive::result*>(user)) {
+        auto structuralOutput = result->output();
+        if (is<jive::gamma_op>(result->region()->node()) && structuralOutput) {
+          push(structuralOutput);
+          continue;
+        }
+
+        if (auto thetaOutput = dynamic_cast<const jive::theta_output*>(structuralOutput)) {
+          push(thetaOutput);
+          push(thetaOutput->argument());
+          continue;
+        }
+
+        return true;
+      }
+
+      if (auto structuralInput = dynamic_cast<const jive::structural_input*>(user)) {
+        auto structuralNode = structuralInput->node();
+        if (!is<jive::gamma_op>(structuralNode) && !is<jive::theta_op>(structuralNode))
+          return true;
+
+        for (auto & subregionArgument : structuralInput->arguments)
+          push(&subregionArgument);
+        continue;
+      }
+
+      auto node = input_node(user);
+      if (is<LoadOperation>(node) && user->index() == 0)
+        continue;
+
+      if (is<StoreOperation>(node) && user->index() == 0)
+        continue;
+
+      if (is<ptrcmp_op>(node))
+        continue;
+
+      if (is<getelementptr_op>(node) || is<bitcast_op>(node) || is<select_op>(node)) {
+        push(node->output(0));
+        continue;
+      }
+
+      if (auto callNode = dynamic_cast<const CallNode*>(node)) {
+        if (user->index() == 0)
+          continue;
+
+        auto calleeSummary = GetCalleeSummary(*callNode, summaries);
+        if (calleeSummary
+            && user->index()-1 < calleeSummary->NoCapture.size()
+            && calleeSummary->NoCapture[user->index()-1])
+          continue;
+
+        return true;
+      }
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static FunctionSummary
+ComputeSummary(
+  const lambda::node & lambda,
+  const CallGraph & callGraph,
+  const aa::PointsToGraph & pointsToGraph,
+  const FunctionSummaryMap & summaries)
+{
+  bool isRecursive = callGraph.IsRecursive(lambda);
+
+  FunctionSummary summary;
+  summary.Effect = ComputeMemoryEffect(*lambda.subregion(), lambda, !isRecursive, pointsToGraph, summaries);
+
+  summary.NoRecurse = !isRecursive;
+  for (auto & callSite : callGraph.GetNode(lambda).GetCallSites()) {
+    auto callee = callSite->GetCallee();
+    if (callee == nullptr || !summaries.at(&callee->GetLambda()).NoRecurse)
+      summary.NoRecurse = false;
+  }
+
+  for (size_t n = 0; n < lambda.nfctarguments(); n++) {
+    auto argument = lambda.fctargument(n);
+    summary.NoCapture.push_back(is<PointerType>(argument->type()) && !IsCaptured(*argument, summaries));
+  }
+
+  return summary;
+}
+
+/**
+ * Replaces \p lambda with a copy that has the function attributes \p attributes.
+ */
+static void
+ReplaceAttributes(
+  lambda::node & lambda,
+  const attributeset & attributes)
+{
+  auto newLambda = lambda.copy(lambda.name(), lambda.linkage(), attributes);
+  lambda.output()->divert_users(newLambda->output());
+  remove(&lambda);
+}
+
+FunctionAttributeInference::~FunctionAttributeInference()
+= default;
+
+void
+FunctionAttributeInference::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  FunctionAttributeInferenceStatistics statistics(rvsdgModule.SourceFileName());
+  statistics.Start();
+
+  aa::Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsDescriptor);
+  auto callGraph = CallGraph::Create(rvsdgModule);
+
+  /*
+   * Infer summaries bottom-up. The summaries of a strongly connected component start out optimistic and are
+   * weakened until they no longer change.
+   */
+  FunctionSummaryMap summaries;
+  for (auto & scc : callGraph->GetSccs()) {
+    for (auto & lambda : scc) {
+      auto & summary = summaries[lambda];
+      summary.NoCapture.resize(lambda->nfctarguments(), true);
+    }
+
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (auto & lambda : scc) {
+        auto summary = ComputeSummary(*lambda, *callGraph, *pointsToGraph, summaries);
+        if (summary == summaries[lambda])
+          continue;
+
+        summaries[lambda] = std::move(summary);
+        changed = true;
+      }
+    }
+  }
+
+  /*
+   * Attach the inferred attributes. Argument attributes can be added in place, while function attributes require the
+   * lambda to be replaced.
+   */
+  size_t numReadNone = 0, numReadOnly = 0, numNoRecurse = 0, numNoCapture = 0;
+  for (auto & scc : callGraph->GetSccs()) {
+    for (auto & lambda : scc) {
+      auto & summary = summaries[lambda];
+      for (size_t n = 0; n < lambda->nfctarguments(); n++) {
+        auto argument = lambda->fctargument(n);
+        if (summary.NoCapture[n] && !HasAttribute(argument->attributes(), attribute::kind::no_capture)) {
+          argument->add(*enum_attribute::create(attribute::kind::no_capture));
+          numNoCapture++;
+        }
+      }
+
+      auto attributes = lambda->attributes();
+      bool readNone = HasAttribute(attributes, attribute::kind::read_none);
+      bool readOnly = HasAttribute(attributes, attribute::kind::read_only);
+      bool noRecurse = HasAttribute(attributes, attribute::kind::no_recurse);
+
+      bool changed = false;
+      if (summary.Effect == MemoryEffect::None && !readNone) {
+        attributes.insert(enum_attribute::create(attribute::kind::read_none));
+        numReadNone++;
+        changed = true;
+      } else if (summary.Effect == MemoryEffect::Read && !readNone && !readOnly) {
+        attributes.insert(enum_attribute::create(attribute::kind::read_only));
+        numReadOnly++;
+        changed = true;
+      }
+
+      if (summary.NoRecurse && !noRecurse) {
+        attributes.insert(enum_attribute::create(attribute::kind::no_recurse));
+        numNoRecurse++;
+        changed = true;
+      }
+
+      if (changed)
+        ReplaceAttributes(*lambda, attributes);
+    }
+  }
+
+  statistics.Stop(summaries.size(), numReadNone, numReadOnly, numNoRecurse, numNoCapture);
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
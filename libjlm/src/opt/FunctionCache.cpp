@@ -0,0 +1,358 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/common.hpp>
+#include <jlm/backend/llvm/jlm2llvm/jlm2llvm.hpp>
+#include <jlm/backend/llvm/rvsdg2jlm/rvsdg2jlm.hpp>
+#include <jlm/frontend/llvm/InterProceduralGraphConversion.hpp>
+#include <jlm/frontend/llvm/LlvmModuleConversion.hpp>
+#include <jlm/ir/ipgraph-module.hpp>
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/StructuralFingerprint.hpp>
+#include <jlm/opt/FunctionCache.hpp>
+#include <jlm/opt/LambdaExtraction.hpp>
+#include <jlm/opt/optimization.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/SHA256.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace jlm {
+
+class FunctionCacheStatistics final : public Statistics {
+public:
+  ~FunctionCacheStatistics() override
+  = default;
+
+  explicit
+  FunctionCacheStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::FunctionCache)
+    , NumHits_(0)
+    , NumMisses_(0)
+    , NumUncacheable_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  StartLookup() noexcept
+  {
+    LookupTimer_.start();
+  }
+
+  void
+  StopLookup() noexcept
+  {
+    LookupTimer_.stop();
+  }
+
+  void
+  StartUpdate() noexcept
+  {
+    UpdateTimer_.start();
+  }
+
+  void
+  StopUpdate() noexcept
+  {
+    UpdateTimer_.stop();
+  }
+
+  void
+  AddHit() noexcept
+  {
+    NumHits_++;
+  }
+
+  void
+  AddMiss() noexcept
+  {
+    NumMisses_++;
+  }
+
+  void
+  AddUncacheable() noexcept
+  {
+    NumUncacheable_++;
+  }
+
+  std::string
+  ToString() const override
+  {
+    return strfmt("FunctionCache ",
+                  SourceFile_.to_str(), " ",
+                  "#Hits:", NumHits_, " ",
+                  "#Misses:", NumMisses_, " ",
+                  "#Uncacheable:", NumUncacheable_, " ",
+                  "LookupTime[ns]:", LookupTimer_.ns(), " ",
+                  "UpdateTime[ns]:", UpdateTimer_.ns());
+  }
+
+private:
+  size_t NumHits_;
+  size_t NumMisses_;
+  size_t NumUncacheable_;
+  jlm::timer LookupTimer_;
+  jlm::timer UpdateTimer_;
+  jlm::filepath SourceFile_;
+};
+
+struct CacheMiss {
+  std::string Name;
+  std::string Key;
+};
+
+/**
+ * The version of the cache entries. It must be incremented whenever the format of the entries or the computation of
+ * the structural fingerprint changes.
+ */
+static const char * const EntryVersion = "2";
+
+/**
+ * Returns an identifier of the running build of the optimizer, or an empty string if it cannot be determined. The
+ * identifier changes whenever the executable is rebuilt or replaced, such that lambdas optimized by another build
+ * are never restored.
+ */
+static const std::string &
+GetBuildId()
+{
+  static const std::string buildId = []()
+  {
+    struct stat status;
+    if (stat("/proc/self/exe", &status) != 0)
+      return std::string();
+
+    return strfmt(status.st_dev, ":", status.st_ino, ":", status.st_size, ":", status.st_mtime);
+  }();
+
+  return buildId;
+}
+
+static std::string
+ComputeKey(
+  const lambda::node & lambdaNode,
+  const std::string & pipeline)
+{
+  std::vector<std::string> components({
+    ComputeStructuralFingerprint(lambdaNode),
+    pipeline,
+    EntryVersion,
+    GetBuildId()});
+
+  llvm::SHA256 sha256;
+  for (auto & component : components) {
+    sha256.update(std::to_string(component.size()));
+    sha256.update(":");
+    sha256.update(component);
+  }
+
+  return llvm::toHex(sha256.final(), true);
+}
+
+static std::string
+ToLlvmIr(
+  const RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  auto ipgModule = rvsdg2jlm::rvsdg2jlm(rvsdgModule, statisticsDescriptor);
+
+  llvm::LLVMContext context;
+  auto llvmModule = jlm2llvm::convert(*ipgModule, context);
+
+  /*
+   * The names of the basic blocks are derived from pointers. They are removed, such that the same lambda always
+   * results in the same text.
+   */
+  for (auto & function : *llvmModule) {
+    for (auto & basicBlock : function)
+      basicBlock.setName("");
+  }
+
+  std::string ir;
+  llvm::raw_string_ostream os(ir);
+  llvmModule->print(os, nullptr);
+  os.flush();
+
+  return ir;
+}
+
+static std::unique_ptr<RvsdgModule>
+FromLlvmIr(
+  const std::string & path,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  llvm::LLVMContext context;
+  llvm::SMDiagnostic diagnostic;
+  auto llvmModule = llvm::parseIRFile(path, diagnostic, context);
+  if (!llvmModule)
+    return nullptr;
+
+  try {
+    auto ipgModule = ConvertLlvmModule(*llvmModule);
+    return ConvertInterProceduralGraphModule(*ipgModule, statisticsDescriptor);
+  } catch (const jlm::error &) {
+    return nullptr;
+  }
+}
+
+/**
+ * Writes \p content to a temporary file that is then renamed to \p path, such that concurrent compilations never
+ * observe a partially written file.
+ */
+static void
+WriteFile(
+  const std::string & path,
+  const std::string & content)
+{
+  auto temporaryPath = strfmt(path, ".", getpid(), ".tmp");
+  std::ofstream file(temporaryPath);
+  file << content;
+  file.close();
+
+  if (!file || rename(temporaryPath.c_str(), path.c_str()) != 0)
+    unlink(temporaryPath.c_str());
+}
+
+/**
+ * Loads the module with the cached lambda of \p lambdaNode. The cached lambda must only depend on the context
+ * variables of \p lambdaNode.
+ */
+static std::unique_ptr<RvsdgModule>
+Lookup(
+  const lambda::node & lambdaNode,
+  const std::string & entryPath,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  if (access(entryPath.c_str(), R_OK) != 0)
+    return nullptr;
+
+  auto module = FromLlvmIr(entryPath, statisticsDescriptor);
+  if (!module)
+    return nullptr;
+
+  auto & root = *module->Rvsdg().root();
+  if (!FindLambda(root, lambdaNode.name()))
+    return nullptr;
+
+  for (size_t n = 0; n < root.narguments(); n++) {
+    auto import = root.argument(n);
+    auto name = GetSymbolName(*import);
+
+    bool isContextVariable = false;
+    for (auto & cv : lambdaNode.ctxvars())
+      isContextVariable |= GetSymbolName(*cv.origin()) == name && cv.type() == import->type();
+
+    if (!isContextVariable)
+      return nullptr;
+  }
+
+  return module;
+}
+
+FunctionCache::FunctionCache(
+  jlm::filepath directory,
+  std::string pipeline)
+  : Directory_(std::move(directory))
+  , Pipeline_(std::move(pipeline))
+{}
+
+bool
+FunctionCache::IsCacheable(const lambda::node & lambdaNode)
+{
+  return IsExtractable(lambdaNode);
+}
+
+void
+FunctionCache::Run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor,
+  const std::vector<optimization*> & optimizations) const
+{
+  /*
+   * Without a build identifier, entries of other builds of the optimizer cannot be told apart.
+   */
+  if (GetBuildId().empty()) {
+    optimize(rvsdgModule, statisticsDescriptor, optimizations);
+    return;
+  }
+
+  FunctionCacheStatistics statistics(rvsdgModule.SourceFileName());
+
+  /*
+   * The conversions of cache entries must not print statistics, as they would be mistaken for statistics of the
+   * module.
+   */
+  StatisticsDescriptor conversionStatisticsDescriptor;
+  auto & graph = rvsdgModule.Rvsdg();
+
+  statistics.StartLookup();
+  std::vector<lambda::node*> lambdaNodes;
+  for (auto & node : graph.root()->nodes) {
+    if (auto lambdaNode = dynamic_cast<lambda::node*>(&node))
+      lambdaNodes.push_back(lambdaNode);
+  }
+
+  std::vector<std::unique_ptr<DetachedLambda>> hits;
+  std::vector<CacheMiss> misses;
+  for (auto lambdaNode : lambdaNodes) {
+    if (!IsCacheable(*lambdaNode)) {
+      statistics.AddUncacheable();
+      continue;
+    }
+
+    auto key = ComputeKey(*lambdaNode, Pipeline_);
+    auto entryPath = strfmt(Directory_.to_str(), "/", key, ".ll");
+    if (auto module = Lookup(*lambdaNode, entryPath, conversionStatisticsDescriptor)) {
+      hits.push_back(std::make_unique<DetachedLambda>(*lambdaNode, std::move(module)));
+      statistics.AddHit();
+    } else {
+      misses.push_back({lambdaNode->name(), key});
+      statistics.AddMiss();
+    }
+  }
+  statistics.StopLookup();
+
+  optimize(rvsdgModule, statisticsDescriptor, optimizations);
+
+  statistics.StartUpdate();
+  for (auto & hit : hits)
+    hit->Reattach(graph);
+
+  if (!misses.empty() && mkdir(Directory_.to_str().c_str(), 0755) != 0 && errno != EEXIST) {
+    std::cerr << "Warning: Cannot create function cache directory " << Directory_.to_str() << ": "
+              << strerror(errno) << "\n";
+    misses.clear();
+  }
+
+  for (auto & miss : misses) {
+    auto lambdaNode = FindLambda(*graph.root(), miss.Name);
+    if (!lambdaNode || !IsCacheable(*lambdaNode))
+      continue;
+
+    auto entryPath = strfmt(Directory_.to_str(), "/", miss.Key, ".ll");
+    auto output = ToLlvmIr(*ExtractLambda(*lambdaNode, rvsdgModule), conversionStatisticsDescriptor);
+    WriteFile(entryPath, output);
+  }
+  statistics.StopUpdate();
+
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
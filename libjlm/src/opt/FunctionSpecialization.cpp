@@ -0,0 +1,338 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/call.hpp>
+#include <jlm/ir/operators/delta.hpp>
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/operators/Phi.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CallGraph.hpp>
+#include <jlm/opt/FunctionSpecialization.hpp>
+#include <jlm/opt/inlining.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/substitution.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace jlm {
+
+class FunctionSpecializationStatistics final : public Statistics {
+public:
+  ~FunctionSpecializationStatistics() override
+  = default;
+
+  explicit
+  FunctionSpecializationStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::FunctionSpecialization)
+    , NumNodesBefore_(0)
+    , NumNodesAfter_(0)
+    , NumClones_(0)
+    , NumInPlace_(0)
+    , NumCallSites_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start(const jive::graph & graph) noexcept
+  {
+    NumNodesBefore_ = jive::nnodes(graph.root());
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    const jive::graph & graph,
+    size_t numClones,
+    size_t numInPlace,
+    size_t numCallSites) noexcept
+  {
+    Timer_.stop();
+    NumNodesAfter_ = jive::nnodes(graph.root());
+    NumClones_ = numClones;
+    NumInPlace_ = numInPlace;
+    NumCallSites_ = numCallSites;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("FunctionSpecialization ",
+                  SourceFile_.to_str(), " ",
+                  "#RvsdgNodesBefore:", NumNodesBefore_, " ",
+                  "#RvsdgNodesAfter:", NumNodesAfter_, " ",
+                  "#Clones:", NumClones_, " ",
+                  "#InPlace:", NumInPlace_, " ",
+                  "#CallSites:", NumCallSites_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumNodesBefore_;
+  size_t NumNodesAfter_;
+  size_t NumClones_;
+  size_t NumInPlace_;
+  size_t NumCallSites_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+/**
+ * The constants a call site passes to the arguments of a lambda. Arguments that are not constant at the call site or
+ * that are unused within the lambda are nullptr.
+ */
+using Signature = std::vector<const jive::simple_node*>;
+
+/**
+ * The call sites of a lambda that pass the same constants.
+ */
+struct Specialization {
+  Signature Constants;
+  std::vector<CallNode*> CallNodes;
+};
+
+static Signature
+ComputeSignature(
+  const CallGraph::CallSite & callSite,
+  const lambda::node & lambda)
+{
+  Signature signature(lambda.nfctarguments(), nullptr);
+  for (size_t n = 0; n < lambda.nfctarguments(); n++) {
+    if (lambda.fctargument(n)->nusers() != 0)
+      signature[n] = callSite.GetConstantArgument(n);
+  }
+
+  return signature;
+}
+
+static bool
+IsSpecializable(const Signature & signature)
+{
+  for (auto & constant : signature) {
+    if (constant != nullptr)
+      return true;
+  }
+
+  return false;
+}
+
+static bool
+AreEqual(
+  const Signature & signature1,
+  const Signature & signature2)
+{
+  JLM_ASSERT(signature1.size() == signature2.size());
+
+  for (size_t n = 0; n < signature1.size(); n++) {
+    auto constant1 = signature1[n];
+    auto constant2 = signature2[n];
+
+    if (constant1 == nullptr || constant2 == nullptr) {
+      if (constant1 != constant2)
+        return false;
+      continue;
+    }
+
+    if (constant1->operation() != constant2->operation())
+      return false;
+  }
+
+  return true;
+}
+
+static std::vector<Specialization>
+GroupCallSites(const CallGraph::Node & callee)
+{
+  auto & lambda = callee.GetLambda();
+
+  std::vector<Specialization> specializations;
+  for (auto & callSite : callee.GetCallers()) {
+    auto signature = ComputeSignature(*callSite, lambda);
+
+    auto it = std::find_if(specializations.begin(), specializations.end(), [&](const Specialization & specialization)
+    {
+      return AreEqual(specialization.Constants, signature);
+    });
+
+    if (it == specializations.end()) {
+      specializations.push_back({std::move(signature), {}});
+      it = std::prev(specializations.end());
+    }
+
+    it->CallNodes.push_back(&callSite->GetCallNode());
+  }
+
+  return specializations;
+}
+
+static jive::output *
+CreateConstant(
+  jive::region & region,
+  const jive::simple_node & constant)
+{
+  auto & operation = *static_cast<const jive::simple_op*>(&constant.operation());
+  return jive::simple_node::create_normalized(&region, operation, {})[0];
+}
+
+/**
+ * Diverts the uses of the specialized arguments of \p lambda to the constants of \p signature.
+ */
+static void
+SpecializeInPlace(
+  lambda::node & lambda,
+  const Signature & signature)
+{
+  for (size_t n = 0; n < lambda.nfctarguments(); n++) {
+    if (signature[n] != nullptr)
+      lambda.fctargument(n)->divert_users(CreateConstant(*lambda.subregion(), *signature[n]));
+  }
+}
+
+/**
+ * Collects the names of the functions, global variables, and imports in \p region and its phi nodes.
+ */
+static void
+CollectNames(
+  const jive::region & region,
+  std::unordered_set<std::string> & names)
+{
+  for (size_t n = 0; n < region.narguments(); n++) {
+    if (auto port = dynamic_cast<const impport*>(&region.argument(n)->port()))
+      names.insert(port->name());
+  }
+
+  for (auto & node : region.nodes) {
+    if (auto lambda = dynamic_cast<const lambda::node*>(&node))
+      names.insert(lambda->name());
+    else if (auto delta = dynamic_cast<const delta::node*>(&node))
+      names.insert(delta->name());
+    else if (auto phi = dynamic_cast<const phi::node*>(&node))
+      CollectNames(*phi->subregion(), names);
+  }
+}
+
+/**
+ * Returns a name for a specialization of \p lambda that is not in \p names, and adds it to \p names.
+ */
+static std::string
+CreateSpecializationName(
+  const lambda::node & lambda,
+  std::unordered_set<std::string> & names)
+{
+  for (size_t n = 0; ; n++) {
+    auto name = strfmt(lambda.name(), ".specialized.", n);
+    if (names.insert(name).second)
+      return name;
+  }
+}
+
+/**
+ * Copies \p lambda and substitutes the constants of \p signature for the specialized arguments in the copy.
+ */
+static lambda::node *
+CreateSpecialization(
+  const lambda::node & lambda,
+  const Signature & signature,
+  const std::string & name)
+{
+  auto specialization = lambda.copy(name, linkage::internal_linkage, lambda.attributes());
+  SpecializeInPlace(*specialization, signature);
+
+  return specialization;
+}
+
+static void
+RedirectCalls(
+  const std::vector<CallNode*> & callNodes,
+  lambda::node & lambda)
+{
+  for (auto & callNode : callNodes) {
+    auto function = route_to_region(lambda.output(), callNode->region());
+    callNode->GetFunctionInput()->divert_to(function);
+  }
+}
+
+static void
+SpecializeFunctions(
+  RvsdgModule & rvsdgModule,
+  size_t growth,
+  FunctionSpecializationStatistics & statistics)
+{
+  auto & graph = rvsdgModule.Rvsdg();
+  auto callGraph = CallGraph::Create(rvsdgModule);
+
+  size_t budget = jive::nnodes(graph.root()) * growth / 100;
+  size_t numClones = 0, numInPlace = 0, numCallSites = 0;
+
+  std::unordered_set<std::string> names;
+  CollectNames(*graph.root(), names);
+
+  for (auto & scc : callGraph->GetSccs()) {
+    for (auto & lambda : scc) {
+      auto & callee = callGraph->GetNode(*lambda);
+      if (lambda->region() != graph.root() || callGraph->IsRecursive(*lambda))
+        continue;
+
+      auto specializations = GroupCallSites(callee);
+      auto lambdaSize = jive::nnodes(lambda->subregion());
+
+      /*
+       * The original lambda is dead once all its call sites are redirected, so it can be specialized in place for
+       * the last group of call sites.
+       */
+      bool isOriginalUsed = !callee.HasOnlyDirectCalls();
+      for (size_t n = 0; n < specializations.size(); n++) {
+        auto & specialization = specializations[n];
+        bool isLastSpecialization = n == specializations.size()-1;
+
+        if (!IsSpecializable(specialization.Constants)) {
+          isOriginalUsed = true;
+          continue;
+        }
+
+        if (isLastSpecialization && !isOriginalUsed) {
+          SpecializeInPlace(*lambda, specialization.Constants);
+          numCallSites += specialization.CallNodes.size();
+          numInPlace++;
+          continue;
+        }
+
+        if (lambdaSize > budget) {
+          isOriginalUsed = true;
+          continue;
+        }
+        budget -= lambdaSize;
+
+        auto clone = CreateSpecialization(*lambda, specialization.Constants, CreateSpecializationName(*lambda, names));
+        RedirectCalls(specialization.CallNodes, *clone);
+        numCallSites += specialization.CallNodes.size();
+        numClones++;
+      }
+    }
+  }
+
+  statistics.Stop(graph, numClones, numInPlace, numCallSites);
+}
+
+FunctionSpecialization::~FunctionSpecialization()
+= default;
+
+void
+FunctionSpecialization::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  FunctionSpecializationStatistics statistics(rvsdgModule.SourceFileName());
+
+  statistics.Start(rvsdgModule.Rvsdg());
+  SpecializeFunctions(rvsdgModule, Growth_, statistics);
+
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
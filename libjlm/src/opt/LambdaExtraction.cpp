@@ -0,0 +1,129 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/rvsdg/binary.hpp>
+
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/StructuralFingerprint.hpp>
+#include <jlm/opt/LambdaExtraction.hpp>
+
+namespace jlm {
+
+lambda::node *
+FindLambda(
+  jive::region & region,
+  const std::string & name)
+{
+  for (auto & node : region.nodes) {
+    auto lambdaNode = dynamic_cast<lambda::node*>(&node);
+    if (lambdaNode && lambdaNode->name() == name)
+      return lambdaNode;
+  }
+
+  return nullptr;
+}
+
+bool
+IsExtractable(const lambda::node & lambdaNode)
+{
+  if (lambdaNode.region() != lambdaNode.graph()->root())
+    return false;
+
+  for (auto & cv : lambdaNode.ctxvars()) {
+    if (GetSymbolName(*cv.origin()).empty())
+      return false;
+  }
+
+  return true;
+}
+
+std::unique_ptr<RvsdgModule>
+ExtractLambda(
+  const lambda::node & lambdaNode,
+  const RvsdgModule & rvsdgModule)
+{
+  auto module = RvsdgModule::Create(
+    jlm::filepath(lambdaNode.name()),
+    rvsdgModule.TargetTriple(),
+    rvsdgModule.DataLayout());
+  auto & graph = module->Rvsdg();
+
+  /*
+   * Use the same normal form settings as the conversion from LLVM, such that jlm2llvm can handle the module.
+   */
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+  jive::binary_op::normal_form(&graph)->set_flatten(false);
+
+  jive::substitution_map smap;
+  for (auto & cv : lambdaNode.ctxvars()) {
+    auto origin = cv.origin();
+    auto import = graph.add_import(impport(origin->type(), GetSymbolName(*origin), linkage::external_linkage));
+    smap.insert(origin, import);
+  }
+  lambdaNode.copy(graph.root(), smap);
+
+  return module;
+}
+
+DetachedLambda::DetachedLambda(
+  lambda::node & lambdaNode,
+  std::unique_ptr<RvsdgModule> module)
+  : Name_(lambdaNode.name())
+  , Module_(std::move(module))
+{
+  JLM_ASSERT(IsExtractable(lambdaNode));
+  JLM_ASSERT(FindLambda(*Module_->Rvsdg().root(), Name_) != nullptr);
+  auto & graph = *lambdaNode.graph();
+
+  for (auto & cv : lambdaNode.ctxvars()) {
+    auto origin = cv.origin();
+    auto result = graph.add_export(origin, {origin->type(), ""});
+    Dependencies_.emplace_back(GetSymbolName(*origin), result);
+  }
+
+  auto import = graph.add_import(impport(lambdaNode.output()->type(), lambdaNode.name(), lambdaNode.linkage()));
+  lambdaNode.output()->divert_users(import);
+  remove(&lambdaNode);
+}
+
+void
+DetachedLambda::Reattach(jive::graph & graph)
+{
+  auto root = graph.root();
+
+  jive::argument * placeholder = nullptr;
+  for (size_t n = 0; n < root->narguments(); n++) {
+    if (GetSymbolName(*root->argument(n)) == Name_) {
+      placeholder = root->argument(n);
+      break;
+    }
+  }
+
+  if (placeholder) {
+    jive::substitution_map smap;
+    auto & moduleRoot = *Module_->Rvsdg().root();
+    for (size_t n = 0; n < moduleRoot.narguments(); n++) {
+      auto import = moduleRoot.argument(n);
+      auto name = GetSymbolName(*import);
+      for (auto & dependency : Dependencies_) {
+        if (dependency.first == name) {
+          smap.insert(import, dependency.second->origin());
+          break;
+        }
+      }
+    }
+
+    auto lambdaNode = FindLambda(moduleRoot, Name_)->copy(root, smap);
+    placeholder->divert_users(lambdaNode->output());
+    root->remove_argument(placeholder->index());
+  }
+
+  for (auto & dependency : Dependencies_)
+    root->remove_result(dependency.second->index());
+  Dependencies_.clear();
+}
+
+}
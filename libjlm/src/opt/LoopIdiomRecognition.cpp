@@ -0,0 +1,633 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/LoopIdiomRecognition.hpp>
+#include <jlm/opt/unroll.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+namespace jlm {
+
+class LoopIdiomRecognitionStatistics final : public Statistics {
+public:
+  ~LoopIdiomRecognitionStatistics() override
+  = default;
+
+  explicit
+  LoopIdiomRecognitionStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::LoopIdiomRecognition)
+    , NumMemsets_(0)
+    , NumMemcpys_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    size_t numMemsets,
+    size_t numMemcpys) noexcept
+  {
+    Timer_.stop();
+    NumMemsets_ = numMemsets;
+    NumMemcpys_ = numMemcpys;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("LoopIdiomRecognition ",
+                  SourceFile_.to_str(), " ",
+                  "#Memsets:", NumMemsets_, " ",
+                  "#Memcpys:", NumMemcpys_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumMemsets_;
+  size_t NumMemcpys_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+/**
+ * A theta node that stores a loop-invariant value or a loaded value to the elements of an array.
+ */
+struct LoopIdiom {
+  jive::simple_node * Store = nullptr;
+
+  /**
+   * The load of the copied value, or nullptr if a loop-invariant value is stored.
+   */
+  jive::simple_node * Load = nullptr;
+
+  /**
+   * The loop variables of the memory states that are threaded through the load and store.
+   */
+  std::vector<jive::theta_output*> MemoryStates;
+
+  /**
+   * The argument that indexes the arrays. It is either the induction variable or its value from the previous iteration.
+   */
+  jive::argument * Index = nullptr;
+
+  /**
+   * The loop-invariant base addresses of the stored and loaded arrays.
+   */
+  jive::argument * StoreBase = nullptr;
+  jive::argument * LoadBase = nullptr;
+
+  /**
+   * The number of iterations, or zero if it is unknown before the loop is executed.
+   */
+  size_t NumIterations = 0;
+};
+
+/**
+ * Returns the size of \p type in bytes, or zero if it is not supported.
+ */
+static size_t
+GetTypeSize(const jive::type & type)
+{
+  if (auto bitType = dynamic_cast<const jive::bittype*>(&type))
+    return bitType->nbits() % 8 == 0 ? bitType->nbits() / 8 : 0;
+
+  if (auto floatingPointType = dynamic_cast<const fptype*>(&type)) {
+    switch (floatingPointType->size()) {
+      case fpsize::half: return 2;
+      case fpsize::flt: return 4;
+      case fpsize::dbl: return 8;
+      default: return 0;
+    }
+  }
+
+  if (is<PointerType>(type))
+    return 8;
+
+  return 0;
+}
+
+static bool
+IsInvariantArgument(const jive::output & output)
+{
+  auto argument = dynamic_cast<const jive::argument*>(&output);
+  return argument
+         && is<jive::theta_op>(argument->region()->node())
+         && jive::is_invariant(static_cast<const jive::theta_input*>(argument->input()));
+}
+
+static const jive::bitconstant_op *
+GetBitConstant(const jive::output & output)
+{
+  auto node = jive::node_output::node(&output);
+  return node ? dynamic_cast<const jive::bitconstant_op*>(&node->operation()) : nullptr;
+}
+
+/**
+ * Returns the byte of which \p value consists, or -1 if the bytes differ.
+ */
+static int
+GetUniformByte(const jive::bitvalue_repr & value)
+{
+  if (value.nbits() > 64 || !value.is_known())
+    return -1;
+
+  auto bits = value.to_uint();
+  auto byte = bits & 0xff;
+  for (size_t n = 8; n < value.nbits(); n += 8) {
+    if (((bits >> n) & 0xff) != byte)
+      return -1;
+  }
+
+  return (int)byte;
+}
+
+/**
+ * Returns the origin of the stored value \p value in the theta's region, or \p value itself if it is computed in the
+ * loop body.
+ */
+static jive::output *
+GetMemsetValue(jive::output & value)
+{
+  return IsInvariantArgument(value) ? static_cast<jive::argument*>(&value)->input()->origin() : &value;
+}
+
+/**
+ * Returns the base address if \p address is the address of the element indexed by \p index, and the base address is
+ * loop-invariant.
+ */
+static jive::argument *
+GetArrayBase(
+  const jive::output & address,
+  const jive::argument & index,
+  const jive::type & elementType)
+{
+  auto node = jive::node_output::node(&address);
+  auto gep = node ? dynamic_cast<const getelementptr_op*>(&node->operation()) : nullptr;
+  if (!gep
+      || gep->nindices() != 1
+      || gep->pointee_type() != elementType
+      || node->input(1)->origin() != &index
+      || !IsInvariantArgument(*node->input(0)->origin()))
+    return nullptr;
+
+  return static_cast<jive::argument*>(node->input(0)->origin());
+}
+
+/**
+ * Returns the origin of \p output by looking through the entry variables of gamma nodes.
+ */
+static const jive::output &
+GetGammaOrigin(const jive::output & output)
+{
+  auto origin = &output;
+  while (auto argument = dynamic_cast<const jive::argument*>(origin)) {
+    if (!is<jive::gamma_op>(argument->region()->node()))
+      break;
+
+    origin = argument->input()->origin();
+  }
+
+  return *origin;
+}
+
+/**
+ * Checks whether \p argument holds the value of the induction variable from the previous iteration. Theta-gamma
+ * inversion introduces such loop variables when it peels the last iteration of a loop.
+ */
+static bool
+IsPreviousInductionValue(
+  const jive::argument & argument,
+  const unrollinfo & unrollInfo)
+{
+  auto loopVariable = dynamic_cast<const jive::theta_input*>(argument.input());
+  if (!loopVariable
+      || argument.region() != unrollInfo.theta()->subregion()
+      || loopVariable->output()->result()->origin() != unrollInfo.idv())
+    return false;
+
+  /*
+   * The induction variable's start value must be one larger.
+   */
+  auto init = &GetGammaOrigin(*loopVariable->origin());
+  auto idvInit = &GetGammaOrigin(*unrollInfo.init());
+  auto initConstant = GetBitConstant(*init);
+  auto idvInitConstant = GetBitConstant(*idvInit);
+  if (initConstant && idvInitConstant)
+    return idvInitConstant->value() == initConstant->value().add({initConstant->value().nbits(), (int64_t)1});
+
+  auto node = jive::node_output::node(idvInit);
+  if (!is<jive::bitadd_op>(node))
+    return false;
+
+  auto isOne = [](const jive::output & output)
+  {
+    auto constant = GetBitConstant(output);
+    return constant && constant->value().to_uint() == 1;
+  };
+
+  auto operand0 = &GetGammaOrigin(*node->input(0)->origin());
+  auto operand1 = &GetGammaOrigin(*node->input(1)->origin());
+  return (operand0 == init && isOne(*operand1)) || (operand1 == init && isOne(*operand0));
+}
+
+/**
+ * Returns the argument that indexes the array \p address points into, or nullptr if it is neither the induction
+ * variable nor its value from the previous iteration.
+ */
+static jive::argument *
+GetIndex(
+  const jive::output & address,
+  const unrollinfo & unrollInfo)
+{
+  auto node = jive::node_output::node(&address);
+  if (!is<getelementptr_op>(node) || node->ninputs() != 2)
+    return nullptr;
+
+  auto index = dynamic_cast<jive::argument*>(node->input(1)->origin());
+  if (!index || (index != unrollInfo.idv() && !IsPreviousInductionValue(*index, unrollInfo)))
+    return nullptr;
+
+  return index;
+}
+
+/**
+ * Returns the object \p address points into by looking through address computations and the routing of gamma and
+ * theta nodes.
+ */
+static const jive::output &
+GetBaseObject(const jive::output & address)
+{
+  auto origin = &address;
+  while (true) {
+    if (auto argument = dynamic_cast<const jive::argument*>(origin)) {
+      auto structuralNode = argument->region()->node();
+      if (is<jive::gamma_op>(structuralNode) || IsInvariantArgument(*argument)) {
+        origin = argument->input()->origin();
+        continue;
+      }
+
+      return *origin;
+    }
+
+    auto node = jive::node_output::node(origin);
+    if (!is<getelementptr_op>(node) && !is<bitcast_op>(node))
+      return *origin;
+
+    origin = node->input(0)->origin();
+  }
+}
+
+static bool
+IsNoAliasArgument(const jive::output & output)
+{
+  auto argument = dynamic_cast<const lambda::fctargument*>(&output);
+  if (!argument)
+    return false;
+
+  for (auto & attribute : argument->attributes()) {
+    auto enumAttribute = dynamic_cast<const enum_attribute*>(&attribute);
+    if (enumAttribute && enumAttribute->kind() == attribute::kind::no_alias)
+      return true;
+  }
+
+  return false;
+}
+
+static bool
+AreDisjoint(
+  const jive::output & object1,
+  const jive::output & object2)
+{
+  if (&object1 == &object2)
+    return false;
+
+  if (IsNoAliasArgument(object1) || IsNoAliasArgument(object2))
+    return true;
+
+  return is<alloca_op>(jive::node_output::node(&object1))
+         && is<alloca_op>(jive::node_output::node(&object2));
+}
+
+static bool
+HasStateType(const jive::node & node)
+{
+  auto isState = [](const jive::type & type)
+  {
+    return is<MemoryStateType>(type) || is<iostatetype>(type);
+  };
+
+  for (size_t n = 0; n < node.ninputs(); n++) {
+    if (isState(node.input(n)->type()))
+      return true;
+  }
+
+  for (size_t n = 0; n < node.noutputs(); n++) {
+    if (isState(node.output(n)->type()))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Returns the memory state output of \p node that corresponds to its memory state input \p input.
+ */
+static jive::output *
+GetMemoryStateOutput(
+  const jive::node & node,
+  const jive::input & input)
+{
+  return is<StoreOperation>(&node) ? node.output(input.index() - 2) : node.output(input.index());
+}
+
+/**
+ * Checks that the memory state of \p loopVariable is threaded through the load and store of \p idiom without any other
+ * users. Returns the number of load and store memory states on the way.
+ */
+static bool
+IsThreadedThrough(
+  const jive::theta_output & loopVariable,
+  const LoopIdiom & idiom,
+  size_t & numStates)
+{
+  jive::output * state = loopVariable.argument();
+  while (true) {
+    if (state->nusers() != 1)
+      return false;
+
+    auto user = *state->begin();
+    if (user == loopVariable.result())
+      return true;
+
+    auto node = input_node(user);
+    if (!node || (node != idiom.Store && node != idiom.Load))
+      return false;
+
+    state = GetMemoryStateOutput(*node, *user);
+    numStates++;
+  }
+}
+
+static bool
+Match(
+  jive::theta_node & theta,
+  const unrollinfo & unrollInfo,
+  LoopIdiom & idiom)
+{
+  /*
+   * Check induction variable
+   */
+  auto idv = unrollInfo.idv();
+  auto idvType = dynamic_cast<const jive::bittype*>(&idv->type());
+  if (!unrollInfo.is_additive()
+      || !unrollInfo.has_known_step()
+      || unrollInfo.step_value()->to_uint() != 1
+      || !idvType || (idvType->nbits() != 32 && idvType->nbits() != 64))
+    return false;
+
+  /*
+   * The number of iterations is computed for loops that repeat while the comparison is true.
+   */
+  auto matchNode = jive::node_output::node(theta.predicate()->origin());
+  auto matchOperation = dynamic_cast<const jive::match_op*>(&matchNode->operation());
+  if (!matchOperation
+      || matchOperation->nbits() != 1
+      || matchOperation->alternative(0) != 0
+      || matchOperation->alternative(1) != 1)
+    return false;
+
+  if (unrollInfo.is_known()) {
+    auto numIterations = unrollInfo.niterations();
+    if (!numIterations || *numIterations == 0)
+      return false;
+
+    idiom.NumIterations = numIterations->to_uint();
+  } else {
+    /*
+     * The number of iterations is only computed for loops that execute until the incremented induction variable
+     * reaches the end value.
+     */
+    auto cmpNode = unrollInfo.cmpnode();
+    if ((!is<jive::bitult_op>(cmpNode) && !is<jive::bitslt_op>(cmpNode))
+        || cmpNode->input(0)->origin() != unrollInfo.armnode()->output(0)
+        || cmpNode->input(1)->origin() != unrollInfo.end())
+      return false;
+  }
+
+  /*
+   * Check that the loop contains a single store and at most one load, but no other operations with side effects.
+   */
+  for (auto & node : theta.subregion()->nodes) {
+    if (is<StoreOperation>(&node)) {
+      if (idiom.Store)
+        return false;
+      idiom.Store = static_cast<jive::simple_node*>(&node);
+    } else if (is<LoadOperation>(&node)) {
+      if (idiom.Load)
+        return false;
+      idiom.Load = static_cast<jive::simple_node*>(&node);
+    } else if (!dynamic_cast<jive::simple_node*>(&node) || HasStateType(node)) {
+      return false;
+    }
+  }
+
+  if (!idiom.Store)
+    return false;
+
+  /*
+   * Check store address
+   */
+  auto & valueType = idiom.Store->input(1)->type();
+  auto & storeAddress = *idiom.Store->input(0)->origin();
+  idiom.Index = GetIndex(storeAddress, unrollInfo);
+  if (!idiom.Index)
+    return false;
+
+  idiom.StoreBase = GetArrayBase(storeAddress, *idiom.Index, valueType);
+  if (!idiom.StoreBase || GetTypeSize(valueType) == 0)
+    return false;
+
+  /*
+   * Check loop variables
+   */
+  size_t numStates = 0;
+  for (auto loopVariable : theta) {
+    if (loopVariable->argument() == idv || loopVariable->argument() == idiom.Index || jive::is_invariant(loopVariable))
+      continue;
+
+    if (!is<MemoryStateType>(loopVariable->type()) || !IsThreadedThrough(*loopVariable, idiom, numStates))
+      return false;
+
+    idiom.MemoryStates.push_back(loopVariable);
+  }
+
+  if (numStates != idiom.Store->ninputs() - 2 + (idiom.Load ? idiom.Load->ninputs() - 1 : 0))
+    return false;
+
+  /*
+   * Check stored value
+   */
+
+  auto value = idiom.Store->input(1)->origin();
+  if (!idiom.Load) {
+    auto constant = GetBitConstant(*GetMemsetValue(*value));
+    return (constant && GetUniformByte(constant->value()) >= 0)
+           || (IsInvariantArgument(*value) && valueType == jive::bit8);
+  }
+
+  idiom.LoadBase = GetArrayBase(*idiom.Load->input(0)->origin(), *idiom.Index, valueType);
+  return value == idiom.Load->output(0)
+         && value->nusers() == 1
+         && idiom.LoadBase
+         && AreDisjoint(GetBaseObject(*idiom.StoreBase), GetBaseObject(*idiom.LoadBase));
+}
+
+/**
+ * Returns the address of the first element of the array \p base that is accessed by the theta node.
+ */
+static jive::output *
+CreateStartAddress(
+  const jive::argument & base,
+  const jive::argument & index)
+{
+  auto address = getelementptr_op::create(base.input()->origin(), {index.input()->origin()}, base.type());
+
+  return bitcast_op::create(address, PointerType(jive::bit8));
+}
+
+static jive::output *
+CreateNumIterations(
+  const LoopIdiom & idiom,
+  const unrollinfo & unrollInfo)
+{
+  auto & region = *unrollInfo.theta()->region();
+  auto nbits = unrollInfo.nbits();
+
+  if (idiom.NumIterations != 0)
+    return jive::create_bitconstant(&region, nbits, idiom.NumIterations);
+
+  /*
+   * The loop body is executed at least once.
+   */
+  auto init = unrollInfo.init();
+  auto end = unrollInfo.end()->input()->origin();
+  auto & cmpOperation = *AssertedCast<const jive::simple_op>(&unrollInfo.cmpnode()->operation());
+
+  auto isEntered = jive::simple_node::create_normalized(&region, cmpOperation, {init, end})[0];
+  auto difference = jive::bitsub_op::create(nbits, end, init);
+  auto one = jive::create_bitconstant(&region, nbits, 1);
+  return jive::simple_node::create_normalized(&region, select_op(difference->type()), {isEntered, difference, one})[0];
+}
+
+static void
+Replace(
+  jive::theta_node & theta,
+  const LoopIdiom & idiom,
+  const unrollinfo & unrollInfo)
+{
+  auto & region = *theta.region();
+  auto isVolatile = jive::create_bitconstant(&region, 1, 0);
+  auto nbits = unrollInfo.nbits();
+  auto numIterations = CreateNumIterations(idiom, unrollInfo);
+  auto size = jive::create_bitconstant(&region, nbits, GetTypeSize(idiom.Store->input(1)->type()));
+  auto length = jive::bitmul_op::create(nbits, numIterations, size);
+  auto destination = CreateStartAddress(*idiom.StoreBase, *idiom.Index);
+
+  std::vector<jive::output*> states;
+  for (auto & loopVariable : idiom.MemoryStates)
+    states.push_back(loopVariable->input()->origin());
+
+  std::vector<jive::output*> outputs;
+  if (idiom.Load) {
+    auto source = CreateStartAddress(*idiom.LoadBase, *idiom.Index);
+    outputs = Memcpy::create(destination, source, length, isVolatile, states);
+  } else {
+    auto value = GetMemsetValue(*idiom.Store->input(1)->origin());
+    auto constant = GetBitConstant(*value);
+    auto byte = constant ? jive::create_bitconstant(&region, 8, GetUniformByte(constant->value())) : value;
+    outputs = Memset::create(destination, byte, length, isVolatile, states);
+  }
+
+  for (size_t n = 0; n < idiom.MemoryStates.size(); n++)
+    idiom.MemoryStates[n]->divert_users(outputs[n]);
+
+  /*
+   * The induction variable is incremented once per iteration. If the arrays are indexed by the induction variable's
+   * value from the previous iteration, then this value lags behind by one.
+   */
+  for (auto argument : {unrollInfo.idv(), idiom.Index}) {
+    auto output = static_cast<jive::theta_input*>(argument->input())->output();
+    if (output->nusers() != 0)
+      output->divert_users(jive::bitadd_op::create(nbits, argument->input()->origin(), numIterations));
+  }
+
+  for (auto loopVariable : theta) {
+    if (jive::is_invariant(loopVariable))
+      loopVariable->divert_users(loopVariable->input()->origin());
+  }
+
+  remove(&theta);
+}
+
+static void
+CollectThetas(
+  jive::region & region,
+  std::vector<jive::theta_node*> & thetas)
+{
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<jive::structural_node*>(&node)) {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectThetas(*structuralNode->subregion(n), thetas);
+    }
+
+    if (auto theta = dynamic_cast<jive::theta_node*>(&node))
+      thetas.push_back(theta);
+  }
+}
+
+LoopIdiomRecognition::~LoopIdiomRecognition()
+= default;
+
+void
+LoopIdiomRecognition::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  LoopIdiomRecognitionStatistics statistics(rvsdgModule.SourceFileName());
+  statistics.Start();
+
+  std::vector<jive::theta_node*> thetas;
+  CollectThetas(*rvsdgModule.Rvsdg().root(), thetas);
+
+  size_t numMemsets = 0, numMemcpys = 0;
+  for (auto & theta : thetas) {
+    auto unrollInfo = unrollinfo::create(theta);
+    LoopIdiom idiom;
+    if (!unrollInfo || !Match(*theta, *unrollInfo, idiom))
+      continue;
+
+    idiom.Load ? numMemcpys++ : numMemsets++;
+    Replace(*theta, idiom, *unrollInfo);
+  }
+
+  statistics.Stop(numMemsets, numMemcpys);
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
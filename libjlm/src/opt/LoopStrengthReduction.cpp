@@ -0,0 +1,558 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/getelementptr.hpp>
+#include <jlm/ir/operators/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/LoopStrengthReduction.hpp>
+#include <jlm/opt/unroll.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <deque>
+
+namespace jlm {
+
+class LoopStrengthReductionStatistics final : public Statistics {
+public:
+  ~LoopStrengthReductionStatistics() override
+  = default;
+
+  explicit
+  LoopStrengthReductionStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::LoopStrengthReduction)
+    , NumMultiplications_(0)
+    , NumAddresses_(0)
+    , NumPredicates_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    size_t numMultiplications,
+    size_t numAddresses,
+    size_t numPredicates) noexcept
+  {
+    Timer_.stop();
+    NumMultiplications_ = numMultiplications;
+    NumAddresses_ = numAddresses;
+    NumPredicates_ = numPredicates;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("LoopStrengthReduction ",
+                  SourceFile_.to_str(), " ",
+                  "#ReducedMultiplications:", NumMultiplications_, " ",
+                  "#ReducedAddresses:", NumAddresses_, " ",
+                  "#ReplacedPredicates:", NumPredicates_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumMultiplications_;
+  size_t NumAddresses_;
+  size_t NumPredicates_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+enum class DerivedVariableKind {
+  Induction,
+  Multiplication,
+  Address
+};
+
+/**
+ * A loop variable whose value is a linear function of an induction variable.
+ */
+struct DerivedVariable {
+  DerivedVariableKind Kind;
+  jive::theta_output * LoopVar;
+
+  /**
+   * The variable this variable is derived from, or nullptr for an induction variable of the original loop.
+   */
+  const DerivedVariable * Parent;
+
+  /**
+   * The invariant operands of the reduced multiplication or getelementptr in the region of the theta node, without
+   * the operand that is derived from the parent.
+   */
+  std::vector<jive::output*> Operands;
+};
+
+struct LoopStrengthReductionContext {
+  bool ComparePointers;
+  size_t NumMultiplications = 0;
+  size_t NumAddresses = 0;
+  size_t NumPredicates = 0;
+};
+
+static jive::node *
+GetInputNode(const jive::input & input)
+{
+  auto simpleInput = dynamic_cast<const jive::simple_input*>(&input);
+  return simpleInput ? simpleInput->node() : nullptr;
+}
+
+static bool
+IsThetaInvariant(const jive::output & output)
+{
+  if (jive::is<jive::bitconstant_op>(jive::node_output::node(&output)))
+    return true;
+
+  auto argument = dynamic_cast<const jive::argument*>(&output);
+  if (argument == nullptr || argument->input() == nullptr)
+    return false;
+
+  return jive::is_invariant(static_cast<const jive::theta_input*>(argument->input()));
+}
+
+/**
+ * Returns the value of the theta invariant \p output in the region of the theta node.
+ */
+static jive::output *
+GetOuterValue(
+  jive::theta_node & theta,
+  jive::output & output)
+{
+  JLM_ASSERT(IsThetaInvariant(output));
+
+  if (auto argument = dynamic_cast<jive::argument*>(&output))
+    return argument->input()->origin();
+
+  auto node = jive::node_output::node(&output);
+  return node->copy(theta.region(), {})->output(0);
+}
+
+/**
+ * Returns the step of the induction variable \p loopVar, i.e., the invariant operand of the addition that updates
+ * the loop variable.
+ */
+static jive::output *
+GetStep(const jive::theta_output & loopVar)
+{
+  auto node = jive::node_output::node(loopVar.result()->origin());
+  if (!jive::is<jive::bitadd_op>(node) || node->ninputs() != 2)
+    return nullptr;
+
+  auto argument = loopVar.argument();
+  auto o0 = node->input(0)->origin();
+  auto o1 = node->input(1)->origin();
+  if (o0 == argument && o1 != argument && IsThetaInvariant(*o1))
+    return o1;
+  if (o1 == argument && o0 != argument && IsThetaInvariant(*o0))
+    return o0;
+
+  return nullptr;
+}
+
+static const jive::bitvalue_repr *
+GetConstantValue(const jive::output & output)
+{
+  auto node = jive::node_output::node(&output);
+  auto constant = node ? dynamic_cast<const jive::bitconstant_op*>(&node->operation()) : nullptr;
+  return constant && constant->value().is_known() ? &constant->value() : nullptr;
+}
+
+/**
+ * Replaces the multiplication \p node of the induction variable \p variable with a new induction variable.
+ */
+static void
+ReduceMultiplication(
+  jive::node & node,
+  const DerivedVariable & variable,
+  std::deque<DerivedVariable> & variables)
+{
+  auto & theta = *static_cast<jive::theta_node*>(node.region()->node());
+  auto argument = variable.LoopVar->argument();
+
+  auto factor = node.input(0)->origin() == argument ? node.input(1)->origin() : node.input(0)->origin();
+  auto nbits = static_cast<const jive::bitmul_op*>(&node.operation())->type().nbits();
+
+  auto outerInit = variable.LoopVar->input()->origin();
+  auto outerStep = GetOuterValue(theta, *GetStep(*variable.LoopVar));
+  auto outerFactor = GetOuterValue(theta, *factor);
+
+  auto init = jive::bitmul_op::create(nbits, outerInit, outerFactor);
+  auto stride = jive::bitmul_op::create(nbits, outerStep, outerFactor);
+
+  auto loopVar = theta.add_loopvar(init);
+  auto strideArgument = theta.add_loopvar(stride)->argument();
+  loopVar->result()->divert_to(jive::bitadd_op::create(nbits, loopVar->argument(), strideArgument));
+  node.output(0)->divert_users(loopVar->argument());
+
+  variables.push_back({DerivedVariableKind::Multiplication, loopVar, &variable, {outerFactor}});
+}
+
+/**
+ * Replaces the getelementptr \p node, whose last index is the induction variable \p variable, with a pointer loop
+ * variable.
+ */
+static void
+ReduceAddress(
+  jive::node & node,
+  const DerivedVariable & variable,
+  std::deque<DerivedVariable> & variables)
+{
+  auto & theta = *static_cast<jive::theta_node*>(node.region()->node());
+  auto & type = node.output(0)->type();
+
+  std::vector<jive::output*> outerOperands;
+  for (size_t n = 0; n < node.ninputs()-1; n++)
+    outerOperands.push_back(GetOuterValue(theta, *node.input(n)->origin()));
+
+  std::vector<jive::output*> indices(std::next(outerOperands.begin()), outerOperands.end());
+  indices.push_back(variable.LoopVar->input()->origin());
+  auto init = getelementptr_op::create(outerOperands[0], indices, type);
+
+  auto loopVar = theta.add_loopvar(init);
+  auto step = GetStep(*variable.LoopVar);
+  loopVar->result()->divert_to(getelementptr_op::create(loopVar->argument(), {step}, type));
+  node.output(0)->divert_users(loopVar->argument());
+
+  variables.push_back({DerivedVariableKind::Address, loopVar, &variable, outerOperands});
+}
+
+static bool
+IsReducibleMultiplication(
+  const jive::node & node,
+  const jive::output & argument)
+{
+  if (!jive::is<jive::bitmul_op>(&node) || node.ninputs() != 2)
+    return false;
+
+  auto o0 = node.input(0)->origin();
+  auto o1 = node.input(1)->origin();
+  return (o0 == &argument && o1 != &argument && IsThetaInvariant(*o1))
+      || (o1 == &argument && o0 != &argument && IsThetaInvariant(*o0));
+}
+
+static bool
+IsReducibleAddress(
+  const jive::node & node,
+  const jive::output & argument)
+{
+  if (!jive::is<getelementptr_op>(&node))
+    return false;
+
+  auto nindices = static_cast<const getelementptr_op*>(&node.operation())->nindices();
+  if (nindices == 0 || node.input(nindices)->origin() != &argument)
+    return false;
+
+  for (size_t n = 0; n < nindices; n++) {
+    auto origin = node.input(n)->origin();
+    if (origin == &argument || !IsThetaInvariant(*origin))
+      return false;
+  }
+
+  return true;
+}
+
+static void
+ReduceDerivedExpressions(
+  jive::theta_node & theta,
+  std::deque<DerivedVariable> & variables,
+  LoopStrengthReductionContext & context)
+{
+  for (auto loopVar : theta) {
+    if (GetStep(*loopVar) != nullptr)
+      variables.push_back({DerivedVariableKind::Induction, loopVar, nullptr, {}});
+  }
+
+  /*
+   * The reduced multiplications are induction variables themselves and are appended to the variables.
+   */
+  for (size_t n = 0; n < variables.size(); n++) {
+    auto & variable = variables[n];
+    if (variable.Kind == DerivedVariableKind::Address)
+      continue;
+
+    auto argument = variable.LoopVar->argument();
+    std::vector<jive::input*> users(argument->begin(), argument->end());
+    for (auto & user : users) {
+      auto node = GetInputNode(*user);
+      if (node == nullptr)
+        continue;
+
+      if (IsReducibleMultiplication(*node, *argument)) {
+        ReduceMultiplication(*node, variable, variables);
+        context.NumMultiplications++;
+      } else if (IsReducibleAddress(*node, *argument)) {
+        ReduceAddress(*node, variable, variables);
+        context.NumAddresses++;
+      }
+    }
+  }
+}
+
+static bool
+HasOnlyUsers(
+  const jive::output & output,
+  const std::vector<const jive::input*> & users)
+{
+  for (auto & user : output) {
+    if (std::find(users.begin(), users.end(), user) == users.end())
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Checks whether the distance between the first and the last value of \p variable in the \p niterations iterations
+ * of the loop fits into the bits of the variable, such that its values in different iterations are distinct.
+ */
+static bool
+IsInjective(
+  const DerivedVariable & variable,
+  const jive::bitvalue_repr & niterations,
+  const jive::bitvalue_repr & step)
+{
+  auto nbits = step.nbits();
+  auto fits = [&](const jive::bitvalue_repr & value)
+  {
+    return value == value.slice(0, nbits).sext(nbits);
+  };
+
+  auto distance = niterations.zext(nbits).mul(step.sext(nbits));
+  if (!fits(distance))
+    return false;
+
+  for (auto v = &variable; v->Parent != nullptr; v = v->Parent) {
+    if (v->Kind != DerivedVariableKind::Multiplication)
+      continue;
+
+    auto factor = GetConstantValue(*v->Operands[0]);
+    if (factor == nullptr)
+      return false;
+
+    distance = distance.mul(factor->sext(nbits));
+    if (!fits(distance))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Computes the value of \p variable for the value \p end of the induction variable. The factors of all reduced
+ * multiplications are constants (see IsInjective()).
+ */
+static jive::bitvalue_repr
+ComputeEndValue(
+  const DerivedVariable & variable,
+  const jive::bitvalue_repr & end)
+{
+  if (variable.Kind == DerivedVariableKind::Induction)
+    return end;
+
+  JLM_ASSERT(variable.Kind == DerivedVariableKind::Multiplication);
+  return ComputeEndValue(*variable.Parent, end).mul(*GetConstantValue(*variable.Operands[0]));
+}
+
+/**
+ * Computes the value of \p variable in the loop body for the value \p end of the induction variable.
+ */
+static jive::output *
+ComputeEnd(
+  jive::theta_node & theta,
+  const DerivedVariable & variable,
+  const jive::bitvalue_repr & end)
+{
+  if (variable.Kind != DerivedVariableKind::Address)
+    return jive::create_bitconstant(theta.subregion(), ComputeEndValue(variable, end));
+
+  std::vector<jive::output*> indices(std::next(variable.Operands.begin()), variable.Operands.end());
+  indices.push_back(jive::create_bitconstant(theta.region(), ComputeEndValue(*variable.Parent, end)));
+  auto address = getelementptr_op::create(variable.Operands[0], indices, variable.LoopVar->type());
+
+  return theta.add_loopvar(address)->argument();
+}
+
+/**
+ * Returns the alternative of the theta predicate for the value \p next of the induction variable in \p info.
+ */
+static size_t
+EvaluatePredicate(
+  const unrollinfo & info,
+  const jive::bitvalue_repr & next)
+{
+  auto & cmpOperation = *static_cast<const jive::bitcompare_op*>(&info.cmpoperation());
+  auto & end = *info.end_value();
+  auto result = info.cmpnode()->input(0)->origin() == info.armnode()->output(0)
+    ? cmpOperation.reduce_constants(next, end)
+    : cmpOperation.reduce_constants(end, next);
+  JLM_ASSERT(result != jive::compare_result::undecidable);
+
+  auto matchNode = jive::node_output::node(info.theta()->predicate()->origin());
+  auto & matchOperation = *static_cast<const jive::match_op*>(&matchNode->operation());
+  return matchOperation.alternative(result == jive::compare_result::static_true ? 1 : 0);
+}
+
+/**
+ * Replaces the theta predicate, which tests the induction variable \p variable, with a test of the derived variable
+ * \p derived.
+ */
+static bool
+ReplacePredicate(
+  jive::theta_node & theta,
+  const DerivedVariable & variable,
+  const DerivedVariable & derived)
+{
+  auto info = unrollinfo::create(&theta);
+  if (!info || !info->is_additive() || info->idv() != variable.LoopVar->argument())
+    return false;
+
+  auto niterations = info->niterations();
+  if (!niterations || *niterations == 0)
+    return false;
+
+  auto & init = *info->init_value();
+  auto & step = *info->step_value();
+  if (!IsInjective(derived, *niterations, step))
+    return false;
+
+  /*
+   * Check that the loop exits in the last iteration and continues in the iteration before.
+   */
+  auto end = init.add(niterations->mul(step));
+  if (EvaluatePredicate(*info, end) != 0)
+    return false;
+  if (*niterations != 1 && EvaluatePredicate(*info, end.sub(step)) != 1)
+    return false;
+
+  auto derivedEnd = ComputeEnd(theta, derived, end);
+
+  auto next = derived.LoopVar->result()->origin();
+  jive::output * cmp = nullptr;
+  if (auto pointerType = dynamic_cast<const PointerType*>(&next->type())) {
+    ptrcmp_op operation(*pointerType, cmp::ne);
+    cmp = jive::simple_node::create_normalized(theta.subregion(), operation, {next, derivedEnd})[0];
+  } else {
+    cmp = jive::bitne_op::create(step.nbits(), next, derivedEnd);
+  }
+
+  theta.set_predicate(jive::match(1, {{1, 1}}, 0, 2, cmp));
+  return true;
+}
+
+/**
+ * Replaces the theta predicate with a test of a derived variable if the predicate is the only remaining use of an
+ * induction variable.
+ */
+static void
+ReplaceLinearFunctionTest(
+  jive::theta_node & theta,
+  const std::deque<DerivedVariable> & variables,
+  LoopStrengthReductionContext & context)
+{
+  auto matchNode = jive::node_output::node(theta.predicate()->origin());
+  if (!jive::is<jive::match_op>(matchNode) || matchNode->output(0)->nusers() != 1)
+    return;
+
+  auto cmpNode = jive::node_output::node(matchNode->input(0)->origin());
+  if (!jive::is<jive::bitcompare_op>(cmpNode) || cmpNode->output(0)->nusers() != 1)
+    return;
+
+  for (auto & variable : variables) {
+    if (variable.Kind != DerivedVariableKind::Induction || variable.LoopVar->nusers() != 0)
+      continue;
+
+    auto arm = jive::node_output::node(variable.LoopVar->result()->origin());
+    if (!HasOnlyUsers(*variable.LoopVar->argument(), {arm->input(0), arm->input(1)})
+        || !HasOnlyUsers(*arm->output(0), {variable.LoopVar->result(), cmpNode->input(0), cmpNode->input(1)}))
+      continue;
+
+    /*
+     * Select a derived variable that is used by other nodes than its own update.
+     */
+    for (auto & derived : variables) {
+      if (derived.Parent == nullptr)
+        continue;
+
+      auto update = jive::node_output::node(derived.LoopVar->result()->origin());
+      auto argument = derived.LoopVar->argument();
+      if (HasOnlyUsers(*argument, {update->input(0), update->input(1)}))
+        continue;
+
+      auto ancestor = &derived;
+      while (ancestor->Parent != nullptr)
+        ancestor = ancestor->Parent;
+      if (ancestor != &variable)
+        continue;
+
+      if (!context.ComparePointers && derived.Kind == DerivedVariableKind::Address)
+        continue;
+
+      if (ReplacePredicate(theta, variable, derived)) {
+        context.NumPredicates++;
+        return;
+      }
+    }
+  }
+}
+
+static void
+ReduceStrength(
+  jive::region & region,
+  LoopStrengthReductionContext & context)
+{
+  for (auto & node : region.nodes) {
+    auto structuralNode = dynamic_cast<jive::structural_node*>(&node);
+    if (structuralNode == nullptr)
+      continue;
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      ReduceStrength(*structuralNode->subregion(n), context);
+
+    if (auto theta = dynamic_cast<jive::theta_node*>(structuralNode)) {
+      std::deque<DerivedVariable> variables;
+      ReduceDerivedExpressions(*theta, variables, context);
+      /*
+       * Remove the reduced expressions, such that the induction variables are only used by their updates and the
+       * predicate.
+       */
+      theta->subregion()->prune(false);
+      ReplaceLinearFunctionTest(*theta, variables, context);
+    }
+  }
+}
+
+LoopStrengthReduction::~LoopStrengthReduction()
+= default;
+
+void
+LoopStrengthReduction::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  LoopStrengthReductionStatistics statistics(rvsdgModule.SourceFileName());
+
+  statistics.Start();
+  LoopStrengthReductionContext context;
+  context.ComparePointers = ComparePointers_;
+  ReduceStrength(*rvsdgModule.Rvsdg().root(), context);
+  statistics.Stop(context.NumMultiplications, context.NumAddresses, context.NumPredicates);
+
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
@@ -0,0 +1,845 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/SlpVectorizer.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/structural-node.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm {
+
+class SlpVectorizerStatistics final : public Statistics {
+public:
+  ~SlpVectorizerStatistics() override
+  = default;
+
+  explicit
+  SlpVectorizerStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::SlpVectorizer)
+    , NumSeedGroups_(0)
+    , NumVectorizedGroups_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    size_t numSeedGroups,
+    size_t numVectorizedGroups) noexcept
+  {
+    Timer_.stop();
+    NumSeedGroups_ = numSeedGroups;
+    NumVectorizedGroups_ = numVectorizedGroups;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("SlpVectorizer ",
+                  SourceFile_.to_str(), " ",
+                  "#SeedGroups:", NumSeedGroups_, " ",
+                  "#VectorizedGroups:", NumVectorizedGroups_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumSeedGroups_;
+  size_t NumVectorizedGroups_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+/**
+ * The width of the target's vector registers in bits.
+ */
+static const size_t VectorRegisterWidth = 128;
+
+/**
+ * Returns the number of elements of type \p type that fit into a vector register, or zero if values of \p type are
+ * not vectorized.
+ */
+static size_t
+GetVectorizationFactor(const jive::type & type)
+{
+  size_t width = 0;
+  if (auto bitType = dynamic_cast<const jive::bittype*>(&type)) {
+    width = bitType->nbits();
+  } else if (auto floatingPointType = dynamic_cast<const fptype*>(&type)) {
+    switch (floatingPointType->size()) {
+      case fpsize::half: width = 16; break;
+      case fpsize::flt: width = 32; break;
+      case fpsize::dbl: width = 64; break;
+      default: break;
+    }
+  }
+
+  if (width != 8 && width != 16 && width != 32 && width != 64)
+    return 0;
+
+  return VectorRegisterWidth / width;
+}
+
+static const jive::bitconstant_op *
+GetBitConstant(const jive::output & output)
+{
+  auto node = jive::node_output::node(&output);
+  return node ? dynamic_cast<const jive::bitconstant_op*>(&node->operation()) : nullptr;
+}
+
+/**
+ * The address of an array element, split into a key and a constant element offset. Two addresses with the same key
+ * refer to adjacent elements if their offsets differ by one.
+ */
+struct ElementAddress {
+  /**
+   * The base address, all but the last index, and the non-constant part of the last index of a getelementptr node.
+   */
+  std::vector<const jive::output*> Key;
+
+  int64_t Offset;
+};
+
+/**
+ * Splits \p address into an ElementAddress if it is the result of a getelementptr node that computes the address of
+ * an element of type \p elementType. The last index is split into a non-constant part and a constant offset by looking
+ * through additions of constants.
+ */
+static bool
+GetElementAddress(
+  const jive::output & address,
+  const jive::type & elementType,
+  ElementAddress & elementAddress)
+{
+  auto node = jive::node_output::node(&address);
+  auto gep = node ? dynamic_cast<const getelementptr_op*>(&node->operation()) : nullptr;
+  if (!gep)
+    return false;
+
+  if (gep->nindices() == 1) {
+    if (gep->pointee_type() != elementType)
+      return false;
+  } else if (gep->nindices() == 2) {
+    auto arrayType = dynamic_cast<const arraytype*>(&gep->pointee_type());
+    if (!arrayType || arrayType->element_type() != elementType)
+      return false;
+  } else {
+    return false;
+  }
+
+  elementAddress.Key.clear();
+  for (size_t n = 0; n < node->ninputs()-1; n++)
+    elementAddress.Key.push_back(node->input(n)->origin());
+
+  const jive::output * index = node->input(node->ninputs()-1)->origin();
+  elementAddress.Offset = 0;
+  while (index) {
+    if (auto constant = GetBitConstant(*index)) {
+      elementAddress.Offset += constant->value().to_int();
+      index = nullptr;
+      break;
+    }
+
+    auto indexNode = jive::node_output::node(index);
+    if (!is<jive::bitadd_op>(indexNode))
+      break;
+
+    if (auto constant = GetBitConstant(*indexNode->input(1)->origin())) {
+      elementAddress.Offset += constant->value().to_int();
+      index = indexNode->input(0)->origin();
+    } else if (auto constant = GetBitConstant(*indexNode->input(0)->origin())) {
+      elementAddress.Offset += constant->value().to_int();
+      index = indexNode->input(1)->origin();
+    } else {
+      break;
+    }
+  }
+  elementAddress.Key.push_back(index);
+
+  return true;
+}
+
+static size_t
+NumMemoryStates(const jive::node & node)
+{
+  if (auto storeNode = dynamic_cast<const StoreNode*>(&node))
+    return storeNode->NumStates();
+
+  return AssertedCast<const LoadNode>(&node)->NumStates();
+}
+
+static jive::input *
+GetMemoryStateInput(
+  const jive::node & node,
+  size_t n)
+{
+  return is<StoreOperation>(&node) ? node.input(n+2) : node.input(n+1);
+}
+
+static jive::output *
+GetMemoryStateOutput(
+  const jive::node & node,
+  size_t n)
+{
+  return is<StoreOperation>(&node) ? node.output(n) : node.output(n+1);
+}
+
+/**
+ * A node of an SLP tree. It combines one scalar value per lane into a vector.
+ */
+struct SlpTree {
+  enum class Kind {
+    /**
+     * The scalar values are inserted into a vector one by one.
+     */
+    Gather,
+
+    /**
+     * The scalar values are loaded from adjacent addresses.
+     */
+    Load,
+
+    /**
+     * The scalar values are computed by the same binary operation.
+     */
+    Operation
+  };
+
+  Kind kind;
+  std::vector<jive::output*> Values;
+  std::vector<std::unique_ptr<SlpTree>> Operands;
+
+  [[nodiscard]] jive::node *
+  Lane(size_t n) const noexcept
+  {
+    return jive::node_output::node(Values[n]);
+  }
+};
+
+static bool
+AreAdjacentLoads(const std::vector<jive::output*> & values)
+{
+  auto & loadNode = *AssertedCast<const LoadNode>(jive::node_output::node(values[0]));
+
+  ElementAddress address;
+  if (!GetElementAddress(*loadNode.GetAddressInput()->origin(), values[0]->type(), address))
+    return false;
+
+  for (size_t n = 1; n < values.size(); n++) {
+    auto laneNode = dynamic_cast<const LoadNode*>(jive::node_output::node(values[n]));
+    if (!laneNode || laneNode->NumStates() != loadNode.NumStates())
+      return false;
+
+    ElementAddress laneAddress;
+    if (!GetElementAddress(*laneNode->GetAddressInput()->origin(), values[n]->type(), laneAddress)
+        || laneAddress.Key != address.Key
+        || laneAddress.Offset != address.Offset + (int64_t)n)
+      return false;
+  }
+
+  return true;
+}
+
+static std::unique_ptr<SlpTree>
+BuildTree(const std::vector<jive::output*> & values)
+{
+  auto tree = std::make_unique<SlpTree>();
+  tree->kind = SlpTree::Kind::Gather;
+  tree->Values = values;
+
+  /*
+   * Every lane needs its own node, and the node must be used only by the lane of the parent tree node, such that all
+   * lane nodes can be removed after vectorization.
+   */
+  std::unordered_set<const jive::node*> nodes;
+  for (auto & value : values) {
+    auto node = jive::node_output::node(value);
+    if (!node || value->nusers() != 1 || !nodes.insert(node).second)
+      return tree;
+  }
+
+  auto & node = *tree->Lane(0);
+  if (is<LoadOperation>(&node)) {
+    if (AreAdjacentLoads(values))
+      tree->kind = SlpTree::Kind::Load;
+    return tree;
+  }
+
+  auto binaryOperation = dynamic_cast<const jive::binary_op*>(&node.operation());
+  if (!binaryOperation
+      || binaryOperation->argument(0).type() != values[0]->type()
+      || binaryOperation->argument(1).type() != values[0]->type())
+    return tree;
+
+  for (size_t n = 1; n < values.size(); n++) {
+    if (tree->Lane(n)->operation() != node.operation())
+      return tree;
+  }
+
+  tree->kind = SlpTree::Kind::Operation;
+  for (size_t n = 0; n < 2; n++) {
+    std::vector<jive::output*> operands;
+    for (auto & value : values)
+      operands.push_back(jive::node_output::node(value)->input(n)->origin());
+
+    tree->Operands.push_back(BuildTree(operands));
+  }
+
+  return tree;
+}
+
+/**
+ * Returns the number of operations of the vectorized tree minus the number of scalar operations it replaces.
+ */
+static int64_t
+GetCostDifference(const SlpTree & tree)
+{
+  auto numLanes = (int64_t)tree.Values.size();
+
+  switch (tree.kind) {
+    case SlpTree::Kind::Gather:
+    {
+      /*
+       * Vectors of constants are folded to a vector constant.
+       */
+      bool areConstants = std::all_of(tree.Values.begin(), tree.Values.end(), [](const jive::output * value) {
+        auto node = jive::node_output::node(value);
+        return node && is<jive::simple_op>(node) && node->ninputs() == 0;
+      });
+
+      return areConstants ? 1 : numLanes + 1;
+    }
+
+    case SlpTree::Kind::Load:
+      return 2 - numLanes;
+
+    case SlpTree::Kind::Operation:
+      return 1 - numLanes + GetCostDifference(*tree.Operands[0]) + GetCostDifference(*tree.Operands[1]);
+  }
+
+  JLM_UNREACHABLE("Unhandled tree kind.");
+}
+
+static void
+CollectTreeNodes(
+  const SlpTree & tree,
+  std::vector<const SlpTree*> & loadTrees,
+  std::vector<jive::output*> & leaves,
+  std::unordered_set<const jive::node*> & laneNodes)
+{
+  switch (tree.kind) {
+    case SlpTree::Kind::Gather:
+      leaves.insert(leaves.end(), tree.Values.begin(), tree.Values.end());
+      break;
+
+    case SlpTree::Kind::Load:
+      loadTrees.push_back(&tree);
+      leaves.push_back(tree.Lane(0)->input(0)->origin());
+      for (size_t n = 0; n < tree.Values.size(); n++)
+        laneNodes.insert(tree.Lane(n));
+      break;
+
+    case SlpTree::Kind::Operation:
+      for (size_t n = 0; n < tree.Values.size(); n++)
+        laneNodes.insert(tree.Lane(n));
+      CollectTreeNodes(*tree.Operands[0], loadTrees, leaves, laneNodes);
+      CollectTreeNodes(*tree.Operands[1], loadTrees, leaves, laneNodes);
+      break;
+  }
+}
+
+/**
+ * The loads of a load tree node or the stores of a seed group, together with the memory states they are
+ * vectorized with.
+ */
+struct MemoryGroup {
+  std::vector<jive::node*> Nodes;
+
+  /**
+   * The memory states of the first node of the memory state chain.
+   */
+  std::vector<jive::output*> Roots;
+
+  /**
+   * The last node of the memory state chain, whose memory states are used by other nodes.
+   */
+  jive::node * Last = nullptr;
+};
+
+/**
+ * Traces the memory states of \p node upwards through the nodes in \p members. Returns false if a member's state
+ * is routed to another state index.
+ */
+static bool
+TraceMemoryStates(
+  const jive::node & node,
+  const std::unordered_set<const jive::node*> & members,
+  std::vector<jive::output*> & roots)
+{
+  roots.clear();
+  for (size_t n = 0; n < NumMemoryStates(node); n++) {
+    auto origin = GetMemoryStateInput(node, n)->origin();
+    while (true) {
+      auto producer = jive::node_output::node(origin);
+      if (!producer || members.find(producer) == members.end())
+        break;
+
+      if (NumMemoryStates(*producer) <= n || GetMemoryStateOutput(*producer, n) != origin)
+        return false;
+
+      origin = GetMemoryStateInput(*producer, n)->origin();
+    }
+
+    roots.push_back(origin);
+  }
+
+  return true;
+}
+
+/**
+ * Returns the last node of the memory state chain formed by \p nodes, or nullptr if the nodes do not form a chain
+ * without other nodes in between. The states of all but the last node must each have a single user in \p scope,
+ * while the states of the last node must not be used in \p scope.
+ */
+static jive::node *
+GetLastNode(
+  const std::vector<jive::node*> & nodes,
+  const std::unordered_set<const jive::node*> & scope)
+{
+  jive::node * last = nullptr;
+  for (auto & node : nodes) {
+    size_t numInternal = 0, numExternal = 0;
+    for (size_t n = 0; n < NumMemoryStates(*node); n++) {
+      auto output = GetMemoryStateOutput(*node, n);
+
+      size_t numUsersInScope = 0;
+      for (auto & user : *output) {
+        if (scope.find(input_node(user)) != scope.end())
+          numUsersInScope++;
+      }
+
+      if (numUsersInScope == 0)
+        numExternal++;
+      else if (numUsersInScope == 1 && output->nusers() == 1)
+        numInternal++;
+      else
+        return nullptr;
+    }
+
+    if (numInternal == NumMemoryStates(*node))
+      continue;
+
+    if (numInternal != 0 || last != nullptr)
+      return nullptr;
+
+    last = node;
+  }
+
+  return last;
+}
+
+/**
+ * Checks whether the memory states of the loads and stores of a tree permit to replace them by vector loads and
+ * stores. This is the case if either all loads and stores are part of a single memory state chain, or the loads of
+ * each load tree node and the stores each form their own chain. In the first case, \p isSingleChain is set and all
+ * loads are moved before all stores.
+ */
+static bool
+CheckMemoryStates(
+  std::vector<MemoryGroup> & groups,
+  bool & isSingleChain)
+{
+  std::unordered_set<const jive::node*> members;
+  for (auto & group : groups)
+    members.insert(group.Nodes.begin(), group.Nodes.end());
+
+  isSingleChain = true;
+  std::vector<jive::output*> chainRoots;
+  for (auto & group : groups) {
+    for (auto & node : group.Nodes) {
+      std::vector<jive::output*> roots;
+      if (!TraceMemoryStates(*node, members, roots))
+        return false;
+
+      if (node == group.Nodes[0])
+        group.Roots = roots;
+      else if (roots != group.Roots)
+        return false;
+    }
+
+    if (&group == &groups[0])
+      chainRoots = group.Roots;
+    else if (group.Roots != chainRoots)
+      isSingleChain = false;
+  }
+
+  if (isSingleChain) {
+    std::vector<jive::node*> nodes;
+    for (auto & group : groups)
+      nodes.insert(nodes.end(), group.Nodes.begin(), group.Nodes.end());
+
+    auto last = GetLastNode(nodes, members);
+    for (auto & group : groups)
+      group.Last = last;
+    return last != nullptr;
+  }
+
+  for (auto & group : groups) {
+    std::unordered_set<const jive::node*> scope(group.Nodes.begin(), group.Nodes.end());
+    group.Last = GetLastNode(group.Nodes, scope);
+    if (!group.Last)
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Checks that no store of a lane writes to a location that is loaded by another lane. Such loads cannot be moved
+ * before the stores.
+ */
+static bool
+AreLoadsIndependent(
+  const std::vector<StoreNode*> & storeNodes,
+  const std::vector<const SlpTree*> & loadTrees)
+{
+  for (size_t s = 0; s < storeNodes.size(); s++) {
+    auto storeNode = storeNodes[s];
+    ElementAddress storeAddress;
+    GetElementAddress(*storeNode->GetAddressInput()->origin(), storeNode->GetValueInput()->type(), storeAddress);
+
+    for (auto & loadTree : loadTrees) {
+      for (size_t l = 0; l < loadTree->Values.size(); l++) {
+        ElementAddress loadAddress;
+        GetElementAddress(*loadTree->Lane(l)->input(0)->origin(), loadTree->Values[l]->type(), loadAddress);
+
+        if (loadAddress.Key != storeAddress.Key)
+          return false;
+
+        if (loadAddress.Offset == storeAddress.Offset && l != s)
+          return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Returns true if any of the \p origins depends on a node in \p nodes.
+ */
+static bool
+DependsOn(
+  const std::vector<jive::output*> & origins,
+  const std::unordered_set<const jive::node*> & nodes)
+{
+  std::unordered_set<const jive::node*> visited;
+  std::vector<const jive::node*> worklist;
+  auto push = [&](const jive::output * origin)
+  {
+    auto node = jive::node_output::node(origin);
+    if (node && visited.insert(node).second)
+      worklist.push_back(node);
+  };
+
+  for (auto & origin : origins)
+    push(origin);
+
+  while (!worklist.empty()) {
+    auto node = worklist.back();
+    worklist.pop_back();
+
+    if (nodes.find(node) != nodes.end())
+      return true;
+
+    for (size_t n = 0; n < node->ninputs(); n++)
+      push(node->input(n)->origin());
+  }
+
+  return false;
+}
+
+static std::vector<size_t>
+GetAliasClasses(const std::vector<jive::node*> & nodes)
+{
+  std::set<size_t> aliasClasses;
+  for (auto & node : nodes) {
+    auto & classes = is<StoreOperation>(node)
+                     ? AssertedCast<StoreNode>(node)->GetAliasClasses()
+                     : AssertedCast<LoadNode>(node)->GetAliasClasses();
+    aliasClasses.insert(classes.begin(), classes.end());
+  }
+
+  return {aliasClasses.begin(), aliasClasses.end()};
+}
+
+static void
+DivertMemoryStates(
+  const jive::node & node,
+  const std::vector<jive::output*> & states)
+{
+  for (size_t n = 0; n < NumMemoryStates(node); n++)
+    GetMemoryStateOutput(node, n)->divert_users(states[n]);
+}
+
+/**
+ * Creates the vector operations of \p tree. The memory states of vector loads are either threaded through
+ * \p chainStates, or taken from the roots of the loads' memory group.
+ */
+static jive::output *
+CreateVectorTree(
+  const SlpTree & tree,
+  const fixedvectortype & vectorType,
+  const std::unordered_map<const SlpTree*, MemoryGroup*> & loadGroups,
+  std::vector<jive::output*> * chainStates)
+{
+  auto & region = *tree.Values[0]->region();
+
+  switch (tree.kind) {
+    case SlpTree::Kind::Gather:
+    {
+      insertelement_op operation(vectorType, vectorType.type(), jive::bit32);
+
+      auto vector = UndefValueOperation::Create(region, vectorType);
+      for (size_t n = 0; n < tree.Values.size(); n++) {
+        auto index = jive::create_bitconstant(&region, 32, n);
+        vector = jive::simple_node::create_normalized(&region, operation, {vector, tree.Values[n], index})[0];
+      }
+
+      return vector;
+    }
+
+    case SlpTree::Kind::Load:
+    {
+      auto & group = *loadGroups.at(&tree);
+      auto & loadNode = *AssertedCast<LoadNode>(tree.Lane(0));
+
+      auto address = bitcast_op::create(loadNode.GetAddressInput()->origin(), PointerType(vectorType));
+      auto outputs = LoadNode::Create(
+        address,
+        chainStates ? *chainStates : group.Roots,
+        loadNode.GetAlignment(),
+        GetAliasClasses(group.Nodes));
+
+      std::vector<jive::output*> states(std::next(outputs.begin()), outputs.end());
+      if (chainStates)
+        *chainStates = states;
+      else
+        DivertMemoryStates(*group.Last, states);
+
+      return outputs[0];
+    }
+
+    case SlpTree::Kind::Operation:
+    {
+      auto & binaryOperation = *AssertedCast<const jive::binary_op>(&tree.Lane(0)->operation());
+      auto operand1 = CreateVectorTree(*tree.Operands[0], vectorType, loadGroups, chainStates);
+      auto operand2 = CreateVectorTree(*tree.Operands[1], vectorType, loadGroups, chainStates);
+
+      vectorbinary_op operation(binaryOperation, vectorType, vectorType, vectorType);
+      return jive::simple_node::create_normalized(&region, operation, {operand1, operand2})[0];
+    }
+  }
+
+  JLM_UNREACHABLE("Unhandled tree kind.");
+}
+
+/**
+ * Replaces the stores in \p storeNodes and the tree of their stored values with vector operations if it is
+ * profitable and legal.
+ */
+static bool
+Vectorize(const std::vector<StoreNode*> & storeNodes)
+{
+  std::vector<jive::output*> values;
+  for (auto & storeNode : storeNodes)
+    values.push_back(storeNode->GetValueInput()->origin());
+
+  auto tree = BuildTree(values);
+  if (2 - (int64_t)storeNodes.size() + GetCostDifference(*tree) >= 0)
+    return false;
+
+  std::vector<const SlpTree*> loadTrees;
+  std::vector<jive::output*> leaves;
+  std::unordered_set<const jive::node*> laneNodes(storeNodes.begin(), storeNodes.end());
+  CollectTreeNodes(*tree, loadTrees, leaves, laneNodes);
+  leaves.push_back(storeNodes[0]->GetAddressInput()->origin());
+
+  /*
+   * Check memory states
+   */
+  std::vector<MemoryGroup> groups(loadTrees.size() + 1);
+  for (size_t n = 0; n < loadTrees.size(); n++) {
+    for (size_t l = 0; l < loadTrees[n]->Values.size(); l++)
+      groups[n].Nodes.push_back(loadTrees[n]->Lane(l));
+  }
+  auto & storeGroup = groups.back();
+  storeGroup.Nodes.assign(storeNodes.begin(), storeNodes.end());
+  for (auto & storeNode : storeNodes) {
+    if (storeNode->NumStates() != storeNodes[0]->NumStates())
+      return false;
+  }
+
+  bool isSingleChain = false;
+  if (!CheckMemoryStates(groups, isSingleChain))
+    return false;
+
+  if (isSingleChain && !AreLoadsIndependent(storeNodes, loadTrees))
+    return false;
+
+  /*
+   * The vector operations are placed after all leaves of the tree. Bail out if this would create a cycle.
+   */
+  for (auto & group : groups)
+    leaves.insert(leaves.end(), group.Roots.begin(), group.Roots.end());
+  if (DependsOn(leaves, laneNodes))
+    return false;
+
+  /*
+   * Create vector operations
+   */
+  fixedvectortype vectorType(*AssertedCast<const jive::valuetype>(&values[0]->type()), values.size());
+
+  std::unordered_map<const SlpTree*, MemoryGroup*> loadGroups;
+  for (size_t n = 0; n < loadTrees.size(); n++)
+    loadGroups[loadTrees[n]] = &groups[n];
+
+  std::vector<jive::output*> chainStates = storeGroup.Roots;
+  auto vector = CreateVectorTree(*tree, vectorType, loadGroups, isSingleChain ? &chainStates : nullptr);
+
+  auto address = bitcast_op::create(storeNodes[0]->GetAddressInput()->origin(), PointerType(vectorType));
+  auto states = StoreNode::Create(
+    address,
+    vector,
+    isSingleChain ? chainStates : storeGroup.Roots,
+    storeNodes[0]->GetAlignment(),
+    GetAliasClasses(storeGroup.Nodes));
+  DivertMemoryStates(*storeGroup.Last, states);
+
+  /*
+   * Remove the scalar nodes. Users are removed before their producers.
+   */
+  std::vector<jive::node*> scalarNodes;
+  for (auto & node : laneNodes)
+    scalarNodes.push_back(const_cast<jive::node*>(node));
+
+  while (!scalarNodes.empty()) {
+    auto it = std::find_if(scalarNodes.begin(), scalarNodes.end(), [](const jive::node * node) {
+      for (size_t n = 0; n < node->noutputs(); n++) {
+        if (node->output(n)->nusers() != 0)
+          return false;
+      }
+      return true;
+    });
+    JLM_ASSERT(it != scalarNodes.end());
+
+    remove(*it);
+    scalarNodes.erase(it);
+  }
+
+  return true;
+}
+
+static void
+VectorizeRegion(
+  jive::region & region,
+  size_t & numSeedGroups,
+  size_t & numVectorizedGroups)
+{
+  /*
+   * Group stores by the key of their address.
+   */
+  std::map<std::vector<const jive::output*>, std::vector<std::pair<int64_t, StoreNode*>>> candidates;
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<jive::structural_node*>(&node)) {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        VectorizeRegion(*structuralNode->subregion(n), numSeedGroups, numVectorizedGroups);
+      continue;
+    }
+
+    auto storeNode = dynamic_cast<StoreNode*>(&node);
+    if (!storeNode || GetVectorizationFactor(storeNode->GetValueInput()->type()) < 2)
+      continue;
+
+    ElementAddress address;
+    if (GetElementAddress(*storeNode->GetAddressInput()->origin(), storeNode->GetValueInput()->type(), address))
+      candidates[address.Key].emplace_back(address.Offset, storeNode);
+  }
+
+  /*
+   * Vectorize runs of stores to adjacent elements.
+   */
+  for (auto & candidate : candidates) {
+    auto & stores = candidate.second;
+    std::stable_sort(stores.begin(), stores.end(), [](const auto & a, const auto & b) {
+      return a.first < b.first;
+    });
+
+    size_t n = 0;
+    while (n < stores.size()) {
+      auto & valueType = stores[n].second->GetValueInput()->type();
+      auto numLanes = GetVectorizationFactor(valueType);
+
+      std::vector<StoreNode*> storeNodes({stores[n].second});
+      for (size_t m = n+1; m < stores.size() && storeNodes.size() < numLanes; m++) {
+        if (stores[m].first != stores[n].first + (int64_t)storeNodes.size()
+            || stores[m].second->GetValueInput()->type() != valueType)
+          break;
+
+        storeNodes.push_back(stores[m].second);
+      }
+
+      if (storeNodes.size() != numLanes) {
+        n++;
+        continue;
+      }
+
+      numSeedGroups++;
+      if (Vectorize(storeNodes)) {
+        numVectorizedGroups++;
+        n += numLanes;
+      } else {
+        n++;
+      }
+    }
+  }
+}
+
+SlpVectorizer::~SlpVectorizer()
+= default;
+
+void
+SlpVectorizer::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  SlpVectorizerStatistics statistics(rvsdgModule.SourceFileName());
+  statistics.Start();
+
+  size_t numSeedGroups = 0;
+  size_t numVectorizedGroups = 0;
+  VectorizeRegion(*rvsdgModule.Rvsdg().root(), numSeedGroups, numVectorizedGroups);
+
+  statistics.Stop(numSeedGroups, numVectorizedGroups);
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
@@ -0,0 +1,628 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/SparseConditionalConstantPropagation.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/bitoperation-classes.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace jlm {
+
+class SparseConditionalConstantPropagationStatistics final : public Statistics {
+public:
+  ~SparseConditionalConstantPropagationStatistics() override
+  = default;
+
+  explicit
+  SparseConditionalConstantPropagationStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::SparseConditionalConstantPropagation)
+    , NumConstants_(0)
+    , NumGammas_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  StartAnalysis() noexcept
+  {
+    AnalysisTimer_.start();
+  }
+
+  void
+  StopAnalysis() noexcept
+  {
+    AnalysisTimer_.stop();
+  }
+
+  void
+  StartTransformation() noexcept
+  {
+    TransformationTimer_.start();
+  }
+
+  void
+  StopTransformation(
+    size_t numConstants,
+    size_t numGammas) noexcept
+  {
+    TransformationTimer_.stop();
+    NumConstants_ = numConstants;
+    NumGammas_ = numGammas;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("SparseConditionalConstantPropagation ",
+                  SourceFile_.to_str(), " ",
+                  "#Constants:", NumConstants_, " ",
+                  "#ReducedGammas:", NumGammas_, " ",
+                  "AnalysisTime[ns]:", AnalysisTimer_.ns(), " ",
+                  "TransformationTime[ns]:", TransformationTimer_.ns());
+  }
+
+private:
+  size_t NumConstants_;
+  size_t NumGammas_;
+  jlm::timer AnalysisTimer_;
+  jlm::timer TransformationTimer_;
+  jlm::filepath SourceFile_;
+};
+
+/**
+ * An element of the lattice Top > Constant > Bottom. A constant is represented by the nullary operation that creates
+ * it, i.e., a bitconstant_op or ctlconstant_op.
+ */
+class LatticeValue final {
+  enum class Kind {
+    Top,
+    Constant,
+    Bottom
+  };
+
+  LatticeValue(
+    Kind kind,
+    std::shared_ptr<const jive::simple_op> constant)
+    : Kind_(kind)
+    , Constant_(std::move(constant))
+  {}
+
+public:
+  LatticeValue()
+    : LatticeValue(Kind::Top, nullptr)
+  {}
+
+  [[nodiscard]] bool
+  IsTop() const noexcept
+  {
+    return Kind_ == Kind::Top;
+  }
+
+  [[nodiscard]] bool
+  IsBottom() const noexcept
+  {
+    return Kind_ == Kind::Bottom;
+  }
+
+  [[nodiscard]] const jive::simple_op *
+  GetConstant() const noexcept
+  {
+    return Constant_.get();
+  }
+
+  [[nodiscard]] const jive::bitvalue_repr *
+  GetBitValue() const noexcept
+  {
+    auto constant = dynamic_cast<const jive::bitconstant_op*>(GetConstant());
+    return constant ? &constant->value() : nullptr;
+  }
+
+  [[nodiscard]] const jive::ctlvalue_repr *
+  GetControlValue() const noexcept
+  {
+    auto constant = dynamic_cast<const jive::ctlconstant_op*>(GetConstant());
+    return constant ? &constant->value() : nullptr;
+  }
+
+  bool
+  operator==(const LatticeValue & other) const noexcept
+  {
+    if (Kind_ != other.Kind_)
+      return false;
+
+    return Kind_ != Kind::Constant || *Constant_ == *other.Constant_;
+  }
+
+  bool
+  operator!=(const LatticeValue & other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+  [[nodiscard]] static LatticeValue
+  Meet(
+    const LatticeValue & value1,
+    const LatticeValue & value2)
+  {
+    if (value1.IsTop())
+      return value2;
+
+    if (value2.IsTop())
+      return value1;
+
+    return value1 == value2 ? value1 : Bottom();
+  }
+
+  static LatticeValue
+  Top()
+  {
+    return {Kind::Top, nullptr};
+  }
+
+  static LatticeValue
+  Bottom()
+  {
+    return {Kind::Bottom, nullptr};
+  }
+
+  static LatticeValue
+  Constant(const jive::simple_op & operation)
+  {
+    return {Kind::Constant, std::shared_ptr<const jive::simple_op>(
+      static_cast<jive::simple_op*>(operation.copy().release()))};
+  }
+
+  static LatticeValue
+  Constant(const jive::bitvalue_repr & value)
+  {
+    return Constant(jive::bitconstant_op(value));
+  }
+
+  static LatticeValue
+  Constant(const jive::ctlvalue_repr & value)
+  {
+    return Constant(jive::ctlconstant_op(value));
+  }
+
+private:
+  Kind Kind_;
+  std::shared_ptr<const jive::simple_op> Constant_;
+};
+
+/**
+ * The lattice values of all outputs and region arguments of a graph, together with the worklist of the values that
+ * were lowered but whose users were not yet revisited.
+ */
+class ConstantPropagationContext final {
+public:
+  [[nodiscard]] const LatticeValue &
+  GetValue(const jive::output & output) const noexcept
+  {
+    static LatticeValue top;
+
+    auto it = Values_.find(&output);
+    return it != Values_.end() ? it->second : top;
+  }
+
+  /**
+   * Lowers the lattice value of \p output to the meet of its current value and \p value. The output is added to the
+   * worklist if its value changed.
+   */
+  void
+  Update(
+    const jive::output & output,
+    const LatticeValue & value)
+  {
+    auto & currentValue = Values_[&output];
+    auto newValue = LatticeValue::Meet(currentValue, value);
+    if (newValue == currentValue)
+      return;
+
+    currentValue = newValue;
+    Worklist_.push_back(&output);
+  }
+
+  [[nodiscard]] const jive::output *
+  PopWorklist()
+  {
+    if (Worklist_.empty())
+      return nullptr;
+
+    auto output = Worklist_.back();
+    Worklist_.pop_back();
+    return output;
+  }
+
+private:
+  std::unordered_map<const jive::output*, LatticeValue> Values_;
+  std::vector<const jive::output*> Worklist_;
+};
+
+static LatticeValue
+FoldOperation(
+  const jive::simple_op & operation,
+  const std::vector<const LatticeValue*> & operands)
+{
+  if (auto unaryOperation = dynamic_cast<const jive::bitunary_op*>(&operation))
+    return LatticeValue::Constant(unaryOperation->reduce_constant(*operands[0]->GetBitValue()));
+
+  if (auto binaryOperation = dynamic_cast<const jive::bitbinary_op*>(&operation)) {
+    /*
+     * Normalized binary operations can have more than two operands.
+     */
+    auto value = *operands[0]->GetBitValue();
+    for (size_t n = 1; n < operands.size(); n++)
+      value = binaryOperation->reduce_constants(value, *operands[n]->GetBitValue());
+
+    return LatticeValue::Constant(value);
+  }
+
+  if (auto compareOperation = dynamic_cast<const jive::bitcompare_op*>(&operation)) {
+    switch (compareOperation->reduce_constants(*operands[0]->GetBitValue(), *operands[1]->GetBitValue())) {
+      case jive::compare_result::static_true:
+        return LatticeValue::Constant(jive::bitvalue_repr(1, 1));
+      case jive::compare_result::static_false:
+        return LatticeValue::Constant(jive::bitvalue_repr(1, 0));
+      case jive::compare_result::undecidable:
+        return LatticeValue::Bottom();
+    }
+  }
+
+  if (auto matchOperation = dynamic_cast<const jive::match_op*>(&operation)) {
+    auto & value = *operands[0]->GetBitValue();
+    if (!value.is_known() || value.nbits() > 64)
+      return LatticeValue::Bottom();
+
+    auto alternative = matchOperation->alternative(value.to_uint());
+    return LatticeValue::Constant(jive::ctlvalue_repr(alternative, matchOperation->nalternatives()));
+  }
+
+  return LatticeValue::Bottom();
+}
+
+static bool
+IsFoldable(const jive::simple_op & operation)
+{
+  return dynamic_cast<const jive::bitunary_op*>(&operation)
+         || dynamic_cast<const jive::bitbinary_op*>(&operation)
+         || dynamic_cast<const jive::bitcompare_op*>(&operation)
+         || dynamic_cast<const jive::match_op*>(&operation);
+}
+
+static void
+EvaluateSimpleNode(
+  const jive::simple_node & node,
+  ConstantPropagationContext & context)
+{
+  auto & operation = *static_cast<const jive::simple_op*>(&node.operation());
+
+  auto updateOutputs = [&](const LatticeValue & value)
+  {
+    for (size_t n = 0; n < node.noutputs(); n++)
+      context.Update(*node.output(n), value);
+  };
+
+  if (node.ninputs() == 0) {
+    auto isConstant = dynamic_cast<const jive::bitconstant_op*>(&operation)
+                      || dynamic_cast<const jive::ctlconstant_op*>(&operation);
+    updateOutputs(isConstant ? LatticeValue::Constant(operation) : LatticeValue::Bottom());
+    return;
+  }
+
+  if (!IsFoldable(operation)) {
+    updateOutputs(LatticeValue::Bottom());
+    return;
+  }
+
+  std::vector<const LatticeValue*> operands;
+  for (size_t n = 0; n < node.ninputs(); n++) {
+    auto & value = context.GetValue(*node.input(n)->origin());
+    if (value.IsBottom()) {
+      updateOutputs(LatticeValue::Bottom());
+      return;
+    }
+
+    operands.push_back(&value);
+  }
+
+  for (auto & operand : operands) {
+    if (operand->IsTop())
+      return;
+  }
+
+  updateOutputs(FoldOperation(operation, operands));
+}
+
+static void
+UpdateGammaOutput(
+  const jive::gamma_node & gammaNode,
+  const jive::output & output,
+  ConstantPropagationContext & context)
+{
+  auto & predicate = context.GetValue(*gammaNode.predicate()->origin());
+  if (predicate.IsTop())
+    return;
+
+  if (auto alternative = predicate.GetControlValue()) {
+    auto result = gammaNode.subregion(alternative->alternative())->result(output.index());
+    context.Update(output, context.GetValue(*result->origin()));
+    return;
+  }
+
+  for (size_t n = 0; n < gammaNode.nsubregions(); n++) {
+    auto result = gammaNode.subregion(n)->result(output.index());
+    context.Update(output, context.GetValue(*result->origin()));
+  }
+}
+
+/**
+ * Checks whether the theta node might execute more than one iteration, i.e., whether the values of its results flow
+ * into its arguments.
+ */
+static bool
+IsIterating(
+  const jive::theta_node & thetaNode,
+  const ConstantPropagationContext & context)
+{
+  auto & predicate = context.GetValue(*thetaNode.predicate()->origin());
+  if (predicate.IsTop())
+    return false;
+
+  auto alternative = predicate.GetControlValue();
+  return !alternative || alternative->alternative() != 0;
+}
+
+static void
+UpdateThetaArgument(
+  const jive::theta_node & thetaNode,
+  const jive::theta_input & input,
+  ConstantPropagationContext & context)
+{
+  context.Update(*input.argument(), context.GetValue(*input.origin()));
+  if (IsIterating(thetaNode, context))
+    context.Update(*input.argument(), context.GetValue(*input.result()->origin()));
+}
+
+static void
+VisitStructuralInput(
+  const jive::structural_input & input,
+  ConstantPropagationContext & context)
+{
+  auto node = input.node();
+  if (auto gammaNode = dynamic_cast<const jive::gamma_node*>(node)) {
+    if (&input == gammaNode->predicate()) {
+      for (size_t n = 0; n < gammaNode->noutputs(); n++)
+        UpdateGammaOutput(*gammaNode, *gammaNode->output(n), context);
+      return;
+    }
+  }
+
+  if (auto thetaNode = dynamic_cast<const jive::theta_node*>(node)) {
+    UpdateThetaArgument(*thetaNode, *static_cast<const jive::theta_input*>(&input), context);
+    return;
+  }
+
+  for (auto & argument : input.arguments)
+    context.Update(argument, context.GetValue(*input.origin()));
+}
+
+static void
+VisitResult(
+  const jive::result & result,
+  ConstantPropagationContext & context)
+{
+  auto node = result.region()->node();
+  if (auto gammaNode = dynamic_cast<const jive::gamma_node*>(node)) {
+    UpdateGammaOutput(*gammaNode, *result.output(), context);
+    return;
+  }
+
+  if (auto thetaNode = dynamic_cast<const jive::theta_node*>(node)) {
+    if (&result == thetaNode->predicate()) {
+      for (auto output : *thetaNode)
+        UpdateThetaArgument(*thetaNode, *output->input(), context);
+      return;
+    }
+
+    context.Update(*result.output(), context.GetValue(*result.origin()));
+    UpdateThetaArgument(*thetaNode, *static_cast<const jive::theta_output*>(result.output())->input(), context);
+  }
+
+  /*
+   * The results of lambda, phi, and delta nodes as well as of the root region do not flow into any other value of
+   * the graph.
+   */
+}
+
+static void
+VisitInput(
+  const jive::input & input,
+  ConstantPropagationContext & context)
+{
+  if (auto result = dynamic_cast<const jive::result*>(&input)) {
+    VisitResult(*result, context);
+  } else if (auto structuralInput = dynamic_cast<const jive::structural_input*>(&input)) {
+    VisitStructuralInput(*structuralInput, context);
+  } else {
+    EvaluateSimpleNode(*static_cast<const jive::simple_input*>(&input)->node(), context);
+  }
+}
+
+/**
+ * Seeds the analysis by visiting every node, input, and result of \p region once.
+ */
+static void
+SeedRegion(
+  const jive::region & region,
+  ConstantPropagationContext & context)
+{
+  for (size_t n = 0; n < region.narguments(); n++) {
+    auto argument = region.argument(n);
+    if (argument->input() == nullptr)
+      context.Update(*argument, LatticeValue::Bottom());
+  }
+
+  for (auto & node : region.nodes) {
+    if (auto simpleNode = dynamic_cast<const jive::simple_node*>(&node)) {
+      EvaluateSimpleNode(*simpleNode, context);
+      continue;
+    }
+
+    auto & structuralNode = *static_cast<const jive::structural_node*>(&node);
+    for (size_t n = 0; n < structuralNode.ninputs(); n++)
+      VisitStructuralInput(*structuralNode.input(n), context);
+
+    for (size_t n = 0; n < structuralNode.nsubregions(); n++)
+      SeedRegion(*structuralNode.subregion(n), context);
+
+    /*
+     * The outputs of lambda, phi, and delta nodes are functions and global variables.
+     */
+    if (!jive::is<jive::gamma_op>(&node) && !jive::is<jive::theta_op>(&node)) {
+      for (size_t n = 0; n < structuralNode.noutputs(); n++)
+        context.Update(*structuralNode.output(n), LatticeValue::Bottom());
+    }
+  }
+
+  for (size_t n = 0; n < region.nresults(); n++)
+    VisitResult(*region.result(n), context);
+}
+
+static void
+Analyze(
+  const jive::graph & graph,
+  ConstantPropagationContext & context)
+{
+  SeedRegion(*graph.root(), context);
+
+  while (auto output = context.PopWorklist()) {
+    for (auto & user : *output)
+      VisitInput(*user, context);
+  }
+}
+
+/**
+ * Diverts all users of \p output to a constant node if the output is proven constant. Returns true if the users were
+ * diverted.
+ */
+static bool
+ReplaceWithConstant(
+  jive::output & output,
+  jive::region & region,
+  const ConstantPropagationContext & context)
+{
+  auto constant = context.GetValue(output).GetConstant();
+  if (!constant || output.nusers() == 0)
+    return false;
+
+  auto node = jive::node_output::node(&output);
+  if (node && node->ninputs() == 0)
+    return false;
+
+  output.divert_users(jive::simple_node::create_normalized(&region, *constant, {})[0]);
+  return true;
+}
+
+static size_t
+ReplaceConstants(
+  jive::region & region,
+  const ConstantPropagationContext & context)
+{
+  size_t numConstants = 0;
+  for (size_t n = 0; n < region.narguments(); n++)
+    numConstants += ReplaceWithConstant(*region.argument(n), region, context);
+
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<jive::structural_node*>(&node)) {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        numConstants += ReplaceConstants(*structuralNode->subregion(n), context);
+    }
+  }
+
+  /*
+   * The constant nodes are created in the region, so the outputs are collected before any replacement.
+   */
+  std::vector<jive::output*> outputs;
+  for (auto & node : region.nodes) {
+    for (size_t n = 0; n < node.noutputs(); n++)
+      outputs.push_back(node.output(n));
+  }
+
+  for (auto & output : outputs)
+    numConstants += ReplaceWithConstant(*output, region, context);
+
+  return numConstants;
+}
+
+/**
+ * Reduces all gamma nodes of \p region with a constant predicate. Inner gamma nodes are reduced first, such that the
+ * reduction of an outer gamma node never invalidates a node that is still to be processed.
+ */
+static size_t
+ReduceGammas(
+  jive::region & region,
+  jive::gamma_normal_form & normalForm)
+{
+  std::vector<jive::node*> nodes;
+  for (auto & node : region.nodes)
+    nodes.push_back(&node);
+
+  size_t numGammas = 0;
+  for (auto & node : nodes) {
+    auto structuralNode = dynamic_cast<jive::structural_node*>(node);
+    if (!structuralNode)
+      continue;
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      numGammas += ReduceGammas(*structuralNode->subregion(n), normalForm);
+
+    auto gammaNode = dynamic_cast<jive::gamma_node*>(structuralNode);
+    if (gammaNode && jive::is<jive::ctlconstant_op>(jive::node_output::node(gammaNode->predicate()->origin()))) {
+      normalForm.normalize_node(gammaNode);
+      numGammas++;
+    }
+  }
+
+  return numGammas;
+}
+
+SparseConditionalConstantPropagation::~SparseConditionalConstantPropagation()
+= default;
+
+void
+SparseConditionalConstantPropagation::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  auto & graph = rvsdgModule.Rvsdg();
+  SparseConditionalConstantPropagationStatistics statistics(rvsdgModule.SourceFileName());
+
+  statistics.StartAnalysis();
+  ConstantPropagationContext context;
+  Analyze(graph, context);
+  statistics.StopAnalysis();
+
+  statistics.StartTransformation();
+  auto numConstants = ReplaceConstants(*graph.root(), context);
+
+  auto normalForm = jive::gamma_op::normal_form(&graph);
+  normalForm->set_mutable(true);
+  normalForm->set_predicate_reduction(true);
+  auto numGammas = ReduceGammas(*graph.root(), *normalForm);
+  statistics.StopTransformation(numConstants, numGammas);
+
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
@@ -0,0 +1,621 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/StoreForwarding.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <llvm/IR/DataLayout.h>
+#include <llvm/Support/Error.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm {
+
+class StoreForwardingStatistics final : public Statistics {
+public:
+  ~StoreForwardingStatistics() override
+  = default;
+
+  explicit
+  StoreForwardingStatistics(jlm::filepath sourceFile)
+    : Statistics(StatisticsDescriptor::StatisticsId::StoreForwarding)
+    , NumForwardedLoads_(0)
+    , NumRemovedStores_(0)
+    , SourceFile_(std::move(sourceFile))
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(
+    size_t numForwardedLoads,
+    size_t numRemovedStores) noexcept
+  {
+    Timer_.stop();
+    NumForwardedLoads_ = numForwardedLoads;
+    NumRemovedStores_ = numRemovedStores;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("StoreForwarding ",
+                  SourceFile_.to_str(), " ",
+                  "#ForwardedLoads:", NumForwardedLoads_, " ",
+                  "#RemovedStores:", NumRemovedStores_, " ",
+                  "Time[ns]:", Timer_.ns());
+  }
+
+private:
+  size_t NumForwardedLoads_;
+  size_t NumRemovedStores_;
+  jlm::timer Timer_;
+  jlm::filepath SourceFile_;
+};
+
+enum class AliasRelation {
+  NoAlias,
+  MayAlias,
+  MustAlias
+};
+
+/**
+ * Returns the origin of \p output outside of gamma and theta nodes if it is routed into them without modification.
+ */
+static const jive::output &
+GetOrigin(const jive::output & output)
+{
+  auto origin = &output;
+  while (true) {
+    if (auto argument = is_gamma_argument(origin)) {
+      origin = argument->input()->origin();
+      continue;
+    }
+
+    if (auto argument = is_theta_argument(origin)) {
+      auto input = static_cast<const jive::theta_input*>(argument->input());
+      if (jive::is_invariant(input)) {
+        origin = input->origin();
+        continue;
+      }
+    }
+
+    return *origin;
+  }
+}
+
+static const jive::output &
+GetBaseAddress(const jive::output & address)
+{
+  auto origin = &GetOrigin(address);
+  while (true) {
+    auto node = jive::node_output::node(origin);
+    if (!is<getelementptr_op>(node) && !is<bitcast_op>(node))
+      return *origin;
+
+    origin = &GetOrigin(*node->input(0)->origin());
+  }
+}
+
+static const jive::bitconstant_op *
+GetBitConstant(const jive::output & output)
+{
+  auto node = jive::node_output::node(&GetOrigin(output));
+  return node ? dynamic_cast<const jive::bitconstant_op*>(&node->operation()) : nullptr;
+}
+
+/**
+ * Returns the size of pointers in bytes as specified by the data layout of \p rvsdgModule, or zero if the module
+ * has no valid data layout.
+ */
+static size_t
+GetPointerSize(const RvsdgModule & rvsdgModule)
+{
+  if (rvsdgModule.DataLayout().empty())
+    return 0;
+
+  auto dataLayout = llvm::DataLayout::parse(rvsdgModule.DataLayout());
+  if (!dataLayout) {
+    llvm::consumeError(dataLayout.takeError());
+    return 0;
+  }
+
+  return dataLayout->getPointerSize();
+}
+
+/**
+ * Returns the size of \p type in bytes, or zero if it is not supported. Pointers are \p pointerSize bytes large.
+ */
+static size_t
+GetTypeSize(
+  const jive::type & type,
+  size_t pointerSize)
+{
+  if (auto bitType = dynamic_cast<const jive::bittype*>(&type))
+    return bitType->nbits() % 8 == 0 ? bitType->nbits() / 8 : 0;
+
+  if (auto floatingPointType = dynamic_cast<const fptype*>(&type)) {
+    switch (floatingPointType->size()) {
+      case fpsize::half: return 2;
+      case fpsize::flt: return 4;
+      case fpsize::dbl: return 8;
+      default: return 0;
+    }
+  }
+
+  if (is<PointerType>(type))
+    return pointerSize;
+
+  if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    return arrayType->nelements() * GetTypeSize(arrayType->element_type(), pointerSize);
+
+  return 0;
+}
+
+/**
+ * Compares two getelementptr nodes with the same base address.
+ *
+ * The indices are not known to be in bounds, such that two different index lists can compute the same address. The
+ * relation is therefore determined from the byte offsets of the two addresses and the sizes of the accesses. Indices
+ * that are not constant must be identical in both nodes.
+ */
+static AliasRelation
+GetAliasRelation(
+  const jive::node & gep1,
+  size_t size1,
+  const jive::node & gep2,
+  size_t size2,
+  size_t pointerSize)
+{
+  auto & operation1 = *AssertedCast<const getelementptr_op>(&gep1.operation());
+  auto & operation2 = *AssertedCast<const getelementptr_op>(&gep2.operation());
+  if (operation1.pointee_type() != operation2.pointee_type()
+      || gep1.ninputs() != gep2.ninputs()
+      || &GetOrigin(*gep1.input(0)->origin()) != &GetOrigin(*gep2.input(0)->origin()))
+    return AliasRelation::MayAlias;
+
+  /* the offset of the first address relative to the second address in bytes */
+  int64_t offset = 0;
+  const jive::type * type = &operation1.pointee_type();
+  for (size_t n = 1; n < gep1.ninputs(); n++) {
+    auto & index1 = GetOrigin(*gep1.input(n)->origin());
+    auto & index2 = GetOrigin(*gep2.input(n)->origin());
+    auto constant1 = GetBitConstant(index1);
+    auto constant2 = GetBitConstant(index2);
+    bool identical = &index1 == &index2
+                  || (constant1 && constant2 && constant1->value().to_int() == constant2->value().to_int());
+
+    /* the first index steps over the pointee type, the others into it */
+    const jive::type * elementType = nullptr;
+    if (n == 1) {
+      elementType = type;
+    } else if (auto arrayType = dynamic_cast<const arraytype*>(type)) {
+      elementType = &arrayType->element_type();
+    } else if (auto structType = dynamic_cast<const structtype*>(type)) {
+      if (!identical || constant1 == nullptr || constant1->value().to_uint() >= structType->declaration()->nelements())
+        return AliasRelation::MayAlias;
+
+      type = &structType->declaration()->element(constant1->value().to_uint());
+      continue;
+    } else {
+      return AliasRelation::MayAlias;
+    }
+
+    type = elementType;
+    if (identical)
+      continue;
+
+    auto elementSize = GetTypeSize(*elementType, pointerSize);
+    if (constant1 == nullptr || constant2 == nullptr || elementSize == 0)
+      return AliasRelation::MayAlias;
+
+    offset += (constant1->value().to_int() - constant2->value().to_int()) * static_cast<int64_t>(elementSize);
+  }
+
+  if (offset == 0)
+    return AliasRelation::MustAlias;
+
+  if (size1 == 0 || size2 == 0)
+    return AliasRelation::MayAlias;
+
+  if (offset >= static_cast<int64_t>(size2) || -offset >= static_cast<int64_t>(size1))
+    return AliasRelation::NoAlias;
+
+  return AliasRelation::MayAlias;
+}
+
+/**
+ * Determines whether an access of type \p type1 at \p address1 overlaps with an access of type \p type2 at
+ * \p address2.
+ */
+static AliasRelation
+GetAliasRelation(
+  const jive::output & address1,
+  const jive::type & type1,
+  const jive::output & address2,
+  const jive::type & type2,
+  size_t pointerSize)
+{
+  auto & origin1 = GetOrigin(address1);
+  auto & origin2 = GetOrigin(address2);
+  if (&origin1 == &origin2)
+    return AliasRelation::MustAlias;
+
+  auto node1 = jive::node_output::node(&origin1);
+  auto node2 = jive::node_output::node(&origin2);
+  if (is<getelementptr_op>(node1) && is<getelementptr_op>(node2)) {
+    auto relation = GetAliasRelation(
+      *node1,
+      GetTypeSize(type1, pointerSize),
+      *node2,
+      GetTypeSize(type2, pointerSize),
+      pointerSize);
+    if (relation != AliasRelation::MayAlias)
+      return relation;
+  }
+
+  auto & base1 = GetBaseAddress(origin1);
+  auto & base2 = GetBaseAddress(origin2);
+  if (&base1 != &base2
+      && is<alloca_op>(jive::node_output::node(&base1))
+      && is<alloca_op>(jive::node_output::node(&base2)))
+    return AliasRelation::NoAlias;
+
+  return AliasRelation::MayAlias;
+}
+
+/**
+ * Traces the memory state \p state upwards to the first store that might write to an access of type \p type at
+ * \p address.
+ *
+ * @return The memory state output of the store, an argument of \p boundary if no such store exists in \p boundary,
+ * or nullptr if the trace is inconclusive.
+ */
+static const jive::output *
+TraceStore(
+  const jive::output & state,
+  const jive::output & address,
+  const jive::type & type,
+  const jive::region * boundary,
+  size_t pointerSize)
+{
+  auto output = &state;
+  while (true) {
+    auto node = jive::node_output::node(output);
+    if (auto storeNode = dynamic_cast<const StoreNode*>(node)) {
+      if (GetAliasRelation(
+            *storeNode->GetAddressInput()->origin(),
+            storeNode->GetValueInput()->type(),
+            address,
+            type,
+            pointerSize) != AliasRelation::NoAlias)
+        return output;
+
+      output = storeNode->input(output->index() + 2)->origin();
+      continue;
+    }
+
+    if (auto loadNode = dynamic_cast<const LoadNode*>(node)) {
+      output = loadNode->input(output->index())->origin();
+      continue;
+    }
+
+    if (auto argument = is_gamma_argument(output)) {
+      if (argument->region() == boundary)
+        return output;
+
+      output = argument->input()->origin();
+      continue;
+    }
+
+    if (auto argument = is_theta_argument(output)) {
+      if (argument->region() == boundary)
+        return output;
+
+      auto input = static_cast<const jive::theta_input*>(argument->input());
+      if (TraceStore(*input->result()->origin(), address, type, argument->region(), pointerSize) != argument)
+        return nullptr;
+
+      output = input->origin();
+      continue;
+    }
+
+    if (auto gammaOutput = is_gamma_output(output)) {
+      const jive::structural_input * input = nullptr;
+      for (auto & result : gammaOutput->results) {
+        auto argument = dynamic_cast<const jive::argument*>(TraceStore(*result.origin(), address, type, result.region(), pointerSize));
+        if (argument == nullptr || (input != nullptr && argument->input() != input))
+          return nullptr;
+
+        input = argument->input();
+      }
+
+      output = input->origin();
+      continue;
+    }
+
+    if (auto thetaOutput = is_theta_output(output)) {
+      auto subregion = thetaOutput->node()->subregion();
+      if (TraceStore(*thetaOutput->result()->origin(), address, type, subregion, pointerSize) != thetaOutput->argument())
+        return nullptr;
+
+      output = thetaOutput->input()->origin();
+      continue;
+    }
+
+    return nullptr;
+  }
+}
+
+/**
+ * Routes \p output into \p region through the gamma and theta nodes that enclose \p region.
+ */
+static jive::output *
+RouteToRegion(
+  jive::output & output,
+  jive::region & region)
+{
+  if (output.region() == &region)
+    return &output;
+
+  auto origin = RouteToRegion(output, *region.node()->region());
+
+  if (auto gammaNode = dynamic_cast<jive::gamma_node*>(region.node()))
+    return gammaNode->add_entryvar(origin)->argument(region.index());
+
+  auto thetaNode = AssertedCast<jive::theta_node>(region.node());
+  return thetaNode->add_loopvar(origin)->argument();
+}
+
+static bool
+ForwardStore(
+  LoadNode & loadNode,
+  size_t pointerSize)
+{
+  auto & address = *loadNode.GetAddressInput()->origin();
+  auto & type = loadNode.GetValueOutput()->type();
+
+  const StoreNode * storeNode = nullptr;
+  for (size_t n = 1; n < loadNode.ninputs(); n++) {
+    auto output = TraceStore(*loadNode.input(n)->origin(), address, type, nullptr, pointerSize);
+    auto node = dynamic_cast<const StoreNode*>(output ? jive::node_output::node(output) : nullptr);
+    if (node == nullptr || (storeNode != nullptr && node != storeNode))
+      return false;
+
+    storeNode = node;
+  }
+
+  if (storeNode == nullptr
+      || GetAliasRelation(
+           *storeNode->GetAddressInput()->origin(),
+           storeNode->GetValueInput()->type(),
+           address,
+           type,
+           pointerSize) != AliasRelation::MustAlias
+      || storeNode->GetValueInput()->type() != type)
+    return false;
+
+  auto value = RouteToRegion(*storeNode->GetValueInput()->origin(), *loadNode.region());
+
+  loadNode.GetValueOutput()->divert_users(value);
+  for (size_t n = 1; n < loadNode.noutputs(); n++)
+    loadNode.output(n)->divert_users(loadNode.input(n)->origin());
+
+  remove(&loadNode);
+  return true;
+}
+
+/**
+ * Checks whether all memory states of \p storeNode lead to a store that overwrites the stored value before it can be
+ * loaded.
+ */
+static bool
+IsOverwritten(
+  const StoreNode & storeNode,
+  size_t pointerSize)
+{
+  auto & address = *storeNode.GetAddressInput()->origin();
+  auto & type = storeNode.GetValueInput()->type();
+
+  const StoreNode * overwritingStore = nullptr;
+  for (size_t n = 0; n < storeNode.noutputs(); n++) {
+    const jive::output * output = storeNode.output(n);
+    while (true) {
+      if (output->nusers() != 1)
+        return false;
+
+      auto input = *output->begin();
+      auto node = input_node(input);
+      if (auto loadNode = dynamic_cast<const LoadNode*>(node)) {
+        if (GetAliasRelation(
+              *loadNode->GetAddressInput()->origin(),
+              loadNode->GetValueOutput()->type(),
+              address,
+              type,
+              pointerSize) != AliasRelation::NoAlias)
+          return false;
+
+        output = loadNode->output(input->index());
+        continue;
+      }
+
+      if (auto otherStore = dynamic_cast<const StoreNode*>(node)) {
+        auto relation = GetAliasRelation(
+          *otherStore->GetAddressInput()->origin(),
+          otherStore->GetValueInput()->type(),
+          address,
+          type,
+          pointerSize);
+        if (relation == AliasRelation::NoAlias) {
+          output = otherStore->output(input->index() - 2);
+          continue;
+        }
+
+        if (relation != AliasRelation::MustAlias
+            || otherStore->GetValueInput()->type() != type
+            || (overwritingStore != nullptr && overwritingStore != otherStore))
+          return false;
+
+        overwritingStore = otherStore;
+        break;
+      }
+
+      return false;
+    }
+  }
+
+  return overwritingStore != nullptr;
+}
+
+/**
+ * Checks whether the memory \p address points to might be read, either directly by a load or after the address
+ * escaped.
+ */
+static bool
+IsReadOrEscaped(const jive::output & address)
+{
+  std::unordered_set<const jive::output*> visited({&address});
+  std::vector<const jive::output*> worklist({&address});
+
+  auto push = [&](const jive::output * output)
+  {
+    if (visited.insert(output).second)
+      worklist.push_back(output);
+  };
+
+  while (!worklist.empty()) {
+    auto output = worklist.back();
+    worklist.pop_back();
+
+    for (auto & user : *output) {
+      if (auto result = dynamic_cast<const jive::result*>(user)) {
+        auto structuralOutput = result->output();
+        if (is<jive::gamma_op>(result->region()->node()) && structuralOutput) {
+          push(structuralOutput);
+          continue;
+        }
+
+        if (auto thetaOutput = dynamic_cast<const jive::theta_output*>(structuralOutput)) {
+          push(thetaOutput);
+          push(thetaOutput->argument());
+          continue;
+        }
+
+        return true;
+      }
+
+      if (auto structuralInput = dynamic_cast<const jive::structural_input*>(user)) {
+        auto structuralNode = structuralInput->node();
+        if (!is<jive::gamma_op>(structuralNode) && !is<jive::theta_op>(structuralNode))
+          return true;
+
+        for (auto & argument : structuralInput->arguments)
+          push(&argument);
+        continue;
+      }
+
+      auto node = input_node(user);
+      if (is<StoreOperation>(node) && user->index() == 0)
+        continue;
+
+      if (is<getelementptr_op>(node) || is<bitcast_op>(node)) {
+        push(node->output(0));
+        continue;
+      }
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void
+CollectLoadsAndStores(
+  jive::region & region,
+  std::vector<LoadNode*> & loadNodes,
+  std::vector<StoreNode*> & storeNodes)
+{
+  for (auto & node : region.nodes) {
+    if (auto structuralNode = dynamic_cast<jive::structural_node*>(&node)) {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectLoadsAndStores(*structuralNode->subregion(n), loadNodes, storeNodes);
+      continue;
+    }
+
+    if (auto loadNode = dynamic_cast<LoadNode*>(&node))
+      loadNodes.push_back(loadNode);
+    else if (auto storeNode = dynamic_cast<StoreNode*>(&node))
+      storeNodes.push_back(storeNode);
+  }
+}
+
+StoreForwarding::~StoreForwarding()
+= default;
+
+void
+StoreForwarding::run(
+  RvsdgModule & rvsdgModule,
+  const StatisticsDescriptor & statisticsDescriptor)
+{
+  StoreForwardingStatistics statistics(rvsdgModule.SourceFileName());
+  statistics.Start();
+
+  auto pointerSize = GetPointerSize(rvsdgModule);
+
+  std::vector<LoadNode*> loadNodes;
+  std::vector<StoreNode*> storeNodes;
+  CollectLoadsAndStores(*rvsdgModule.Rvsdg().root(), loadNodes, storeNodes);
+
+  size_t numForwardedLoads = 0;
+  for (auto & loadNode : loadNodes) {
+    if (ForwardStore(*loadNode, pointerSize))
+      numForwardedLoads++;
+  }
+
+  /*
+   * Forwarding removed loads, which might have kept stores alive.
+   */
+  size_t numRemovedStores = 0;
+  std::unordered_map<const jive::output*, bool> isReadOrEscaped;
+  for (auto & storeNode : storeNodes) {
+    auto & baseAddress = GetBaseAddress(*storeNode->GetAddressInput()->origin());
+
+    bool isDead = false;
+    if (is<alloca_op>(jive::node_output::node(&baseAddress))) {
+      if (isReadOrEscaped.find(&baseAddress) == isReadOrEscaped.end())
+        isReadOrEscaped[&baseAddress] = IsReadOrEscaped(baseAddress);
+
+      isDead = !isReadOrEscaped[&baseAddress];
+    }
+
+    if (!isDead && !IsOverwritten(*storeNode, pointerSize))
+      continue;
+
+    for (size_t n = 0; n < storeNode->noutputs(); n++)
+      storeNode->output(n)->divert_users(storeNode->input(n + 2)->origin());
+
+    remove(storeNode);
+    numRemovedStores++;
+  }
+
+  statistics.Stop(numForwardedLoads, numRemovedStores);
+  statisticsDescriptor.PrintStatistics(statistics);
+}
+
+}
@@ -13,6 +13,8 @@
 #include <jlm/util/strfmt.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+
 namespace jlm::aa {
 
 /** \brief Statistics class for basic encoder encoding
@@ -472,6 +474,28 @@ public:
     return MemoryNodes_;
   }
 
+  /** \brief Returns the sorted alias classes of \p memoryNodes.
+   *
+   * Every memory node forms its own alias class. If one of the memory nodes has no alias class, then an empty vector
+   * is returned, i.e., nothing is known about the accessed memory locations.
+   */
+  std::vector<size_t>
+  GetAliasClasses(const std::vector<const PointsToGraph::MemoryNode*> & memoryNodes) const
+  {
+    std::vector<size_t> aliasClasses;
+    aliasClasses.reserve(memoryNodes.size());
+    for (auto & memoryNode : memoryNodes) {
+      auto it = AliasClasses_.find(memoryNode);
+      if (it == AliasClasses_.end())
+        return {};
+
+      aliasClasses.push_back(it->second);
+    }
+    std::sort(aliasClasses.begin(), aliasClasses.end());
+
+    return aliasClasses;
+  }
+
   static std::unique_ptr<BasicEncoder::Context>
   Create(const PointsToGraph & pointsToGraph)
   {
@@ -498,10 +522,14 @@ private:
       MemoryNodes_.push_back(&importNode);
 
     MemoryNodes_.push_back(&pointsToGraph.GetExternalMemoryNode());
+
+    for (size_t n = 0; n < MemoryNodes_.size(); n++)
+      AliasClasses_[MemoryNodes_[n]] = n;
   }
 
   RegionalizedStateMap RegionalizedStateMap_;
   std::vector<const PointsToGraph::MemoryNode*> MemoryNodes_;
+  std::unordered_map<const PointsToGraph::MemoryNode*, size_t> AliasClasses_;
 };
 
 BasicEncoder::~BasicEncoder()
@@ -610,9 +638,10 @@ BasicEncoder::EncodeLoad(const LoadNode & loadNode)
 
   auto address = loadNode.GetAddressInput()->origin();
   auto instates = stateMap.GetStates(*address);
+  auto aliasClasses = Context_->GetAliasClasses(stateMap.GetMemoryNodes(*address));
   auto oldResult = loadNode.GetValueOutput();
 
-  auto outputs = LoadNode::Create(address, instates, loadOperation.GetAlignment());
+  auto outputs = LoadNode::Create(address, instates, loadOperation.GetAlignment(), std::move(aliasClasses));
   oldResult->divert_users(outputs[0]);
 
   stateMap.ReplaceStates(*address, {std::next(outputs.begin()), outputs.end()});
@@ -630,12 +659,14 @@ BasicEncoder::EncodeStore(const StoreNode & storeNode)
   auto address = storeNode.GetAddressInput()->origin();
   auto value = storeNode.GetValueInput()->origin();
   auto inStates = stateMap.GetStates(*address);
+  auto aliasClasses = Context_->GetAliasClasses(stateMap.GetMemoryNodes(*address));
 
   auto outStates = StoreNode::Create(
     address,
     value,
     inStates,
-    storeOperation.GetAlignment());
+    storeOperation.GetAlignment(),
+    std::move(aliasClasses));
 
   stateMap.ReplaceStates(*address, outStates);
 }
@@ -708,6 +739,22 @@ BasicEncoder::EncodeMemcpy(const jive::simple_node & memcpyNode)
   stateMap.ReplaceStates(*source, {end, outStates.end()});
 }
 
+void
+BasicEncoder::EncodeMemset(const jive::simple_node & memsetNode)
+{
+  JLM_ASSERT(is<Memset>(&memsetNode));
+  auto & stateMap = Context_->GetRegionalizedStateMap();
+
+  auto destination = memsetNode.input(0)->origin();
+  auto value = memsetNode.input(1)->origin();
+  auto length = memsetNode.input(2)->origin();
+  auto isVolatile = memsetNode.input(3)->origin();
+
+  auto inStates = stateMap.GetStates(*destination);
+  auto outStates = Memset::create(destination, value, length, isVolatile, inStates);
+  stateMap.ReplaceStates(*destination, outStates);
+}
+
 void
 BasicEncoder::Encode(const lambda::node & lambda)
 {
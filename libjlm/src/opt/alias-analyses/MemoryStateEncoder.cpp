@@ -32,7 +32,8 @@ MemoryStateEncoder::Encode(const jive::simple_node & node)
             {typeid(StoreOperation), EncodeStore},
             {typeid(CallOperation),  EncodeCall},
             {typeid(free_op),        [](auto & mse, auto & node){ mse.EncodeFree(node);   }},
-            {typeid(Memcpy),         [](auto & mse, auto & node){ mse.EncodeMemcpy(node); }}
+            {typeid(Memcpy),         [](auto & mse, auto & node){ mse.EncodeMemcpy(node); }},
+            {typeid(Memset),         [](auto & mse, auto & node){ mse.EncodeMemset(node); }}
           });
 
   auto & op = node.operation();
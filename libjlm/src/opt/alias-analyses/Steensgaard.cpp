@@ -6,7 +6,6 @@
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/structural-node.hpp>
-#include <jive/rvsdg/traverser.hpp>
 
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/ir/types.hpp>
@@ -17,6 +16,8 @@
 #include <jlm/util/strfmt.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+
 /*
 	FIXME: to be removed again
 */
@@ -612,7 +613,7 @@ LocationSet::InsertRegisterLocation(
   auto registerLocation = RegisterLocation::Create(output, pointsToFlags);
   auto registerLocationPointer = registerLocation.get();
 
-  LocationMap_[&output] = registerLocationPointer;
+  LocationMap_.insert(output, registerLocationPointer);
   DisjointLocationSet_.insert(registerLocationPointer);
   Locations_.push_back(std::move(registerLocation));
 
@@ -682,14 +683,14 @@ LocationSet::InsertImportLocation(const jive::argument & argument)
 RegisterLocation *
 LocationSet::LookupRegisterLocation(const jive::output & output)
 {
-  auto it = LocationMap_.find(&output);
-  return it == LocationMap_.end() ? nullptr : it->second;
+  auto location = LocationMap_.lookup(output);
+  return location ? *location : nullptr;
 }
 
 bool
 LocationSet::Contains(const jive::output & output) const noexcept
 {
-  return LocationMap_.find(&output) != LocationMap_.end();
+  return LocationMap_.contains(output);
 }
 
 Location &
@@ -1510,8 +1511,21 @@ Steensgaard::Analyze(jive::region & region)
 {
   using namespace jive;
 
-  topdown_traverser traverser(&region);
-  for (auto & node : traverser) {
+  /*
+   * The depth of a node exceeds the depths of all its predecessors. Sorting the nodes by depth therefore yields a
+   * topological order without the overhead of a traverser, which registers with the graph's notifiers.
+   */
+  std::vector<const jive::node*> nodes;
+  nodes.reserve(region.nodes.size());
+  for (auto & node : region.nodes)
+    nodes.push_back(&node);
+
+  std::stable_sort(nodes.begin(), nodes.end(), [](const jive::node * x, const jive::node * y)
+  {
+    return x->depth() < y->depth();
+  });
+
+  for (auto & node : nodes) {
     if (auto simpleNode = dynamic_cast<const simple_node*>(node)) {
       Analyze(*simpleNode);
       continue;
@@ -11,6 +11,7 @@
 #include <jlm/util/time.hpp>
 
 #include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/side-table.hpp>
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/theta.hpp>
 #include <jive/rvsdg/traverser.hpp>
@@ -87,14 +88,12 @@ public:
 		if (s1 == s2)
 			return;
 
-		if (s2->size() < s1->size()) {
-			s1 = outputs_[o2];
-			s2 = outputs_[o1];
-		}
+		if (s2->size() < s1->size())
+			std::swap(s1, s2);
 
 		for (auto & o : *s1) {
 			s2->insert(o);
-			outputs_[o] = s2;
+			outputs_[*o] = s2;
 		}
 	}
 
@@ -113,11 +112,11 @@ public:
 		if (o1 == o2)
 			return true;
 
-		auto it = outputs_.find(o1);
-		if (it == outputs_.end())
+		auto set = outputs_.lookup(*o1);
+		if (set == nullptr)
 			return false;
 
-		return it->second->find(o2) != it->second->end();
+		return (*set)->find(o2) != (*set)->end();
 	}
 
 	inline bool
@@ -129,18 +128,19 @@ public:
 	congruence_set *
 	set(jive::output * output) noexcept
 	{
-		if (outputs_.find(output) == outputs_.end()) {
-			std::unique_ptr<congruence_set> set(new congruence_set({output}));
-			outputs_[output] = set.get();
-			sets_.insert(std::move(set));
+		auto & set = outputs_[*output];
+		if (set == nullptr) {
+			std::unique_ptr<congruence_set> s(new congruence_set({output}));
+			set = s.get();
+			sets_.insert(std::move(s));
 		}
 
-		return outputs_[output];
+		return set;
 	}
 
 private:
 	std::unordered_set<std::unique_ptr<congruence_set>> sets_;
-	std::unordered_map<const jive::output*, congruence_set*> outputs_;
+	jive::OutputMap<congruence_set*> outputs_;
 };
 
 class vset {
@@ -240,7 +240,7 @@ congruent(
 
 	if (jive::is<jive::simple_op>(n1)
 	&& jive::is<jive::simple_op>(n2)
-	&& n1->operation() == n2->operation()
+	&& &n1->operation() == &n2->operation()
 	&& n1->ninputs() == n2->ninputs()
 	&& o1->index() == o2->index()) {
 		for (size_t n = 0; n < n1->ninputs(); n++) {
@@ -393,7 +393,7 @@ mark(const jive::simple_node * node, cnectx & ctx)
 {
 	if (node->ninputs() == 0) {
 		for (const auto & other : node->region()->top_nodes) {
-			if (&other != node && node->operation() == other.operation()) {
+			if (&other != node && &node->operation() == &other.operation()) {
 				ctx.mark(node, &other);
 				break;
 			}
@@ -408,7 +408,7 @@ mark(const jive::simple_node * node, cnectx & ctx)
 			auto other = ni ? ni->node() : nullptr;
 			if (!other
 			|| other == node
-			|| other->operation() != node->operation()
+			|| &other->operation() != &node->operation()
 			|| other->ninputs() != node->ninputs())
 				continue;
 
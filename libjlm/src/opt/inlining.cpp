@@ -6,6 +6,7 @@
 #include <jlm/common.hpp>
 #include <jlm/ir/operators.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CallGraph.hpp>
 #include <jlm/opt/inlining.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
@@ -15,6 +16,8 @@
 #include <jive/rvsdg/theta.hpp>
 #include <jive/rvsdg/traverser.hpp>
 
+#include <algorithm>
+
 namespace jlm {
 
 class ilnstat final : public Statistics {
@@ -27,6 +30,7 @@ public:
 	: Statistics(StatisticsDescriptor::StatisticsId::FunctionInlining)
   , nnodes_before_(0)
   , nnodes_after_(0)
+  , ninlined_(0)
 	{}
 
 	void
@@ -37,20 +41,22 @@ public:
 	}
 
 	void
-	stop(const jive::graph & graph)
+	stop(const jive::graph & graph, size_t ninlined)
 	{
 		nnodes_after_ = jive::nnodes(graph.root());
+		ninlined_ = ninlined;
 		timer_.stop();
 	}
 
 	virtual std::string
 	ToString() const override
 	{
-		return strfmt("ILN ", nnodes_before_, " ", nnodes_after_, " ", timer_.ns());
+		return strfmt("ILN ", nnodes_before_, " ", nnodes_after_, " ", timer_.ns(), " ", ninlined_);
 	}
 
 private:
 	size_t nnodes_before_, nnodes_after_;
+	size_t ninlined_;
 	jlm::timer timer_;
 };
 
@@ -70,7 +76,7 @@ find_producer(jive::input * input)
 	return find_producer(argument->input());
 }
 
-static jive::output *
+jive::output *
 route_to_region(jive::output * output, jive::region * region)
 {
 	JLM_ASSERT(region != nullptr);
@@ -139,34 +145,81 @@ inlineCall(jive::simple_node * call, const lambda::node * lambda)
 	remove(call);
 }
 
-static void
-inlining(jive::graph & graph)
+/*
+* Size of the callee reduced by the benefit of inlining it at a call site: the eliminated call
+* overhead and the arguments that turn into constants in the inlined body. Calls within loops
+* are executed repeatedly, so their cost is scaled down.
+*/
+static size_t
+cost(const CallGraph::CallSite & callSite, size_t calleeSize)
 {
-	auto root = graph.root();
+	static const size_t callBenefit = 4;
+	static const size_t constantArgumentBenefit = 5;
+	static const size_t loopFactor = 4;
 
-	for (auto node : jive::topdown_traverser(root)) {
-		if (!is<lambda::operation>(node))
-			continue;
+	size_t benefit = callBenefit + constantArgumentBenefit * callSite.NumConstantArguments();
+	size_t cost = calleeSize > benefit ? calleeSize - benefit : 0;
 
-		auto lambda = static_cast<const lambda::node*>(node);
+	return callSite.GetLoopDepth() > 0 ? cost / loopFactor : cost;
+}
 
-		std::vector<jive::simple_node*> calls;
-		bool onlyDirectCalls = lambda->direct_calls(&calls);
+static size_t
+inlining(RvsdgModule & rm, size_t threshold, size_t growth)
+{
+	auto callGraph = CallGraph::Create(rm);
+
+	std::unordered_map<const CallGraph::Node*, size_t> ncalls;
+	for (auto & scc : callGraph->GetSccs()) {
+		for (auto & lambda : scc) {
+			auto & node = callGraph->GetNode(*lambda);
+			ncalls[&node] = node.GetCallers().size();
+		}
+	}
 
-		if (onlyDirectCalls && calls.size() == 1)
-			inlineCall(calls[0], lambda);
+	/*
+		Small modules are granted the budget of a module with threshold nodes, such that
+		they can grow by at least a single inlined function.
+	*/
+	size_t budget = std::max(jive::nnodes(rm.Rvsdg().root()), threshold) * growth / 100;
+	size_t ninlined = 0;
+	for (auto & scc : callGraph->GetSccs()) {
+		for (auto & lambda : scc) {
+			auto & caller = callGraph->GetNode(*lambda);
+			for (auto & callSite : caller.GetCallSites()) {
+				auto callee = callSite->GetCallee();
+				if (callee == nullptr || callGraph->IsRecursive(callee->GetLambda()))
+					continue;
+
+				/*
+					The callee is dead after inlining its last call, so this does not grow the module.
+				*/
+				auto calleeSize = jive::nnodes(callee->GetLambda().subregion());
+				bool lastCall = callee->HasOnlyDirectCalls() && ncalls[callee] == 1;
+				if (!lastCall) {
+					if (calleeSize > budget || cost(*callSite, calleeSize) > threshold)
+						continue;
+					budget -= calleeSize;
+				}
+
+				inlineCall(&callSite->GetCallNode(), &callee->GetLambda());
+				ncalls[callee]--;
+				ninlined++;
+			}
+		}
 	}
+
+	return ninlined;
 }
 
 static void
-inlining(RvsdgModule & rm, const StatisticsDescriptor & sd)
+inlining(RvsdgModule & rm, const StatisticsDescriptor & sd, size_t threshold, size_t growth)
 {
 	auto & graph = rm.Rvsdg();
 
 	ilnstat stat;
 	stat.start(graph);
-	inlining(graph);
-	stat.stop(graph);
+	auto ninlined = inlining(rm, threshold, growth);
+	stat.stop(graph, ninlined);
 
   sd.PrintStatistics(stat);
 }
@@ -179,7 +232,7 @@ fctinline::~fctinline()
 void
 fctinline::run(RvsdgModule & module, const StatisticsDescriptor & sd)
 {
-	inlining(module, sd);
+	inlining(module, sd, threshold_, growth_);
 }
 
 }
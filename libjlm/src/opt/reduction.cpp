@@ -5,6 +5,7 @@
 
 #include <jive/rvsdg/binary.hpp>
 #include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/rewrite-profile.hpp>
 #include <jive/rvsdg/statemux.hpp>
 
 #include <jlm/ir/operators.hpp>
@@ -59,6 +60,41 @@ private:
 	jlm::timer timer_;
 };
 
+/**
+ * Breakdown of the ReduceNodes statistics: The attempts, applications, and time of a single rewrite rule.
+ */
+class RewriteRuleStatistics final : public Statistics {
+public:
+  ~RewriteRuleStatistics() override
+  = default;
+
+  RewriteRuleStatistics(
+    std::string_view normalForm,
+    std::string_view rule,
+    const jive::rewrite_profile::rule & counters)
+    : Statistics(StatisticsDescriptor::StatisticsId::ReduceNodes)
+    , NormalForm_(normalForm)
+    , Rule_(rule)
+    , Counters_(counters)
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("REDRULE ",
+                  NormalForm_, " ",
+                  Rule_, " ",
+                  Counters_.attempts, " ",
+                  Counters_.applications, " ",
+                  Counters_.ns);
+  }
+
+private:
+  std::string NormalForm_;
+  std::string Rule_;
+  jive::rewrite_profile::rule Counters_;
+};
+
 static void
 enable_mux_reductions(jive::graph & graph)
 {
@@ -120,10 +156,16 @@ enable_binary_reductions(jive::graph & graph)
 }
 
 static void
-reduce(RvsdgModule & rm, const StatisticsDescriptor & sd)
+reduce(RvsdgModule & rm, const StatisticsDescriptor & sd, bool timeRewrites)
 {
 	auto & graph = rm.Rvsdg();
 
+	bool profileRewrites = sd.IsPrintable(StatisticsDescriptor::StatisticsId::ReduceNodes);
+	if (profileRewrites) {
+		graph.rewrites().clear();
+		graph.rewrites().enable(timeRewrites);
+	}
+
 	redstat stat;
 	stat.start(graph);
 
@@ -138,6 +180,12 @@ reduce(RvsdgModule & rm, const StatisticsDescriptor & sd)
 	stat.end(graph);
 
   sd.PrintStatistics(stat);
+
+	if (profileRewrites) {
+		graph.rewrites().disable();
+		for (auto & [key, counters] : graph.rewrites().rules())
+			sd.PrintStatistics(RewriteRuleStatistics(key.first, key.second, counters));
+	}
 }
 
 /* nodereduction class */
@@ -148,7 +196,7 @@ nodereduction::~nodereduction()
 void
 nodereduction::run(RvsdgModule & module, const StatisticsDescriptor & sd)
 {
-	reduce(module, sd);
+	reduce(module, sd, TimeRewrites_);
 }
 
 }
@@ -48,18 +48,41 @@ public:
 		timer_.stop();
 	}
 
+	/**
+	* Records how a loop was unrolled.
+	*
+	* \param nnodes The number of nodes of the loop body.
+	* \param niterations The number of iterations of the loop, or nullptr if unknown.
+	* \param decision The unrolling decision.
+	*/
+	void
+	add_decision(
+		size_t nnodes,
+		const jive::bitvalue_repr * niterations,
+		const std::string & decision)
+	{
+		auto iterations = niterations ? std::to_string(niterations->to_uint()) : std::string("?");
+		decisions_.push_back(strfmt(nnodes, ":", iterations, ":", decision));
+	}
+
 	virtual std::string
 	ToString() const override
 	{
+		std::string decisions;
+		for (const auto & decision : decisions_)
+			decisions += " " + decision;
+
 		return strfmt("UNROLL ",
 			nnodes_before_, " ", nnodes_after_, " ",
-			timer_.ns()
+			timer_.ns(),
+			decisions
 		);
 	}
 
 private:
 	size_t nnodes_before_, nnodes_after_;
 	jlm::timer timer_;
+	std::vector<std::string> decisions_;
 };
 
 /* helper functions */
@@ -200,7 +223,7 @@ unroll_body(
 		jive::substitution_map tmap;
 		for (const auto & olv : *theta)
 			tmap.insert(olv->argument(), smap.lookup(olv->result()->origin()));
-		smap = tmap;
+		smap = std::move(tmap);
 	}
 	theta->subregion()->copy(target, smap, false, false);
 }
@@ -519,6 +542,141 @@ unroll(jive::region * region, size_t factor)
 	return unrolled;
 }
 
+/* adaptive loop unrolling */
+
+static bool
+contains_call(const jive::region * region)
+{
+	for (const auto & node : region->nodes) {
+		if (is<CallOperation>(&node))
+			return true;
+
+		if (auto structnode = dynamic_cast<const jive::structural_node*>(&node)) {
+			for (size_t n = 0; n < structnode->nsubregions(); n++) {
+				if (contains_call(structnode->subregion(n)))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/*
+	Unroll theta node within the given budget. Returns true if the theta was completely unrolled.
+*/
+static bool
+unroll(
+	jive::theta_node * theta,
+	size_t budget,
+	size_t maxfactor,
+	unrollstat & stat)
+{
+	auto nnodes = std::max(jive::nnodes(theta->subregion()), size_t(1));
+
+	if (contains_call(theta->subregion())) {
+		stat.add_decision(nnodes, nullptr, "call");
+		return false;
+	}
+
+	auto ui = unrollinfo::create(theta);
+	if (!ui) {
+		stat.add_decision(nnodes, nullptr, "unknown-idv");
+		return false;
+	}
+
+	auto niterations = ui->is_known() ? ui->niterations() : nullptr;
+	if (niterations && *niterations == 0) {
+		stat.add_decision(nnodes, niterations.get(), "none");
+		return false;
+	}
+
+	auto nf = theta->graph()->node_normal_form(typeid(jive::operation));
+	nf->set_mutable(false);
+
+	bool removed = false;
+	if (niterations && niterations->to_uint() <= budget / nnodes) {
+		/*
+			Completely unroll the loop body and remove the theta node.
+		*/
+		stat.add_decision(nnodes, niterations.get(), "full");
+		copy_body_and_unroll(theta, niterations->to_uint());
+		remove(theta);
+		removed = true;
+	} else if (niterations) {
+		/*
+			Choose the largest factor that divides the number of iterations in order to avoid
+			residual iterations.
+		*/
+		size_t factor = std::min(maxfactor, budget / nnodes);
+		while (factor >= 2 && niterations->to_uint() % factor != 0)
+			factor--;
+
+		if (factor >= 2) {
+			stat.add_decision(nnodes, niterations.get(), strfmt("factor=", factor));
+			unroll_known_theta(*ui, factor);
+		} else {
+			stat.add_decision(nnodes, niterations.get(), "budget");
+		}
+	} else {
+		size_t factor = std::min(maxfactor, budget / nnodes);
+		if (factor >= 2) {
+			stat.add_decision(nnodes, nullptr, strfmt("factor=", factor));
+			unroll_unknown_theta(*ui, factor);
+		} else {
+			stat.add_decision(nnodes, nullptr, "budget");
+		}
+	}
+
+	nf->set_mutable(true);
+	return removed;
+}
+
+/*
+	Unroll all thetas in the region bottom-up. Returns true if the region still contains thetas
+	after unrolling.
+*/
+static bool
+unroll(
+	jive::region * region,
+	size_t budget,
+	size_t maxfactor,
+	unrollstat & stat)
+{
+	/*
+		Unrolling creates new nodes in the region, which must not be visited again.
+	*/
+	std::vector<jive::structural_node*> structnodes;
+	for (auto & node : jive::topdown_traverser(region)) {
+		if (auto structnode = dynamic_cast<jive::structural_node*>(node))
+			structnodes.push_back(structnode);
+	}
+
+	bool hastheta = false;
+	for (auto & structnode : structnodes) {
+		bool hasinnertheta = false;
+		for (size_t n = 0; n < structnode->nsubregions(); n++)
+			hasinnertheta |= unroll(structnode->subregion(n), budget, maxfactor, stat);
+
+		auto theta = dynamic_cast<jive::theta_node*>(structnode);
+		if (!theta) {
+			hastheta |= hasinnertheta;
+			continue;
+		}
+
+		if (hasinnertheta) {
+			stat.add_decision(jive::nnodes(theta->subregion()), nullptr, "inner-loop");
+			hastheta = true;
+			continue;
+		}
+
+		if (!unroll(theta, budget, maxfactor, stat))
+			hastheta = true;
+	}
+
+	return hastheta;
+}
+
 /* loopunroll class */
 
 loopunroll::~loopunroll()
@@ -527,14 +685,17 @@ loopunroll::~loopunroll()
 void
 loopunroll::run(RvsdgModule & module, const StatisticsDescriptor & sd)
 {
-	if (factor_ < 2)
+	if (factor_ < 2 && budget_ == 0)
 		return;
 
 	unrollstat stat;
 
 	stat.start(module.Rvsdg());
 	jive::graph & graph = module.Rvsdg();
-	unroll(graph.root(), factor_);
+	if (budget_ == 0)
+		unroll(graph.root(), factor_);
+	else
+		unroll(graph.root(), budget_, factor_, stat);
 	stat.end(module.Rvsdg());
 
   sd.PrintStatistics(stat);
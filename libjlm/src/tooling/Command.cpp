@@ -5,6 +5,7 @@
 
 #include <jlm/tooling/Command.hpp>
 #include <jlm/tooling/CommandPaths.hpp>
+#include <jlm/tooling/JlmOptServer.hpp>
 #include <jlm/util/strfmt.hpp>
 
 #include <sys/stat.h>
@@ -246,21 +247,45 @@ JlmOptCommand::~JlmOptCommand()
 std::string
 JlmOptCommand::ToString() const
 {
-  std::string optimizationArguments;
+  std::string command;
+  for (auto & argument : GetArguments())
+    command += (command.empty() ? "" : " ") + argument;
+
+  return command;
+}
+
+std::vector<std::string>
+JlmOptCommand::GetArguments() const
+{
+  std::vector<std::string> arguments({"jlm-opt", "--llvm"});
   for (auto & optimization : Optimizations_)
-    optimizationArguments += ToString(optimization) + " ";
+    arguments.push_back(ToString(optimization));
 
-  return strfmt(
-    "jlm-opt ",
-    "--llvm ",
-    optimizationArguments,
-    "-o ", OutputFile_.to_str(), " ",
-    InputFile_.to_str());
+  if (InliningThreshold_.has_value())
+    arguments.push_back(strfmt("--iln-threshold=", InliningThreshold_.value()));
+
+  if (InliningGrowth_.has_value())
+    arguments.push_back(strfmt("--iln-growth=", InliningGrowth_.value()));
+
+  arguments.push_back("-o");
+  arguments.push_back(OutputFile_.to_str());
+  arguments.push_back(InputFile_.to_str());
+
+  return arguments;
 }
 
 void
 JlmOptCommand::Run() const
 {
+  if (ServerSocket_.has_value()) {
+    auto exitStatus = JlmOptServer::SendRequest(ServerSocket_.value(), GetArguments());
+    if (exitStatus.has_value()) {
+      if (exitStatus.value() != EXIT_SUCCESS)
+        exit(EXIT_FAILURE);
+      return;
+    }
+  }
+
   if (system(ToString().c_str()))
     exit(EXIT_FAILURE);
 }
@@ -273,12 +298,19 @@ JlmOptCommand::ToString(const Optimization & optimization)
           {Optimization::AASteensgaardBasic, "--AASteensgaardBasic"},
           {Optimization::CommonNodeElimination, "--cne"},
           {Optimization::DeadNodeElimination, "--dne"},
+          {Optimization::FunctionAttributeInference, "--FunctionAttributeInference"},
           {Optimization::FunctionInlining, "--iln"},
+          {Optimization::FunctionSpecialization, "--FunctionSpecialization"},
           {Optimization::InvariantValueRedirection, "--InvariantValueRedirection"},
+          {Optimization::LoopIdiomRecognition, "--LoopIdiomRecognition"},
+          {Optimization::LoopStrengthReduction, "--LoopStrengthReduction"},
           {Optimization::LoopUnrolling, "--url"},
           {Optimization::NodePullIn, "--pll"},
           {Optimization::NodePushOut, "--psh"},
           {Optimization::NodeReduction, "--red"},
+          {Optimization::SlpVectorizer, "--SlpVectorizer"},
+          {Optimization::SparseConditionalConstantPropagation, "--SparseConditionalConstantPropagation"},
+          {Optimization::StoreForwarding, "--StoreForwarding"},
           {Optimization::ThetaGammaInversion, "--ivt"}
         });
 
@@ -0,0 +1,347 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/tooling/JlmOptServer.hpp>
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace jlm {
+
+/*
+ * A request starts with the size of its payload, which is sent together with the standard input, output, and error
+ * file descriptors of the client. The payload consists of the null-terminated working directory and command line
+ * arguments. The reply is the exit status of the request.
+ */
+static const size_t NumFileDescriptors = 3;
+
+static bool
+WriteAll(int fd, const void * data, size_t size)
+{
+  auto bytes = static_cast<const char*>(data);
+  while (size != 0) {
+    auto n = write(fd, bytes, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+
+    bytes += n;
+    size -= n;
+  }
+
+  return true;
+}
+
+static bool
+ReadAll(int fd, void * data, size_t size)
+{
+  auto bytes = static_cast<char*>(data);
+  while (size != 0) {
+    auto n = read(fd, bytes, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+
+    bytes += n;
+    size -= n;
+  }
+
+  return true;
+}
+
+static bool
+CreateAddress(const filepath & socket, sockaddr_un & address)
+{
+  auto path = socket.to_str();
+  if (path.size() >= sizeof(address.sun_path))
+    return false;
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path, path.c_str(), path.size()+1);
+  return true;
+}
+
+static int
+Connect(const filepath & socket)
+{
+  sockaddr_un address;
+  if (!CreateAddress(socket, address))
+    return -1;
+
+  auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    return -1;
+
+  if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+static bool
+SendFileDescriptors(
+  int connection,
+  uint32_t payloadSize,
+  const int (&fds)[NumFileDescriptors])
+{
+  char control[CMSG_SPACE(sizeof(fds))];
+  memset(control, 0, sizeof(control));
+
+  iovec iov;
+  iov.iov_base = &payloadSize;
+  iov.iov_len = sizeof(payloadSize);
+
+  msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+
+  auto cmsg = CMSG_FIRSTHDR(&message);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+  return sendmsg(connection, &message, 0) == sizeof(payloadSize);
+}
+
+static bool
+ReceiveFileDescriptors(
+  int connection,
+  uint32_t & payloadSize,
+  int (&fds)[NumFileDescriptors])
+{
+  char control[CMSG_SPACE(sizeof(fds))];
+
+  iovec iov;
+  iov.iov_base = &payloadSize;
+  iov.iov_len = sizeof(payloadSize);
+
+  msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+
+  if (recvmsg(connection, &message, 0) != sizeof(payloadSize))
+    return false;
+
+  auto cmsg = CMSG_FIRSTHDR(&message);
+  if (cmsg == nullptr
+      || cmsg->cmsg_level != SOL_SOCKET
+      || cmsg->cmsg_type != SCM_RIGHTS
+      || cmsg->cmsg_len != CMSG_LEN(sizeof(fds)))
+    return false;
+
+  memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+  return true;
+}
+
+/*
+ * Runs a single request in a forked process and replies with its exit status.
+ */
+static void
+HandleRequest(
+  int connection,
+  const JlmOptServer::Handler & handler)
+{
+  uint32_t payloadSize;
+  int fds[NumFileDescriptors];
+  if (!ReceiveFileDescriptors(connection, payloadSize, fds))
+    return;
+
+  std::vector<char> payload(payloadSize);
+  if (!ReadAll(connection, payload.data(), payload.size()) || payload.empty() || payload.back() != '\0') {
+    for (auto fd : fds)
+      close(fd);
+    return;
+  }
+
+  std::vector<char*> strings;
+  for (size_t n = 0; n < payload.size(); n += strlen(&payload[n]) + 1)
+    strings.push_back(&payload[n]);
+  auto directory = strings[0];
+  std::vector<char*> argv(strings.begin()+1, strings.end());
+  argv.push_back(nullptr);
+
+  auto pid = fork();
+  if (pid == 0) {
+    close(connection);
+    for (size_t n = 0; n < NumFileDescriptors; n++) {
+      dup2(fds[n], n);
+      close(fds[n]);
+    }
+
+    if (argv.size() < 2 || chdir(directory) != 0)
+      _exit(EXIT_FAILURE);
+
+    exit(handler(argv.size()-1, argv.data()));
+  }
+
+  for (auto fd : fds)
+    close(fd);
+
+  int32_t exitStatus = EXIT_FAILURE;
+  int status;
+  if (pid > 0 && waitpid(pid, &status, 0) == pid)
+    exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+  WriteAll(connection, &exitStatus, sizeof(exitStatus));
+}
+
+/**
+ * Returns true if the peer of \p connection runs with the same user id as the server. Requests run with the
+ * privileges of the server, and must therefore not be accepted from other users.
+ */
+static bool
+IsSameUser(int connection)
+{
+  ucred credentials;
+  socklen_t size = sizeof(credentials);
+  if (getsockopt(connection, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+    return false;
+
+  return credentials.uid == getuid();
+}
+
+static char SocketPath[sizeof(sockaddr_un::sun_path)];
+
+static void
+RemoveSocket(int signal)
+{
+  unlink(SocketPath);
+  _exit(128 + signal);
+}
+
+int
+JlmOptServer::Run(const Handler & handler) const
+{
+  sockaddr_un address;
+  if (!CreateAddress(Socket_, address)) {
+    std::cerr << "jlm-opt: Socket path is too long: " << Socket_.to_str() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  auto fd = Connect(Socket_);
+  if (fd >= 0) {
+    close(fd);
+    std::cerr << "jlm-opt: A server is already listening on " << Socket_.to_str() << "\n";
+    return EXIT_FAILURE;
+  }
+  unlink(address.sun_path);
+
+  /* only the user of the server can connect to the socket */
+  auto mask = umask(0077);
+  auto listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  auto bound = listener >= 0 && bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+  umask(mask);
+  if (!bound
+      || chmod(address.sun_path, S_IRUSR | S_IWUSR) != 0
+      || listen(listener, SOMAXCONN) != 0) {
+    std::cerr << "jlm-opt: Cannot listen on " << Socket_.to_str() << ": " << strerror(errno) << "\n";
+    return EXIT_FAILURE;
+  }
+
+  /* the path is null-terminated, as its length was validated by CreateAddress() */
+  memcpy(SocketPath, address.sun_path, sizeof(SocketPath));
+  signal(SIGINT, RemoveSocket);
+  signal(SIGTERM, RemoveSocket);
+  /* request processes are reaped automatically */
+  signal(SIGCHLD, SIG_IGN);
+
+  while (true) {
+    auto connection = accept(listener, nullptr, nullptr);
+    if (connection < 0) {
+      if (errno == EINTR || errno == ECONNABORTED)
+        continue;
+
+      std::cerr << "jlm-opt: Cannot accept connection on " << Socket_.to_str() << ": " << strerror(errno) << "\n";
+      if (errno != EMFILE && errno != ENFILE && errno != ENOBUFS && errno != ENOMEM) {
+        unlink(SocketPath);
+        return EXIT_FAILURE;
+      }
+
+      /* wait for running requests to release their resources */
+      sleep(1);
+      continue;
+    }
+
+    if (!IsSameUser(connection)) {
+      close(connection);
+      continue;
+    }
+
+    auto pid = fork();
+    if (pid == 0) {
+      close(listener);
+      signal(SIGINT, SIG_DFL);
+      signal(SIGTERM, SIG_DFL);
+      signal(SIGCHLD, SIG_DFL);
+
+      HandleRequest(connection, handler);
+      _exit(EXIT_SUCCESS);
+    }
+
+    close(connection);
+  }
+}
+
+std::optional<int>
+JlmOptServer::SendRequest(
+  const filepath & socket,
+  const std::vector<std::string> & arguments)
+{
+  auto connection = Connect(socket);
+  if (connection < 0)
+    return std::nullopt;
+
+  char directory[PATH_MAX];
+  if (getcwd(directory, sizeof(directory)) == nullptr) {
+    close(connection);
+    return std::nullopt;
+  }
+
+  std::string payload(directory);
+  payload.push_back('\0');
+  for (auto & argument : arguments) {
+    payload += argument;
+    payload.push_back('\0');
+  }
+
+  int fds[NumFileDescriptors] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  std::cout.flush();
+  std::cerr.flush();
+  if (!SendFileDescriptors(connection, payload.size(), fds)
+      || !WriteAll(connection, payload.data(), payload.size())) {
+    close(connection);
+    return std::nullopt;
+  }
+
+  int32_t exitStatus;
+  if (!ReadAll(connection, &exitStatus, sizeof(exitStatus)))
+    exitStatus = EXIT_FAILURE;
+  close(connection);
+
+  return exitStatus;
+}
+
+}
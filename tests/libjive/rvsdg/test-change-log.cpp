@@ -0,0 +1,205 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/notifiers.hpp>
+
+#include <assert.h>
+#include <unordered_map>
+
+static void
+test_nodes()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto i = graph.add_import({vt, "i"});
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	auto x = graph.add_export(n1->output(0), {vt, "x"});
+
+	auto transform = [&]()
+	{
+		auto n2 = jlm::test_op::create(graph.root(), {i}, {&vt});
+		auto n3 = jlm::test_op::create(graph.root(), {n2->output(0)}, {&vt});
+		x->divert_to(n3->output(0));
+		jive::remove(n1);
+		assert(graph.root()->nnodes() == 2);
+		return n3;
+	};
+
+	graph.checkpoint();
+	transform();
+	graph.rollback();
+
+	assert(graph.changes().ncheckpoints() == 0);
+	assert(graph.changes().nchanges() == 0);
+	assert(graph.root()->nnodes() == 1);
+	assert(graph.root()->nodes.first() == n1);
+	assert(graph.root()->bottom_nodes.empty());
+	assert(x->origin() == n1->output(0));
+	assert(i->nusers() == 1);
+
+	graph.checkpoint();
+	auto n3 = transform();
+	graph.commit();
+
+	assert(graph.changes().nchanges() == 0);
+	assert(graph.root()->nnodes() == 2);
+	assert(x->origin() == n3->output(0));
+	assert(i->nusers() == 1);
+}
+
+static void
+test_nesting()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto i = graph.add_import({vt, "i"});
+
+	graph.checkpoint();
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&vt});
+
+	graph.checkpoint();
+	auto n2 = jlm::test_op::create(graph.root(), {n1->output(0)}, {&vt});
+	graph.add_export(n2->output(0), {vt, "x"});
+	graph.rollback();
+
+	assert(graph.root()->nnodes() == 1);
+	assert(graph.root()->nresults() == 0);
+	assert(graph.changes().ncheckpoints() == 1);
+
+	graph.checkpoint();
+	jive::remove(n1);
+	graph.commit();
+
+	assert(graph.root()->nnodes() == 0);
+	assert(graph.changes().ncheckpoints() == 1);
+
+	/* the outer rollback also undoes the committed inner changes */
+	graph.rollback();
+	assert(graph.root()->nnodes() == 0);
+	assert(i->nusers() == 0);
+
+	try {
+		graph.commit();
+		assert(0);
+	} catch (jive::compiler_error &) {}
+}
+
+static void
+test_ports()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto p = graph.add_import({jive::ctl2, "p"});
+	auto v = graph.add_import({vt, "v"});
+
+	auto gamma = jive::gamma_node::create(p, 2);
+	auto ev = gamma->add_entryvar(v);
+	auto xv = gamma->add_exitvar({ev->argument(0), ev->argument(1)});
+	auto x = graph.add_export(xv, {vt, "x"});
+
+	auto transform = [&]()
+	{
+		auto ev2 = gamma->add_entryvar(v);
+		gamma->add_exitvar({ev2->argument(0), ev2->argument(1)});
+
+		x->divert_to(v);
+		for (size_t r = 0; r < gamma->nsubregions(); r++)
+			gamma->subregion(r)->remove_result(0);
+		gamma->remove_output(0);
+
+		for (size_t r = 0; r < gamma->nsubregions(); r++)
+			gamma->subregion(r)->remove_argument(0);
+		gamma->remove_input(1);
+
+		auto gamma2 = jive::gamma_node::create(p, 2);
+		gamma2->add_entryvar(v);
+
+		assert(gamma->ninputs() == 2 && gamma->noutputs() == 1);
+		assert(gamma->subregion(0)->narguments() == 1);
+	};
+
+	graph.checkpoint();
+	transform();
+	graph.rollback();
+
+	assert(graph.root()->nnodes() == 1);
+	assert(v->nusers() == 1);
+	assert(gamma->ninputs() == 2 && gamma->input(1) == ev);
+	assert(gamma->noutputs() == 1 && gamma->output(0) == xv);
+	for (size_t r = 0; r < gamma->nsubregions(); r++) {
+		auto subregion = gamma->subregion(r);
+		assert(subregion->narguments() == 1 && subregion->nresults() == 1);
+		assert(ev->argument(r) == subregion->argument(0));
+		assert(subregion->result(0)->origin() == subregion->argument(0));
+		assert(subregion->result(0)->output() == xv);
+	}
+	assert(x->origin() == xv);
+
+	graph.checkpoint();
+	transform();
+	jive::remove(gamma);
+	graph.commit();
+
+	assert(graph.root()->nnodes() == 1);
+	assert(v->nusers() == 2);
+}
+
+static void
+test_notifications()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto i = graph.add_import({vt, "i"});
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	auto x = graph.add_export(n1->output(0), {vt, "x"});
+
+	std::unordered_map<const jive::node*, int> nodes;
+	auto create = jive::on_node_create.connect([&](jive::node * node) { nodes[node]++; });
+	auto destroy = jive::on_node_destroy.connect([&](jive::node * node) { nodes[node]--; });
+
+	/*
+		Every removed node is notified as destroyed exactly once, and a rolled back removal is
+		notified as created again.
+	*/
+	graph.checkpoint();
+	auto n2 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	x->divert_to(n2->output(0));
+	jive::remove(n1);
+	graph.rollback();
+
+	assert(nodes.size() == 2 && nodes[n1] == 0 && nodes[n2] == 0);
+
+	graph.checkpoint();
+	auto n3 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	x->divert_to(n3->output(0));
+	jive::remove(n1);
+	graph.commit();
+
+	assert(nodes[n1] == -1 && nodes[n3] == 1);
+}
+
+static int
+test()
+{
+	test_nodes();
+	test_nesting();
+	test_ports();
+	test_notifications();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-change-log", test)
@@ -59,4 +59,47 @@ test_main()
 	return 0;
 }
 
-JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-cse", test_main)
+static int
+test_incremental_normalization()
+{
+	using namespace jive;
+
+	jlm::valuetype t;
+
+	jive::graph graph;
+	auto i1 = graph.add_import({t, "i1"});
+	auto i2 = graph.add_import({t, "i2"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {i1}, {&t});
+	auto n2 = jlm::test_op::create(graph.root(), {i2}, {&t});
+
+	auto e1 = graph.add_export(n1->output(0), {t, "o1"});
+	auto e2 = graph.add_export(n2->output(0), {t, "o2"});
+
+	graph.normalize();
+	assert(graph.ndirty_nodes() == 0);
+	assert(e1->origin() != e2->origin());
+
+	/*
+	 * Only the node with the changed operand is normalized.
+	 */
+	n2->input(0)->divert_to(i1);
+	assert(graph.ndirty_nodes() == 1);
+
+	graph.normalize();
+	assert(graph.ndirty_nodes() == 0);
+	assert(e1->origin() == e2->origin());
+
+	return 0;
+}
+
+static int
+test()
+{
+	test_main();
+	test_incremental_normalization();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-cse", test)
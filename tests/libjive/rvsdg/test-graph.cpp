@@ -115,6 +115,25 @@ test_prune_replace(void)
 
 JLM_UNIT_TEST_REGISTER("rvsdg/test-prune-replace", test_prune_replace)
 
+static void
+test_graph_copy()
+{
+	jlm::valuetype type;
+
+	jive::graph graph;
+	auto i = graph.add_import({type, "i"});
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&type});
+	graph.add_export(n1->output(0), {type, "o"});
+
+	auto copy = graph.copy();
+	assert(copy->root()->narguments() == 1);
+	assert(copy->root()->nresults() == 1);
+	assert(copy->root()->nnodes() == 1);
+
+	auto n2 = jive::node_output::node(copy->root()->result(0)->origin());
+	assert(n2->input(0)->origin() == copy->root()->argument(0));
+}
+
 static int
 test_graph(void)
 {
@@ -131,7 +150,9 @@ test_graph(void)
 	auto n2 = jlm::test_op::create(graph.root(), {n1->output(0)}, {});
 	assert(n2);
 	assert(n2->depth() == 1);
-	
+
+	test_graph_copy();
+
 	return 0;
 }
 
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/substitution.hpp>
+
+#include <assert.h>
+
+/*
+	An operation that compares equal to all operations of its class irrespective of its ports, or
+	only to itself if it is not internable.
+*/
+class lax_op final : public jive::simple_op {
+public:
+	lax_op(size_t narguments, bool internable)
+	: simple_op(std::vector<jive::port>(narguments, jive::port(jlm::statetype())), {jlm::statetype()})
+	, internable_(internable)
+	{}
+
+	virtual bool
+	operator==(const operation & other) const noexcept override
+	{
+		if (!internable_)
+			return this == &other;
+
+		return dynamic_cast<const lax_op*>(&other) != nullptr;
+	}
+
+	virtual bool
+	internable() const noexcept override
+	{
+		return internable_;
+	}
+
+	virtual std::string
+	debug_string() const override
+	{
+		return "lax_op";
+	}
+
+	virtual std::unique_ptr<jive::operation>
+	copy() const override
+	{
+		return std::unique_ptr<jive::operation>(new lax_op(*this));
+	}
+
+private:
+	bool internable_;
+};
+
+static void
+test_sharing()
+{
+	jlm::valuetype vt;
+	jlm::statetype st;
+
+	jive::graph graph;
+	auto i = graph.add_import({vt, "i"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	auto n2 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	auto n3 = jlm::test_op::create(graph.root(), {i}, {&st});
+
+	/*
+	 * Equal operations are shared, different operations are not.
+	 */
+	assert(&n1->operation() == &n2->operation());
+	assert(&n1->operation() != &n3->operation());
+	assert(n1->operation() != n3->operation());
+	assert(graph.operations().size() == 2);
+
+	/*
+	 * An operation is released with the last node that references it.
+	 */
+	remove(n1);
+	assert(graph.operations().size() == 2);
+	remove(n2);
+	assert(graph.operations().size() == 1);
+	assert(graph.operations().find(n3->operation()) == &n3->operation());
+
+	auto n4 = jlm::test_op::create(graph.root(), {i}, {&vt});
+	assert(graph.operations().find(n4->operation()) == &n4->operation());
+	assert(graph.operations().size() == 2);
+}
+
+static void
+test_release()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto i = graph.add_import({vt, "i"});
+
+	/*
+	 * Creating and removing nodes with distinct operations does not grow the interner.
+	 */
+	for (size_t n = 0; n < 100; n++) {
+		std::vector<const jive::type*> types(n+1, &vt);
+		auto node = jlm::test_op::create(graph.root(), {i}, types);
+		assert(graph.operations().size() == 1);
+		remove(node);
+		assert(graph.operations().size() == 0);
+	}
+}
+
+static void
+test_copy()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph1;
+	auto i = graph1.add_import({vt, "i"});
+	auto n1 = jlm::test_op::create(graph1.root(), {i}, {&vt});
+	graph1.add_export(n1->output(0), {vt, "x"});
+
+	/*
+	 * Copied nodes reference the operations of their own graph.
+	 */
+	auto graph2 = graph1.copy();
+	auto n2 = jive::node_output::node(graph2->root()->result(0)->origin());
+	assert(n2->operation() == n1->operation());
+	assert(&n2->operation() != &n1->operation());
+	assert(&n2->operation() == graph2->operations().find(n1->operation()));
+	assert(graph2->operations().size() == 1);
+}
+
+static void
+test_ports()
+{
+	jlm::statetype st;
+
+	jive::graph graph;
+	auto i = graph.add_import({st, "i"});
+
+	/*
+		Operations with different ports are not shared, even if they compare equal.
+	*/
+	auto n1 = jive::simple_node::create(graph.root(), lax_op(1, true), {i});
+	auto n2 = jive::simple_node::create(graph.root(), lax_op(2, true), {i, i});
+	auto n3 = jive::simple_node::create(graph.root(), lax_op(2, true), {i, i});
+	assert(&n1->operation() != &n2->operation());
+	assert(&n2->operation() == &n3->operation());
+	assert(n2->ninputs() == 2);
+	assert(graph.operations().size() == 2);
+}
+
+static void
+test_not_internable()
+{
+	jlm::statetype st;
+
+	jive::graph graph;
+	auto i = graph.add_import({st, "i"});
+
+	/*
+		Operations that are not internable are owned by their nodes.
+	*/
+	auto n1 = jive::simple_node::create(graph.root(), lax_op(1, false), {i});
+	auto n2 = jive::simple_node::create(graph.root(), lax_op(1, false), {i});
+	assert(&n1->operation() != &n2->operation());
+	assert(n1->operation() != n2->operation());
+	assert(graph.operations().size() == 0);
+
+	remove(n1);
+	remove(n2);
+	assert(graph.operations().size() == 0);
+}
+
+static int
+test()
+{
+	test_sharing();
+	test_release();
+	test_copy();
+	test_ports();
+	test_not_internable();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-operation-interner", test)
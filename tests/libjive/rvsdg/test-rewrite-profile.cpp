@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <assert.h>
+
+#include <jive/rvsdg.hpp>
+#include <jive/rvsdg/rewrite-profile.hpp>
+#include <jive/rvsdg/statemux.hpp>
+
+static void
+setup_muxes(jive::graph & graph)
+{
+	jlm::statetype st;
+
+	auto nf = static_cast<jive::mux_normal_form*>(graph.node_normal_form(typeid(jive::mux_op)));
+	nf->set_mutable(false);
+	nf->set_mux_mux_reducible(false);
+	nf->set_multiple_origin_reducible(false);
+
+	auto x = graph.add_import({st, "x"});
+	auto y = graph.add_import({st, "y"});
+
+	auto mux1 = jive::create_state_merge(st, {x, x});
+	auto mux2 = jive::create_state_merge(st, {x, y});
+	graph.add_export(mux1, {mux1->type(), "m1"});
+	graph.add_export(mux2, {mux2->type(), "m2"});
+
+	nf->set_mutable(true);
+	nf->set_multiple_origin_reducible(true);
+}
+
+static void
+test_disabled()
+{
+	jive::graph graph;
+	setup_muxes(graph);
+
+	graph.normalize();
+
+	assert(graph.rewrites().rules().empty());
+}
+
+static void
+test_counters()
+{
+	jive::graph graph;
+	setup_muxes(graph);
+
+	graph.rewrites().enable(true);
+	graph.normalize();
+	graph.rewrites().disable();
+
+	/*
+		Both muxes are attempted, but only the one with the same origin twice is reduced. The
+		mux_mux rule is disabled and therefore never attempted.
+	*/
+	auto & rules = graph.rewrites().rules();
+	assert(rules.size() == 1);
+
+	auto it = rules.find({"mux", "multiple_origin"});
+	assert(it != rules.end());
+	assert(it->second.attempts >= 2);
+	assert(it->second.applications == 1);
+	assert(it->second.ns > 0);
+
+	graph.rewrites().clear();
+	assert(graph.rewrites().rules().empty());
+}
+
+static void
+test_untimed()
+{
+	jive::graph graph;
+	setup_muxes(graph);
+
+	graph.rewrites().enable(false);
+	graph.normalize();
+
+	auto & rule = graph.rewrites().lookup("mux", "multiple_origin");
+	assert(rule.applications == 1);
+	assert(rule.ns == 0);
+}
+
+static int
+test()
+{
+	test_disabled();
+	test_counters();
+	test_untimed();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-rewrite-profile", test)
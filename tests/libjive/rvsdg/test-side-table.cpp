@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/side-table.hpp>
+
+#include <assert.h>
+
+static void
+test_generations()
+{
+	jlm::valuetype t;
+
+	jive::graph graph;
+	auto i = graph.add_import({t, "i"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {i}, {&t});
+	auto id = n1->id();
+
+	jive::NodeMap<size_t> nodes;
+	jive::OutputMap<size_t> outputs;
+	nodes[*n1] = 1;
+	outputs.insert(*n1->output(0), 2);
+	assert(nodes.contains(*n1) && *nodes.lookup(*n1) == 1);
+	assert(outputs.contains(*n1->output(0)) && *outputs.lookup(*n1->output(0)) == 2);
+	assert(!outputs.contains(*i));
+
+	/*
+	 * The identifier of a removed node is reused, but the entry of the removed node is not visible.
+	 */
+	remove(n1);
+	auto n2 = jlm::test_op::create(graph.root(), {i}, {&t});
+	assert(n2->id() == id);
+	assert(!nodes.contains(*n2));
+	assert(!outputs.contains(*n2->output(0)));
+
+	nodes[*n2] = 3;
+	assert(*nodes.lookup(*n2) == 3);
+	assert(nodes.erase(*n2));
+	assert(!nodes.contains(*n2));
+}
+
+static void
+test_graphs()
+{
+	jlm::valuetype t;
+
+	jive::graph graph1;
+	jive::graph graph2;
+	auto i1 = graph1.add_import({t, "i"});
+	auto i2 = graph2.add_import({t, "i"});
+	assert(i1->id() == i2->id());
+
+	jive::OutputMap<bool> outputs;
+	outputs[*i1] = true;
+	assert(outputs.contains(*i1));
+	assert(!outputs.contains(*i2));
+
+	try {
+		outputs[*i2] = true;
+		assert(0);
+	} catch (jive::compiler_error &) {}
+
+	outputs.clear();
+	outputs[*i2] = true;
+	assert(outputs.contains(*i2));
+}
+
+static void
+test_reused_graph_address()
+{
+	jlm::valuetype t;
+
+	/* construct both graphs at the same address */
+	alignas(jive::graph) unsigned char storage[sizeof(jive::graph)];
+
+	auto graph1 = new (storage) jive::graph();
+	auto i1 = graph1->add_import({t, "i"});
+	auto id = i1->id();
+	auto generation = i1->generation();
+
+	jive::OutputMap<bool> outputs;
+	outputs[*i1] = true;
+	graph1->~graph();
+
+	auto graph2 = new (storage) jive::graph();
+	auto i2 = graph2->add_import({t, "i"});
+	assert(i2->id() == id && i2->generation() == generation);
+	assert(!outputs.contains(*i2));
+
+	graph2->~graph();
+}
+
+static int
+test()
+{
+	test_generations();
+	test_graphs();
+	test_reused_graph_address();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-side-table", test)
@@ -84,11 +84,98 @@ test_multiple_origin_reduction()
 	assert(node_output::node(ex->origin())->ninputs() == 1);
 }
 
+static void
+test_incremental_mux_mux_reduction()
+{
+	using namespace jive;
+
+	jlm::statetype st;
+
+	jive::graph graph;
+	auto mnf = mux_op::normal_form(&graph);
+	mnf->set_mux_mux_reducible(true);
+
+	auto x = graph.add_import({st, "x"});
+	auto y = graph.add_import({st, "y"});
+	auto z = graph.add_import({st, "z"});
+
+	auto mux1 = jive::create_state_merge(st, {x, y});
+	auto mux2 = jive::create_state_merge(st, {mux1, z});
+	auto user = jlm::test_op::create(graph.root(), {mux1}, {&st});
+
+	auto ex1 = graph.add_export(mux2, {mux2->type(), "m"});
+	auto ex2 = graph.add_export(user->output(0), {st, "u"});
+
+	/*
+	 * The second user of mux1 prevents the reduction.
+	 */
+	graph.normalize();
+	assert(node_output::node(ex1->origin())->ninputs() == 2);
+
+	/*
+	 * Removing the second user must make mux2 dirty again.
+	 */
+	ex2->divert_to(x);
+	graph.prune();
+	graph.normalize();
+	graph.prune();
+
+	auto node = node_output::node(ex1->origin());
+	assert(node->ninputs() == 3);
+	assert(node->input(0)->origin() == x);
+	assert(node->input(1)->origin() == y);
+	assert(node->input(2)->origin() == z);
+}
+
+static void
+test_incremental_mux_mux_reduction_many_users()
+{
+	using namespace jive;
+
+	jlm::statetype st;
+
+	jive::graph graph;
+	auto mnf = mux_op::normal_form(&graph);
+	mnf->set_mux_mux_reducible(true);
+
+	auto x = graph.add_import({st, "x"});
+	auto y = graph.add_import({st, "y"});
+	auto z = graph.add_import({st, "z"});
+
+	auto mux1 = jive::create_state_merge(st, {x, y});
+	auto mux2 = jive::create_state_merge(st, {mux1, z});
+
+	auto ex = graph.add_export(mux2, {mux2->type(), "m"});
+	std::vector<jive::input*> exports;
+	for (size_t n = 0; n < 3; n++) {
+		auto user = jlm::test_op::create(graph.root(), {mux1}, {&st});
+		exports.push_back(graph.add_export(user->output(0), {st, "u"}));
+	}
+
+	graph.normalize();
+	assert(node_output::node(ex->origin())->ninputs() == 2);
+
+	/*
+	 * Every removal of a user must mark the remaining users, regardless of their number.
+	 */
+	for (auto e : exports) {
+		e->divert_to(x);
+		graph.prune();
+	}
+	graph.normalize();
+	graph.prune();
+
+	auto node = node_output::node(ex->origin());
+	assert(node->ninputs() == 3);
+}
+
 static int
 test_main(void)
 {
 	test_mux_mux_reduction();
 	test_multiple_origin_reduction();
+	test_incremental_mux_mux_reduction();
+	test_incremental_mux_mux_reduction_many_users();
 
 	return 0;
 }
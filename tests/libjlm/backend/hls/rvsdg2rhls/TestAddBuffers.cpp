@@ -0,0 +1,118 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/view.hpp>
+
+#include <jlm/backend/hls/rvsdg2rhls/add-buffers.hpp>
+
+static void
+TestRecurrenceII()
+{
+  using namespace jlm::hls;
+
+  /*
+   * Arrange
+   *
+   * Two loop-carried values x and y form a single recurrence: x takes one cycle to reach the backedge of y, and y
+   * takes three cycles to reach the backedge of x. Each backedge holds one token, so the recurrence completes one
+   * iteration every (1 + 3) / 2 cycles.
+   */
+  jive::graph graph;
+
+  auto loop = loop_node::create(graph.root());
+  auto x = loop->add_backedge(jive::bit32);
+  auto y = loop->add_backedge(jive::bit32);
+
+  auto xy = buffer_op::create(*x, 1)[0];
+  y->result()->divert_to(xy);
+
+  auto yx = buffer_op::create(*buffer_op::create(*buffer_op::create(*y, 1)[0], 1)[0], 1)[0];
+  x->result()->divert_to(yx);
+
+  // jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  auto recII = estimate_rec_ii(loop);
+  auto ii = estimate_ii(loop);
+
+  /*
+   * Assert
+   */
+  assert(recII == 2);
+  assert(ii == 2);
+}
+
+static void
+TestPlaceBuffers()
+{
+  using namespace jlm::hls;
+
+  /*
+   * Arrange
+   *
+   * The loop-carried value x is forked into a path through two registers and a direct path, which reconverge
+   * in an addition. The direct path is two cycles shorter than the other one.
+   */
+  jive::graph graph;
+
+  auto loop = loop_node::create(graph.root());
+  auto x = loop->add_backedge(jive::bit32);
+
+  auto fork = fork_op::create(2, *x);
+  auto delayed = buffer_op::create(*buffer_op::create(*fork[0], 1)[0], 1)[0];
+  auto sum = jive::bitadd_op::create(32, delayed, fork[1]);
+  x->result()->divert_to(sum);
+
+  // jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  auto estimates = place_buffers(graph.root(), 1);
+
+  // jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   *
+   * A pass-through buffer with two slots balances the direct path. It has no latency, such that the II of the
+   * recurrence through the registers stays at two.
+   */
+  assert(estimates.size() == 1);
+  assert(estimates[0].loop == loop);
+  assert(estimates[0].ii == 2);
+  assert(estimates[0].slots == 2);
+
+  auto add = jive::node_output::node(x->result()->origin());
+  assert(jive::is<jive::bitadd_op>(add));
+
+  size_t nbuffers = 0;
+  for (size_t n = 0; n < add->ninputs(); n++) {
+    auto node = jive::node_output::node(add->input(n)->origin());
+    auto buffer = dynamic_cast<const buffer_op*>(&node->operation());
+    if (buffer && buffer->pass_through) {
+      assert(buffer->capacity == 2);
+      assert(node->input(0)->origin() == fork[1]);
+      nbuffers++;
+    }
+  }
+  assert(nbuffers == 1);
+}
+
+static int
+TestAddBuffers()
+{
+  TestRecurrenceII();
+  TestPlaceBuffers();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/backend/hls/rvsdg2rhls/TestAddBuffers", TestAddBuffers)
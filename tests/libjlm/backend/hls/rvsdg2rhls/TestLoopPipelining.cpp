@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jive/view.hpp>
+
+#include <jlm/backend/hls/rvsdg2rhls/loop-pipelining.hpp>
+#include <jlm/ir/operators/load.hpp>
+#include <jlm/ir/operators/store.hpp>
+
+static void
+TestSeparateMemoryRecurrences()
+{
+  using namespace jlm;
+  using namespace jlm::hls;
+
+  /*
+   * Arrange
+   *
+   * A loop with two memory states. The first one is only threaded through a load, while the second one carries
+   * the value of a load to a store of the next iteration.
+   */
+  MemoryStateType mt;
+  PointerType pt(jive::bit32);
+
+  jive::graph graph;
+  auto nf = graph.node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  auto p = graph.add_import({pt, "p"});
+  auto s1 = graph.add_import({mt, "s1"});
+  auto s2 = graph.add_import({mt, "s2"});
+
+  auto loop = loop_node::create(graph.root());
+
+  jive::output * address, * start1, * start2;
+  loop->add_loopvar(p, &address);
+  loop->add_loopvar(s1, &start1);
+  loop->add_loopvar(s2, &start2);
+
+  auto branch1 = dynamic_cast<jive::node_input*>(*start1->begin())->node();
+  auto branch2 = dynamic_cast<jive::node_input*>(*start2->begin())->node();
+  auto result1 = dynamic_cast<backedge_result*>(*branch1->output(1)->begin());
+  auto result2 = dynamic_cast<backedge_result*>(*branch2->output(1)->begin());
+  assert(result1 && result2);
+
+  auto load1 = LoadNode::Create(address, {start1}, 4);
+  branch1->input(1)->divert_to(load1[1]);
+
+  auto load2 = LoadNode::Create(address, {start2}, 4);
+  auto store2 = StoreNode::Create(address, load2[0], {load2[1]}, 4);
+  branch2->input(1)->divert_to(store2[0]);
+
+  // jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  auto separated = separate_memory_recurrences(loop);
+
+  // jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   *
+   * The next iteration continues with the first state before the load, while the second state still passes
+   * through the load and the store.
+   */
+  assert(separated == 1);
+
+  auto bypass = jive::node_output::node(result1->origin());
+  assert(jive::is<branch_op>(bypass));
+  assert(bypass != branch1);
+  assert(bypass->input(1)->origin() == start1);
+
+  assert(result2->origin() == branch2->output(1));
+  assert(branch2->input(1)->origin() == store2[0]);
+}
+
+static int
+TestLoopPipelining()
+{
+  TestSeparateMemoryRecurrences();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/backend/hls/rvsdg2rhls/TestLoopPipelining", TestLoopPipelining)
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2022 David Metz <david.c.metz@ntnu.no>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jive/view.hpp>
+
+#include <jlm/backend/hls/rvsdg2rhls/memstate-conv.hpp>
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+
+#include <unordered_set>
+
+/**
+ * @return True if \p origin is computed from an output of \p node in the same region.
+ */
+static bool
+DependsOn(jive::output * origin, const jive::node * node)
+{
+  std::unordered_set<const jive::node*> visited;
+  std::vector<jive::output*> origins({origin});
+  while (!origins.empty()) {
+    auto producer = jive::node_output::node(origins.back());
+    origins.pop_back();
+    if (producer == nullptr || !visited.insert(producer).second)
+      continue;
+
+    if (producer == node)
+      return true;
+
+    for (size_t n = 0; n < producer->ninputs(); n++)
+      origins.push_back(producer->input(n)->origin());
+  }
+
+  return false;
+}
+
+static jlm::lambda::node *
+GetLambda(jlm::RvsdgModule & module)
+{
+  auto lambda = dynamic_cast<jlm::lambda::node*>(jive::node_output::node(module.Rvsdg().root()->result(0)->origin()));
+  assert(lambda != nullptr);
+
+  return lambda;
+}
+
+/**
+ * @return The load that produces the first result of the only lambda in \p module.
+ */
+static jive::node *
+GetLoad(jlm::RvsdgModule & module)
+{
+  auto load = jive::node_output::node(GetLambda(module)->subregion()->result(0)->origin());
+  assert(jive::is<jlm::LoadOperation>(load));
+
+  return load;
+}
+
+static jive::node *
+GetStore(jlm::RvsdgModule & module)
+{
+  for (auto & node : GetLambda(module)->subregion()->nodes) {
+    if (jive::is<jlm::StoreOperation>(&node))
+      return &node;
+  }
+
+  assert(false);
+  return nullptr;
+}
+
+static void
+TestDisjointArrays()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   *
+   * uint32_t f(uint32_t i)
+   * {
+   *   uint32_t a[4], b[4];
+   *   a[i] = i;
+   *   return b[i];
+   * }
+   */
+  MemoryStateType mt;
+  arraytype at(jive::bit32, 4);
+  PointerType pt(jive::bit32);
+  FunctionType fcttype({&jive::bit32, &mt}, {&jive::bit32, &mt});
+
+  auto module = RvsdgModule::Create(filepath(""), "", "");
+  auto graph = &module->Rvsdg();
+
+  auto nf = graph->node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  auto fct = lambda::node::create(graph->root(), fcttype, "f", linkage::external_linkage);
+  auto i = fct->fctargument(0);
+
+  auto size = jive::create_bitconstant(fct->subregion(), 32, 1);
+  auto zero = jive::create_bitconstant(fct->subregion(), 32, 0);
+
+  auto a = alloca_op::create(at, size, 4);
+  auto b = alloca_op::create(at, size, 4);
+  auto merge = MemStateMergeOperator::Create({a[1], b[1], fct->fctargument(1)});
+
+  auto gepa = getelementptr_op::create(a[0], {zero, i}, pt);
+  auto store = StoreNode::Create(gepa, i, {merge}, 4);
+
+  auto gepb = getelementptr_op::create(b[0], {zero, i}, pt);
+  auto load = LoadNode::Create(gepb, {store[0]}, 4);
+
+  fct->finalize({load[0], load[1]});
+  graph->add_export(fct->output(), {PointerType(fct->type()), "f"});
+
+  // jive::view(graph->root(), stdout);
+
+  /*
+   * Act
+   */
+  hls::split_memory_states(*module);
+
+  // jive::view(graph->root(), stdout);
+
+  /*
+   * Assert
+   *
+   * The load from b no longer waits for the store to a.
+   */
+  auto loadNode = GetLoad(*module);
+  auto storeNode = GetStore(*module);
+  for (size_t n = 1; n < loadNode->ninputs(); n++)
+    assert(!DependsOn(loadNode->input(n)->origin(), storeNode));
+}
+
+static void
+TestMayAliasPointers()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   *
+   * uint32_t f(uint32_t * p, uint32_t * q, uint32_t v)
+   * {
+   *   *p = v;
+   *   return *q;
+   * }
+   */
+  MemoryStateType mt;
+  PointerType pt(jive::bit32);
+  FunctionType fcttype({&pt, &pt, &jive::bit32, &mt}, {&jive::bit32, &mt});
+
+  auto module = RvsdgModule::Create(filepath(""), "", "");
+  auto graph = &module->Rvsdg();
+
+  auto nf = graph->node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  auto fct = lambda::node::create(graph->root(), fcttype, "f", linkage::external_linkage);
+
+  auto store = StoreNode::Create(fct->fctargument(0), fct->fctargument(2), {fct->fctargument(3)}, 4);
+  auto load = LoadNode::Create(fct->fctargument(1), {store[0]}, 4);
+
+  fct->finalize({load[0], load[1]});
+  graph->add_export(fct->output(), {PointerType(fct->type()), "f"});
+
+  // jive::view(graph->root(), stdout);
+
+  /*
+   * Act
+   */
+  hls::split_memory_states(*module);
+
+  // jive::view(graph->root(), stdout);
+
+  /*
+   * Assert
+   *
+   * p and q may point to the same memory, so the load stays ordered after the store.
+   */
+  auto loadNode = GetLoad(*module);
+  auto storeNode = GetStore(*module);
+  bool ordered = false;
+  for (size_t n = 1; n < loadNode->ninputs(); n++)
+    ordered = ordered || DependsOn(loadNode->input(n)->origin(), storeNode);
+  assert(ordered);
+}
+
+static int
+TestMemstateConv()
+{
+  TestDisjointArrays();
+  TestMayAliasPointers();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/backend/hls/rvsdg2rhls/TestMemstateConv", TestMemstateConv)
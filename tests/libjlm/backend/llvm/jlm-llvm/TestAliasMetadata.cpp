@@ -0,0 +1,92 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/backend/llvm/jlm2llvm/jlm2llvm.hpp>
+#include <jlm/ir/ipgraph-module.hpp>
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/print.hpp>
+
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include <cassert>
+
+static int
+test()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::bittype bt32(32);
+  PointerType pt(bt32);
+  MemoryStateType mt;
+  ipgraph_module im(filepath(""), "", "");
+
+  std::unique_ptr<jlm::cfg> cfg(new jlm::cfg(im));
+  auto bb = basic_block::create(*cfg);
+  cfg->exit()->divert_inedges(bb);
+  bb->add_outedge(cfg->exit());
+
+  auto p1 = cfg->entry()->append_argument(argument::create("p1", pt));
+  auto p2 = cfg->entry()->append_argument(argument::create("p2", pt));
+  auto s1 = cfg->entry()->append_argument(argument::create("s1", mt));
+  auto s2 = cfg->entry()->append_argument(argument::create("s2", mt));
+
+  auto v = bb->append_last(tac::create(LoadOperation(pt, 1, 4, {0}), {p1, s1}))->result(0);
+  bb->append_last(tac::create(StoreOperation(pt, 1, 4, {1}), {p2, v, s2}));
+  auto s3 = bb->last()->result(0);
+  bb->append_last(tac::create(LoadOperation(pt, 1, 4, {0, 1}), {p1, s3}));
+
+  cfg->exit()->append_result(s3);
+
+  FunctionType ft({&pt, &pt, &mt, &mt}, {&mt});
+  auto f = function_node::create(im.ipgraph(), "f", ft, linkage::external_linkage);
+  f->add_cfg(std::move(cfg));
+
+  print(im, stdout);
+
+  /*
+   * Act
+   */
+  llvm::LLVMContext ctx;
+  auto lm = jlm2llvm::convert(im, ctx);
+
+  /*
+   * Assert
+   */
+  auto & instructions = lm->getFunction("f")->getEntryBlock().getInstList();
+  std::vector<llvm::Instruction*> memoryInstructions;
+  for (auto & instruction : instructions) {
+    if (llvm::isa<llvm::LoadInst>(instruction) || llvm::isa<llvm::StoreInst>(instruction))
+      memoryInstructions.push_back(&instruction);
+  }
+  assert(memoryInstructions.size() == 3);
+
+  auto load1 = memoryInstructions[0];
+  auto store = memoryInstructions[1];
+  auto load2 = memoryInstructions[2];
+
+  auto scope0 = load1->getMetadata(llvm::LLVMContext::MD_alias_scope);
+  auto scope1 = store->getMetadata(llvm::LLVMContext::MD_alias_scope);
+  assert(scope0 && scope0->getNumOperands() == 1);
+  assert(scope1 && scope1->getNumOperands() == 1);
+  assert(scope0->getOperand(0) != scope1->getOperand(0));
+
+  assert(load1->getMetadata(llvm::LLVMContext::MD_noalias) == scope1);
+  assert(store->getMetadata(llvm::LLVMContext::MD_noalias) == scope0);
+
+  assert(load2->getMetadata(llvm::LLVMContext::MD_alias_scope)->getNumOperands() == 2);
+  assert(load2->getMetadata(llvm::LLVMContext::MD_noalias) == nullptr);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/backend/llvm/jlm-llvm/TestAliasMetadata", test)
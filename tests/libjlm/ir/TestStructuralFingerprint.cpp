@@ -0,0 +1,142 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/operators/load.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/StructuralFingerprint.hpp>
+
+#include <cassert>
+
+/**
+ * Creates the lambda f(x) = (x + c) * g, where g is an import with the name \p import. The nodes are created in
+ * reverse order if \p reverse is true, and an additional dead node is created if \p dead is true.
+ */
+static jlm::lambda::node *
+CreateLambda(
+  jive::graph & graph,
+  const std::string & name,
+  const std::string & import,
+  int64_t c,
+  bool reverse,
+  bool dead)
+{
+  using namespace jlm;
+
+  FunctionType functionType({&jive::bit32}, {&jive::bit32});
+
+  auto g = graph.add_import(impport(jive::bit32, import, linkage::external_linkage));
+
+  auto lambda = lambda::node::create(graph.root(), functionType, name, linkage::external_linkage);
+  auto cv = lambda->add_ctxvar(g);
+
+  jive::output * constant;
+  jive::output * unused;
+  if (reverse) {
+    unused = dead ? jive::create_bitconstant(lambda->subregion(), 32, 42) : nullptr;
+    constant = jive::create_bitconstant(lambda->subregion(), 32, c);
+  } else {
+    constant = jive::create_bitconstant(lambda->subregion(), 32, c);
+    unused = dead ? jive::create_bitconstant(lambda->subregion(), 32, 42) : nullptr;
+  }
+  if (unused)
+    jive::bitmul_op::create(32, unused, lambda->fctargument(0));
+
+  auto sum = jive::bitadd_op::create(32, lambda->fctargument(0), constant);
+  auto product = jive::bitmul_op::create(32, sum, cv);
+
+  lambda->finalize({product});
+
+  return lambda;
+}
+
+static void
+TestDeterminism()
+{
+  using namespace jlm;
+
+  RvsdgModule rvsdgModule1(filepath(""), "", "");
+  RvsdgModule rvsdgModule2(filepath(""), "", "");
+
+  auto f1 = CreateLambda(rvsdgModule1.Rvsdg(), "f", "g", 1, false, false);
+  auto f2 = CreateLambda(rvsdgModule2.Rvsdg(), "f", "g", 1, true, true);
+
+  assert(ComputeStructuralFingerprint(*f1) == ComputeStructuralFingerprint(*f1));
+  assert(ComputeStructuralFingerprint(*f1) == ComputeStructuralFingerprint(*f2));
+}
+
+static void
+TestSensitivity()
+{
+  using namespace jlm;
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto f = CreateLambda(graph, "f", "g", 1, false, false);
+  auto fingerprint = ComputeStructuralFingerprint(*f);
+  assert(fingerprint.size() == 64);
+
+  assert(fingerprint != ComputeStructuralFingerprint(*CreateLambda(graph, "f", "g", 2, false, false)));
+  assert(fingerprint != ComputeStructuralFingerprint(*CreateLambda(graph, "h", "g", 1, false, false)));
+  assert(fingerprint != ComputeStructuralFingerprint(*CreateLambda(graph, "f", "k", 1, false, false)));
+}
+
+/**
+ * Creates the lambda f(p, s) = load p s with the given load alignment.
+ */
+static jlm::lambda::node *
+CreateLoadLambda(
+  jive::graph & graph,
+  size_t alignment)
+{
+  using namespace jlm;
+
+  PointerType pointerType(jive::bit32);
+  MemoryStateType memoryStateType;
+  FunctionType functionType({&pointerType, &memoryStateType}, {&jive::bit32, &memoryStateType});
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto outputs = LoadNode::Create(lambda->fctargument(0), {lambda->fctargument(1)}, alignment);
+
+  lambda->finalize(outputs);
+
+  return lambda;
+}
+
+static void
+TestOperationAttributes()
+{
+  using namespace jlm;
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  /*
+   * The debug string of load operations omits the alignment.
+   */
+  auto f1 = CreateLoadLambda(graph, 4);
+  auto f2 = CreateLoadLambda(graph, 8);
+
+  assert(ComputeStructuralFingerprint(*f1) != ComputeStructuralFingerprint(*f2));
+  assert(ComputeStructuralFingerprint(*f1) == ComputeStructuralFingerprint(*CreateLoadLambda(graph, 4)));
+}
+
+static int
+TestStructuralFingerprint()
+{
+  TestDeterminism();
+  TestSensitivity();
+  TestOperationAttributes();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/ir/TestStructuralFingerprint", TestStructuralFingerprint)
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/theta.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CallGraph.hpp>
+
+#include <cassert>
+
+static void
+TestCallSites()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&vt, &iOStateType, &memoryStateType, &loopStateType},
+    {&vt, &iOStateType, &memoryStateType, &loopStateType});
+
+  RvsdgModule rm(filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto g = graph.add_import({PointerType(functionType), "g"});
+
+  auto SetupF1 = [&]()
+  {
+    auto lambda = lambda::node::create(
+      graph.root(),
+      functionType,
+      "f1",
+      linkage::internal_linkage);
+
+    auto t = test_op::create(lambda->subregion(), {lambda->fctargument(0)}, {&vt});
+
+    lambda->finalize({t->output(0), lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+    return lambda;
+  };
+
+  auto SetupF2 = [&](lambda::node * f1)
+  {
+    auto lambda = lambda::node::create(
+      graph.root(),
+      functionType,
+      "f2",
+      linkage::external_linkage);
+    auto cvf1 = lambda->add_ctxvar(f1->output());
+    auto cvg = lambda->add_ctxvar(g);
+
+    auto callF1 = CallNode::Create(
+      cvf1,
+      {lambda->fctargument(0), lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+
+    auto theta = jive::theta_node::create(lambda->subregion());
+    auto lvf1 = theta->add_loopvar(cvf1);
+    auto lvValue = theta->add_loopvar(callF1[0]);
+    auto lvIoState = theta->add_loopvar(callF1[1]);
+    auto lvMemoryState = theta->add_loopvar(callF1[2]);
+    auto lvLoopState = theta->add_loopvar(callF1[3]);
+
+    auto callF1Loop = CallNode::Create(
+      lvf1->argument(),
+      {lvValue->argument(), lvIoState->argument(), lvMemoryState->argument(), lvLoopState->argument()});
+    lvValue->result()->divert_to(callF1Loop[0]);
+    lvIoState->result()->divert_to(callF1Loop[1]);
+    lvMemoryState->result()->divert_to(callF1Loop[2]);
+    lvLoopState->result()->divert_to(callF1Loop[3]);
+
+    auto callG = CallNode::Create(
+      cvg,
+      {lvValue, lvIoState, lvMemoryState, lvLoopState});
+
+    lambda->finalize(callG);
+    graph.add_export(lambda->output(), {lambda->output()->type(), "f2"});
+
+    return std::make_tuple(
+      lambda,
+      AssertedCast<CallNode>(jive::node_output::node(callF1[0])),
+      AssertedCast<CallNode>(jive::node_output::node(callF1Loop[0])),
+      AssertedCast<CallNode>(jive::node_output::node(callG[0])));
+  };
+
+  auto f1 = SetupF1();
+  auto [f2, callF1, callF1Loop, callG] = SetupF2(f1);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  auto callGraph = CallGraph::Create(rm);
+
+  /*
+   * Assert
+   */
+  assert(callGraph->NumNodes() == 2);
+  assert(callGraph->NumCallSites() == 3);
+
+  auto & sccs = callGraph->GetSccs();
+  assert(sccs.size() == 2);
+  assert(sccs[0].size() == 1 && sccs[0][0] == f1);
+  assert(sccs[1].size() == 1 && sccs[1][0] == f2);
+
+  auto & nodeF1 = callGraph->GetNode(*f1);
+  auto & nodeF2 = callGraph->GetNode(*f2);
+  assert(nodeF1.GetCallSites().empty());
+  assert(nodeF1.GetCallers().size() == 2);
+  assert(nodeF1.HasOnlyDirectCalls());
+  assert(!nodeF2.HasOnlyDirectCalls());
+  assert(!callGraph->IsRecursive(*f1));
+  assert(!callGraph->IsRecursive(*f2));
+
+  auto & callSites = nodeF2.GetCallSites();
+  assert(callSites.size() == 3);
+  for (auto & callSite : callSites) {
+    assert(&callSite->GetCaller() == &nodeF2);
+
+    if (&callSite->GetCallNode() == callF1) {
+      assert(callSite->GetCallee() == &nodeF1);
+      assert(callSite->GetCallType() == CallGraph::CallType::DirectCall);
+      assert(callSite->GetLoopDepth() == 0);
+    } else if (&callSite->GetCallNode() == callF1Loop) {
+      assert(callSite->GetCallee() == &nodeF1);
+      assert(callSite->GetCallType() == CallGraph::CallType::DirectCall);
+      assert(callSite->GetLoopDepth() == 1);
+    } else {
+      assert(&callSite->GetCallNode() == callG);
+      assert(callSite->GetCallee() == nullptr);
+      assert(callSite->GetCallType() == CallGraph::CallType::ExternalCall);
+      assert(callSite->GetLoopDepth() == 0);
+    }
+  }
+}
+
+static void
+TestRecursion()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&vt, &iOStateType, &memoryStateType, &loopStateType},
+    {&vt, &iOStateType, &memoryStateType, &loopStateType});
+  PointerType pt(functionType);
+
+  RvsdgModule rm(filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  phi::builder pb;
+  pb.begin(graph.root());
+  auto rv = pb.add_recvar(pt);
+
+  auto lambda = lambda::node::create(
+    pb.subregion(),
+    functionType,
+    "f",
+    linkage::external_linkage);
+  auto cvf = lambda->add_ctxvar(rv->argument());
+
+  auto callResults = CallNode::Create(
+    cvf,
+    {lambda->fctargument(0), lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+
+  auto lambdaOutput = lambda->finalize(callResults);
+  rv->result()->divert_to(lambdaOutput);
+  auto phi = pb.end();
+  graph.add_export(phi->output(0), {pt, "f"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  auto callGraph = CallGraph::Create(rm);
+
+  /*
+   * Assert
+   */
+  assert(callGraph->GetSccs().size() == 1);
+  assert(callGraph->IsRecursive(*lambda));
+
+  auto & node = callGraph->GetNode(*lambda);
+  assert(node.GetCallSites().size() == 1);
+  assert(node.GetCallSites()[0]->GetCallee() == &node);
+  assert(node.GetCallSites()[0]->GetCallType() == CallGraph::CallType::DirectCall);
+}
+
+static int
+verify()
+{
+  TestCallSites();
+  TestRecursion();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestCallGraph", verify)
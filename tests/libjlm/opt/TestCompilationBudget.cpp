@@ -0,0 +1,216 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/CompilationBudget.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/optimization.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static const jlm::StatisticsDescriptor statisticsDescriptor;
+
+/**
+ * Records the names of the lambdas in the root region of every module it runs on.
+ */
+class RecordingOptimization final : public jlm::optimization {
+public:
+  void
+  run(jlm::RvsdgModule & module, const jlm::StatisticsDescriptor &) override
+  {
+    std::vector<std::string> names;
+    for (auto & node : module.Rvsdg().root()->nodes) {
+      if (auto lambdaNode = dynamic_cast<const jlm::lambda::node*>(&node))
+        names.push_back(lambdaNode->name());
+    }
+
+    Runs.push_back(names);
+  }
+
+  std::vector<std::vector<std::string>> Runs;
+};
+
+/**
+ * Adds a dead constant to the root region for every node of the module.
+ */
+class GrowingOptimization final : public jlm::optimization {
+public:
+  void
+  run(jlm::RvsdgModule & module, const jlm::StatisticsDescriptor &) override
+  {
+    auto root = module.Rvsdg().root();
+    auto nnodes = jive::nnodes(root);
+    for (size_t n = 0; n < nnodes; n++)
+      jive::create_bitconstant(root, 32, n);
+  }
+};
+
+/**
+ * Creates the exported lambdas f(x) and g(x). Both contain a dead addition, and f is cold if \p isCold is true.
+ */
+static std::unique_ptr<jlm::RvsdgModule>
+SetupModule(bool isCold)
+{
+  using namespace jlm;
+
+  auto module = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = module->Rvsdg();
+
+  FunctionType functionType({&jive::bit32}, {&jive::bit32});
+  for (auto name : {"f", "g"}) {
+    attributeset attributes;
+    if (isCold && std::string(name) == "f")
+      attributes.insert(enum_attribute::create(attribute::kind::cold));
+
+    auto lambda = lambda::node::create(graph.root(), functionType, name, linkage::external_linkage, attributes);
+    auto one = jive::create_bitconstant(lambda->subregion(), 32, 1);
+    jive::bitadd_op::create(32, lambda->fctargument(0), one);
+
+    auto output = lambda->finalize({lambda->fctargument(0)});
+    graph.add_export(output, {output->type(), name});
+  }
+
+  return module;
+}
+
+static std::vector<const jlm::lambda::node*>
+GetLambdas(const jlm::RvsdgModule & module)
+{
+  std::vector<const jlm::lambda::node*> lambdas;
+  for (auto & node : module.Rvsdg().root()->nodes) {
+    if (auto lambdaNode = dynamic_cast<const jlm::lambda::node*>(&node))
+      lambdas.push_back(lambdaNode);
+  }
+
+  return lambdas;
+}
+
+static void
+TestColdFastPath()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto module = SetupModule(true);
+  RecordingOptimization recording;
+  CompilationBudget budget({}, {}, 0);
+
+  /*
+   * Act
+   */
+  budget.Run(*module, statisticsDescriptor, {&recording});
+
+  /*
+   * Assert: The pipeline only ran on g, and f was optimized with dead node elimination and restored.
+   */
+  assert(recording.Runs.size() == 1);
+  assert(recording.Runs[0] == std::vector<std::string>({"g"}));
+
+  auto lambdas = GetLambdas(*module);
+  assert(lambdas.size() == 2);
+  for (auto lambda : lambdas) {
+    auto nnodes = jive::nnodes(lambda->subregion());
+    assert(lambda->name() == "f" ? nnodes == 0 : nnodes == 2);
+  }
+  assert(module->Rvsdg().root()->narguments() == 0);
+  assert(module->Rvsdg().root()->nresults() == 2);
+}
+
+static void
+TestColdThreshold()
+{
+  using namespace jlm;
+
+  auto module = SetupModule(false);
+  RecordingOptimization recording;
+  CompilationBudget budget({}, {}, 3);
+
+  budget.Run(*module, statisticsDescriptor, {&recording});
+
+  /*
+   * Assert: Both lambdas have fewer than three nodes and took the cold fast path.
+   */
+  assert(recording.Runs.size() == 1 && recording.Runs[0].empty());
+  assert(GetLambdas(*module).size() == 2);
+}
+
+static void
+TestGrowthBudget()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto module = SetupModule(false);
+  GrowingOptimization growing;
+  RecordingOptimization recording;
+  DeadNodeElimination deadNodeElimination;
+  CompilationBudget budget({std::nullopt, 50}, {}, 0);
+
+  /*
+   * Act
+   */
+  budget.Run(*module, statisticsDescriptor, {&growing, &recording, &deadNodeElimination});
+
+  /*
+   * Assert: The module doubled in size, such that the recording pass was skipped, but dead node elimination
+   * still removed the grown nodes.
+   */
+  assert(recording.Runs.empty());
+  assert(jive::nnodes(module->Rvsdg().root()) == 2);
+}
+
+static void
+TestLambdaBudget()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto module = SetupModule(false);
+  RecordingOptimization recording;
+  CompilationBudget budget({}, {std::nullopt, 1000}, 0);
+
+  /*
+   * Act
+   */
+  budget.Run(*module, statisticsDescriptor, {&recording});
+
+  /*
+   * Assert: Every lambda was optimized in isolation.
+   */
+  assert(recording.Runs.size() == 3);
+  assert(recording.Runs[0] == std::vector<std::string>({"f"}));
+  assert(recording.Runs[1] == std::vector<std::string>({"g"}));
+  assert(recording.Runs[2].empty());
+
+  auto lambdas = GetLambdas(*module);
+  assert(lambdas.size() == 2);
+  assert(module->Rvsdg().root()->nresults() == 2);
+}
+
+static int
+TestCompilationBudget()
+{
+  TestColdFastPath();
+  TestColdThreshold();
+  TestGrowthBudget();
+  TestLambdaBudget();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestCompilationBudget", TestCompilationBudget)
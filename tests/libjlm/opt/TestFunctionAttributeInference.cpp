@@ -0,0 +1,214 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/type.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/FunctionAttributeInference.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static bool
+HasAttribute(
+  const jlm::attributeset & attributes,
+  const jlm::attribute::kind & kind)
+{
+  for (auto & attribute : attributes) {
+    auto enumAttribute = dynamic_cast<const jlm::enum_attribute*>(&attribute);
+    if (enumAttribute && enumAttribute->kind() == kind)
+      return true;
+  }
+
+  return false;
+}
+
+static const jlm::lambda::node &
+GetExportedLambda(
+  const jlm::RvsdgModule & rvsdgModule,
+  size_t index)
+{
+  auto origin = rvsdgModule.Rvsdg().root()->result(index)->origin();
+  return *jlm::AssertedCast<const jlm::lambda::node>(jive::node_output::node(origin));
+}
+
+static void
+TestFunctionAttributes()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  PointerType pointerType(jive::bit32);
+  FunctionType valueFunctionType(
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType},
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType});
+  FunctionType pointerFunctionType(
+    {&pointerType, &iOStateType, &memoryStateType, &loopStateType},
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType});
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto g = graph.add_import(impport(PointerType(pointerFunctionType), "g", linkage::external_linkage));
+
+  auto SetupAdd = [&]()
+  {
+    auto lambda = lambda::node::create(graph.root(), valueFunctionType, "add", linkage::external_linkage);
+
+    auto sum = jive::bitadd_op::create(32, lambda->fctargument(0), lambda->fctargument(0));
+
+    auto output = lambda->finalize({sum, lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+    graph.add_export(output, {output->type(), "add"});
+
+    return lambda;
+  };
+
+  auto SetupLoad = [&]()
+  {
+    auto lambda = lambda::node::create(graph.root(), pointerFunctionType, "load", linkage::external_linkage);
+
+    auto load = LoadNode::Create(lambda->fctargument(0), {lambda->fctargument(2)}, 4);
+
+    auto output = lambda->finalize({load[0], lambda->fctargument(1), load[1], lambda->fctargument(3)});
+    graph.add_export(output, {output->type(), "load"});
+
+    return lambda;
+  };
+
+  auto SetupCallLoad = [&](lambda::node * load)
+  {
+    auto lambda = lambda::node::create(graph.root(), pointerFunctionType, "callLoad", linkage::external_linkage);
+    auto cvLoad = lambda->add_ctxvar(load->output());
+
+    auto call = CallNode::Create(
+      cvLoad,
+      {lambda->fctargument(0), lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+
+    auto output = lambda->finalize(call);
+    graph.add_export(output, {output->type(), "callLoad"});
+
+    return lambda;
+  };
+
+  auto SetupCallG = [&]()
+  {
+    auto lambda = lambda::node::create(graph.root(), pointerFunctionType, "callG", linkage::external_linkage);
+    auto cvG = lambda->add_ctxvar(g);
+
+    auto call = CallNode::Create(
+      cvG,
+      {lambda->fctargument(0), lambda->fctargument(1), lambda->fctargument(2), lambda->fctargument(3)});
+
+    auto output = lambda->finalize(call);
+    graph.add_export(output, {output->type(), "callG"});
+
+    return lambda;
+  };
+
+  SetupAdd();
+  auto load = SetupLoad();
+  SetupCallLoad(load);
+  SetupCallG();
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionAttributeInference functionAttributeInference;
+  functionAttributeInference.run(rvsdgModule, StatisticsDescriptor());
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto & add = GetExportedLambda(rvsdgModule, 0);
+  assert(HasAttribute(add.attributes(), attribute::kind::read_none));
+  assert(HasAttribute(add.attributes(), attribute::kind::no_recurse));
+
+  auto & newLoad = GetExportedLambda(rvsdgModule, 1);
+  assert(!HasAttribute(newLoad.attributes(), attribute::kind::read_none));
+  assert(HasAttribute(newLoad.attributes(), attribute::kind::read_only));
+  assert(HasAttribute(newLoad.attributes(), attribute::kind::no_recurse));
+  assert(HasAttribute(newLoad.fctargument(0)->attributes(), attribute::kind::no_capture));
+
+  auto & callLoad = GetExportedLambda(rvsdgModule, 2);
+  assert(HasAttribute(callLoad.attributes(), attribute::kind::read_only));
+  assert(HasAttribute(callLoad.attributes(), attribute::kind::no_recurse));
+  assert(HasAttribute(callLoad.fctargument(0)->attributes(), attribute::kind::no_capture));
+
+  auto & callG = GetExportedLambda(rvsdgModule, 3);
+  assert(!HasAttribute(callG.attributes(), attribute::kind::read_none));
+  assert(!HasAttribute(callG.attributes(), attribute::kind::read_only));
+  assert(!HasAttribute(callG.attributes(), attribute::kind::no_recurse));
+  assert(!HasAttribute(callG.fctargument(0)->attributes(), attribute::kind::no_capture));
+}
+
+static void
+TestCapturedArgument()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  auto pointerPointerType = PointerType::Create(pointerType);
+  FunctionType functionType(
+    {&pointerType, pointerPointerType.get(), &memoryStateType},
+    {&memoryStateType});
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+
+  auto store = StoreNode::Create(lambda->fctargument(1), lambda->fctargument(0), {lambda->fctargument(2)}, 4);
+
+  auto output = lambda->finalize(store);
+  graph.add_export(output, {output->type(), "f"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionAttributeInference functionAttributeInference;
+  functionAttributeInference.run(rvsdgModule, StatisticsDescriptor());
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto & f = GetExportedLambda(rvsdgModule, 0);
+  assert(!HasAttribute(f.attributes(), attribute::kind::read_none));
+  assert(!HasAttribute(f.attributes(), attribute::kind::read_only));
+  assert(HasAttribute(f.attributes(), attribute::kind::no_recurse));
+  assert(!HasAttribute(f.fctargument(0)->attributes(), attribute::kind::no_capture));
+  assert(HasAttribute(f.fctargument(1)->attributes(), attribute::kind::no_capture));
+}
+
+static int
+verify()
+{
+  TestFunctionAttributes();
+  TestCapturedArgument();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestFunctionAttributeInference", verify)
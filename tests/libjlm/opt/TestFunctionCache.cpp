@@ -0,0 +1,144 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/FunctionCache.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+#include <dirent.h>
+#include <unistd.h>
+
+static const jlm::StatisticsDescriptor statisticsDescriptor;
+
+/**
+ * Creates the exported lambda f(x) = g(x), where g is an imported function. The lambda contains a dead addition.
+ */
+static std::unique_ptr<jlm::RvsdgModule>
+SetupModule()
+{
+  using namespace jlm;
+
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType},
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType});
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto g = graph.add_import(impport(PointerType(functionType), "g", linkage::external_linkage));
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto cv = lambda->add_ctxvar(g);
+
+  auto one = jive::create_bitconstant(lambda->subregion(), 32, 1);
+  jive::bitadd_op::create(32, lambda->fctargument(0), one);
+
+  auto results = CallNode::Create(cv, {lambda->fctargument(0), lambda->fctargument(1), lambda->fctargument(2),
+    lambda->fctargument(3)});
+  auto f = lambda->finalize(results);
+  graph.add_export(f, {f->type(), "f"});
+
+  return rvsdgModule;
+}
+
+static jlm::lambda::node *
+GetLambda(const jlm::RvsdgModule & rvsdgModule)
+{
+  auto root = rvsdgModule.Rvsdg().root();
+  assert(root->nresults() == 1);
+
+  return dynamic_cast<jlm::lambda::node*>(jive::node_output::node(root->result(0)->origin()));
+}
+
+static bool
+ContainsAddition(const jive::region & region)
+{
+  for (auto & node : region.nodes) {
+    if (jive::is<jive::bitadd_op>(&node))
+      return true;
+  }
+
+  return false;
+}
+
+static size_t
+RemoveDirectory(const std::string & path)
+{
+  size_t nfiles = 0;
+  auto directory = opendir(path.c_str());
+  while (auto entry = readdir(directory)) {
+    std::string name(entry->d_name);
+    if (name == "." || name == "..")
+      continue;
+
+    unlink((path + "/" + name).c_str());
+    nfiles++;
+  }
+  closedir(directory);
+  rmdir(path.c_str());
+
+  return nfiles;
+}
+
+static int
+TestFunctionCache()
+{
+  using namespace jlm;
+
+  char directoryTemplate[] = "/tmp/jlm-function-cache-XXXXXX";
+  std::string directory(mkdtemp(directoryTemplate));
+
+  DeadNodeElimination deadNodeElimination;
+
+  /*
+   * Act & Assert: The first run optimizes f and adds it to the cache.
+   */
+  auto rvsdgModule1 = SetupModule();
+  FunctionCache(directory, "dne").Run(*rvsdgModule1, statisticsDescriptor, {&deadNodeElimination});
+
+  auto f1 = GetLambda(*rvsdgModule1);
+  assert(f1 && !ContainsAddition(*f1->subregion()));
+
+  /*
+   * Act & Assert: The second run restores the optimized f from the cache without running any optimization.
+   */
+  auto rvsdgModule2 = SetupModule();
+  FunctionCache(directory, "dne").Run(*rvsdgModule2, statisticsDescriptor, {});
+
+  auto f2 = GetLambda(*rvsdgModule2);
+  assert(f2 && f2->name() == "f" && !ContainsAddition(*f2->subregion()));
+  assert(rvsdgModule2->Rvsdg().root()->narguments() == 1);
+  assert(f2->ncvarguments() == 1 && f2->input(0)->origin() == rvsdgModule2->Rvsdg().root()->argument(0));
+
+  /*
+   * Act & Assert: A different pipeline does not use the cache entry of f.
+   */
+  auto rvsdgModule3 = SetupModule();
+  FunctionCache(directory, "none").Run(*rvsdgModule3, statisticsDescriptor, {});
+
+  auto f3 = GetLambda(*rvsdgModule3);
+  assert(f3 && ContainsAddition(*f3->subregion()));
+
+  /*
+   * Every run adds a file to the cache for every cache miss.
+   */
+  assert(RemoveDirectory(directory) == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestFunctionCache", TestFunctionCache)
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/FunctionSpecialization.hpp>
+#include <jlm/opt/reduction.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static const jlm::StatisticsDescriptor statisticsDescriptor;
+
+/**
+ * Creates the lambda f(x, c) = c == 0 ? x : x + 1 and the exported lambda g(y), which calls f once for every constant
+ * in \p constants. The lambda f is exported if \p exportF is true.
+ */
+static std::tuple<jlm::lambda::node*, std::vector<jlm::CallNode*>>
+SetupModule(
+  jive::graph & graph,
+  const std::vector<int64_t> & constants,
+  bool exportF)
+{
+  using namespace jlm;
+
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionTypeF(
+    {&jive::bit32, &jive::bit32, &iOStateType, &memoryStateType, &loopStateType},
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType});
+  FunctionType functionTypeG(
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType},
+    {&jive::bit32, &iOStateType, &memoryStateType, &loopStateType});
+
+  auto lambdaF = lambda::node::create(graph.root(), functionTypeF, "f", linkage::internal_linkage);
+  auto match = jive::match(32, {{0, 0}}, 1, 2, lambdaF->fctargument(1));
+  auto gamma = jive::gamma_node::create(match, 2);
+  auto ev = gamma->add_entryvar(lambdaF->fctargument(0));
+  auto one = jive::create_bitconstant(gamma->subregion(1), 32, 1);
+  auto sum = jive::bitadd_op::create(32, ev->argument(1), one);
+  auto x = gamma->add_exitvar({ev->argument(0), sum});
+  auto f = lambdaF->finalize({x, lambdaF->fctargument(2), lambdaF->fctargument(3), lambdaF->fctargument(4)});
+  if (exportF)
+    graph.add_export(f, {f->type(), "f"});
+
+  auto lambdaG = lambda::node::create(graph.root(), functionTypeG, "g", linkage::external_linkage);
+  auto cv = lambdaG->add_ctxvar(f);
+  jive::output * value = lambdaG->fctargument(0);
+  jive::output * iOState = lambdaG->fctargument(1);
+  jive::output * memoryState = lambdaG->fctargument(2);
+  jive::output * loopState = lambdaG->fctargument(3);
+
+  std::vector<CallNode*> callNodes;
+  for (auto & constant : constants) {
+    auto c = jive::create_bitconstant(lambdaG->subregion(), 32, constant);
+    auto results = CallNode::Create(cv, {value, c, iOState, memoryState, loopState});
+    callNodes.push_back(AssertedCast<CallNode>(jive::node_output::node(results[0])));
+
+    value = results[0];
+    iOState = results[1];
+    memoryState = results[2];
+    loopState = results[3];
+  }
+
+  auto g = lambdaG->finalize({value, iOState, memoryState, loopState});
+  graph.add_export(g, {g->type(), "g"});
+
+  return std::make_tuple(lambdaF, callNodes);
+}
+
+static jlm::lambda::node *
+GetCallee(const jlm::CallNode & callNode)
+{
+  return jlm::CallNode::ClassifyCall(callNode)->GetLambdaOutput().node();
+}
+
+static bool
+ContainsGamma(const jive::region & region)
+{
+  for (auto & node : region.nodes) {
+    if (jive::is<jive::gamma_op>(&node))
+      return true;
+  }
+
+  return false;
+}
+
+static void
+TestSpecialization()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto [lambdaF, callNodes] = SetupModule(graph, {0, 1, 0}, false);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionSpecialization functionSpecialization(1000);
+  functionSpecialization.run(*rvsdgModule, statisticsDescriptor);
+
+  nodereduction reduction;
+  reduction.run(*rvsdgModule, statisticsDescriptor);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto clone = GetCallee(*callNodes[0]);
+  assert(clone != lambdaF);
+  assert(clone->name() == "f.specialized.0");
+  assert(GetCallee(*callNodes[2]) == clone);
+  assert(GetCallee(*callNodes[1]) == lambdaF);
+
+  assert(clone->fctargument(1)->nusers() == 0);
+  assert(lambdaF->fctargument(1)->nusers() == 0);
+  assert(!ContainsGamma(*clone->subregion()));
+  assert(!ContainsGamma(*lambdaF->subregion()));
+  assert(clone->fctresult(0)->origin() == clone->fctargument(0));
+}
+
+static void
+TestExportedFunction()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto [lambdaF, callNodes] = SetupModule(graph, {1}, true);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionSpecialization functionSpecialization(1000);
+  functionSpecialization.run(*rvsdgModule, statisticsDescriptor);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto clone = GetCallee(*callNodes[0]);
+  assert(clone != lambdaF);
+  assert(clone->linkage() == linkage::internal_linkage);
+  assert(lambdaF->fctargument(1)->nusers() != 0);
+}
+
+static void
+TestUniqueName()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   *
+   * The module already contains a symbol with the name of the first specialization, e.g., from a previous run.
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto [lambdaF, callNodes] = SetupModule(graph, {1}, true);
+  graph.add_import(impport(PointerType(lambdaF->type()), "f.specialized.0", linkage::external_linkage));
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionSpecialization functionSpecialization(1000);
+  functionSpecialization.run(*rvsdgModule, statisticsDescriptor);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto clone = GetCallee(*callNodes[0]);
+  assert(clone != lambdaF);
+  assert(clone->name() == "f.specialized.1");
+}
+
+static void
+TestBudget()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto [lambdaF, callNodes] = SetupModule(graph, {0, 1}, false);
+  auto numNodes = jive::nnodes(graph.root());
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  FunctionSpecialization functionSpecialization(0);
+  functionSpecialization.run(*rvsdgModule, statisticsDescriptor);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(GetCallee(*callNodes[0]) == lambdaF);
+  assert(GetCallee(*callNodes[1]) == lambdaF);
+  assert(lambdaF->fctargument(1)->nusers() != 0);
+  assert(jive::nnodes(graph.root()) == numNodes);
+}
+
+static int
+verify()
+{
+  TestSpecialization();
+  TestExportedFunction();
+  TestUniqueName();
+  TestBudget();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestFunctionSpecialization", verify)
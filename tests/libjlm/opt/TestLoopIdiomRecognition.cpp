@@ -0,0 +1,285 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/LoopIdiomRecognition.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunLoopIdiomRecognition(jlm::RvsdgModule & rvsdgModule)
+{
+  jlm::StatisticsDescriptor statisticsDescriptor;
+  jlm::LoopIdiomRecognition loopIdiomRecognition;
+  loopIdiomRecognition.run(rvsdgModule, statisticsDescriptor);
+}
+
+/**
+ * Creates a theta node that iterates i from zero to \p end, or to eight if \p end is nullptr. If \p source is not
+ * nullptr, the theta copies the elements of \p source to \p destination, otherwise it sets the elements of
+ * \p destination to \p value. If \p invertPredicate is true, the match of the predicate maps a true comparison to
+ * the exit of the loop instead, i.e., the loop repeats while i is not less than the end.
+ */
+static jive::theta_node *
+CreateTheta(
+  jive::output * destination,
+  jive::output * source,
+  jive::output * value,
+  jive::output * memoryState,
+  jive::output * end = nullptr,
+  bool invertPredicate = false)
+{
+  using namespace jlm;
+
+  auto & region = *destination->region();
+  auto theta = jive::theta_node::create(&region);
+  auto subregion = theta->subregion();
+
+  auto idv = theta->add_loopvar(jive::create_bitconstant(&region, 64, 0));
+  auto step = theta->add_loopvar(jive::create_bitconstant(&region, 64, 1));
+  auto lvEnd = theta->add_loopvar(end ? end : jive::create_bitconstant(&region, 64, 8));
+  auto lvd = theta->add_loopvar(destination);
+  auto lvs = theta->add_loopvar(memoryState);
+
+  jive::output * state = lvs->argument();
+  if (source) {
+    auto lvSource = theta->add_loopvar(source);
+    auto address = getelementptr_op::create(lvSource->argument(), {idv->argument()}, source->type());
+    auto load = LoadNode::Create(address, {state}, 4);
+    value = load[0];
+    state = load[1];
+  } else {
+    value = theta->add_loopvar(value)->argument();
+  }
+
+  auto address = getelementptr_op::create(lvd->argument(), {idv->argument()}, destination->type());
+  state = StoreNode::Create(address, value, {state}, 4)[0];
+
+  auto sum = jive::bitadd_op::create(64, idv->argument(), step->argument());
+  auto cmp = jive::bitult_op::create(64, sum, lvEnd->argument());
+  auto predicate = invertPredicate ? jive::match(1, {{1, 0}}, 1, 2, cmp) : jive::match(1, {{1, 1}}, 0, 2, cmp);
+
+  idv->result()->divert_to(sum);
+  lvs->result()->divert_to(state);
+  theta->set_predicate(predicate);
+
+  return theta;
+}
+
+static void
+TestMemset()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto theta = CreateTheta(p, nullptr, zero, s);
+  graph.add_export(theta->output(4), {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopIdiomRecognition(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto memsetNode = jive::node_output::node(graph.root()->result(0)->origin());
+  assert(is<Memset>(memsetNode));
+  assert(memsetNode->input(4)->origin() == s);
+  assert(is<jive::bitmul_op>(jive::node_output::node(memsetNode->input(2)->origin())));
+}
+
+static void
+TestMemcpy()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto size = jive::create_bitconstant(graph.root(), 32, 8);
+  auto alloca1 = alloca_op::create(jive::bit32, size, 4);
+  auto alloca2 = alloca_op::create(jive::bit32, size, 4);
+  auto state = MemStateMergeOperator::Create({s, alloca1[1], alloca2[1]});
+
+  auto theta = CreateTheta(alloca1[0], alloca2[0], nullptr, state);
+  graph.add_export(theta->output(4), {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopIdiomRecognition(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto memcpyNode = jive::node_output::node(graph.root()->result(0)->origin());
+  assert(is<Memcpy>(memcpyNode));
+  assert(memcpyNode->input(4)->origin() == state);
+}
+
+static void
+TestMayOverlap()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto q = graph.add_import({pointerType, "q"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto theta = CreateTheta(p, q, nullptr, s);
+  graph.add_export(theta->output(4), {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopIdiomRecognition(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(is<jive::theta_op>(jive::node_output::node(graph.root()->result(0)->origin())));
+}
+
+static void
+TestUnknownIterations()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  jive::bittype bit64(64);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto s = graph.add_import({memoryStateType, "s"});
+  auto n = graph.add_import({bit64, "n"});
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto theta = CreateTheta(p, nullptr, zero, s, n);
+  graph.add_export(theta->output(4), {memoryStateType, "s"});
+
+  /*
+   * Act
+   */
+  RunLoopIdiomRecognition(*rvsdgModule);
+
+  /*
+   * Assert
+   */
+  assert(is<Memset>(jive::node_output::node(graph.root()->result(0)->origin())));
+}
+
+static void
+TestInvertedPredicate()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  jive::bittype bit64(64);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto s = graph.add_import({memoryStateType, "s"});
+  auto n = graph.add_import({bit64, "n"});
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto theta1 = CreateTheta(p, nullptr, zero, s, nullptr, true);
+  auto theta2 = CreateTheta(p, nullptr, zero, theta1->output(4), n, true);
+  graph.add_export(theta2->output(4), {memoryStateType, "s"});
+
+  /*
+   * Act
+   */
+  RunLoopIdiomRecognition(*rvsdgModule);
+
+  /*
+   * Assert: Neither the loop with a known nor the loop with an unknown number of iterations is replaced, as the number
+   * of iterations is not the distance between the start and the end.
+   */
+  auto node = jive::node_output::node(graph.root()->result(0)->origin());
+  assert(is<jive::theta_op>(node));
+  assert(is<jive::theta_op>(jive::node_output::node(node->input(4)->origin())));
+}
+
+static int
+verify()
+{
+  TestMemset();
+  TestMemcpy();
+  TestMayOverlap();
+  TestUnknownIterations();
+  TestInvertedPredicate();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestLoopIdiomRecognition", verify)
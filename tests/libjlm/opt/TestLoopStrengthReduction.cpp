@@ -0,0 +1,244 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/LoopStrengthReduction.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunLoopStrengthReduction(
+  jlm::RvsdgModule & rvsdgModule,
+  bool comparePointers = true)
+{
+  jlm::StatisticsDescriptor statisticsDescriptor;
+  jlm::LoopStrengthReduction loopStrengthReduction(comparePointers);
+  loopStrengthReduction.run(rvsdgModule, statisticsDescriptor);
+}
+
+static bool
+ContainsMultiplication(const jive::region & region)
+{
+  for (auto & node : region.nodes) {
+    if (jive::is<jive::bitmul_op>(&node))
+      return true;
+  }
+
+  return false;
+}
+
+static jive::node *
+GetPredicateComparison(const jive::theta_node & theta)
+{
+  auto matchNode = jive::node_output::node(theta.predicate()->origin());
+  return jive::node_output::node(matchNode->input(0)->origin());
+}
+
+/**
+ * Creates a theta node that iterates i from zero to eight and stores \p value to the address
+ * getelementptr(\p address, i * \p factor) in every iteration. The multiplication is omitted if \p factor is nullptr.
+ */
+static jive::theta_node *
+CreateTheta(
+  jive::output * address,
+  jive::output * factor,
+  jive::output * value,
+  jive::output * memoryState)
+{
+  using namespace jlm;
+
+  auto & region = *address->region();
+  auto theta = jive::theta_node::create(&region);
+
+  auto idv = theta->add_loopvar(jive::create_bitconstant(&region, 64, 0));
+  auto step = theta->add_loopvar(jive::create_bitconstant(&region, 64, 1));
+  auto end = theta->add_loopvar(jive::create_bitconstant(&region, 64, 8));
+  auto lva = theta->add_loopvar(address);
+  auto lvv = theta->add_loopvar(value);
+  auto lvs = theta->add_loopvar(memoryState);
+
+  jive::output * index = idv->argument();
+  if (factor != nullptr)
+    index = jive::bitmul_op::create(64, index, theta->add_loopvar(factor)->argument());
+
+  auto gep = getelementptr_op::create(lva->argument(), {index}, address->type());
+  auto state = StoreNode::Create(gep, lvv->argument(), {lvs->argument()}, 4)[0];
+
+  auto sum = jive::bitadd_op::create(64, idv->argument(), step->argument());
+  auto cmp = jive::bitult_op::create(64, sum, end->argument());
+  auto predicate = jive::match(1, {{1, 1}}, 0, 2, cmp);
+
+  idv->result()->divert_to(sum);
+  lvs->result()->divert_to(state);
+  theta->set_predicate(predicate);
+
+  return theta;
+}
+
+static void
+TestAddress()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto theta = CreateTheta(p, nullptr, v, s);
+  graph.add_export(theta->output(5), {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopStrengthReduction(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto storeNode = jive::node_output::node(theta->output(5)->result()->origin());
+  assert(is<StoreOperation>(storeNode));
+  assert(dynamic_cast<const jive::argument*>(storeNode->input(0)->origin()));
+  assert(is<ptrcmp_op>(GetPredicateComparison(*theta)));
+  assert(theta->output(0)->argument()->nusers() == 1);
+}
+
+static void
+TestMultiplication()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit64);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  /*
+   * for (i = 0; i < 8; i++)
+   *   *p = i * 3;
+   */
+  auto theta = jive::theta_node::create(graph.root());
+  auto idv = theta->add_loopvar(jive::create_bitconstant(graph.root(), 64, 0));
+  auto lvp = theta->add_loopvar(p);
+  auto lvs = theta->add_loopvar(s);
+
+  auto three = jive::create_bitconstant(theta->subregion(), 64, 3);
+  auto product = jive::bitmul_op::create(64, idv->argument(), three);
+  auto state = StoreNode::Create(lvp->argument(), product, {lvs->argument()}, 8)[0];
+
+  auto one = jive::create_bitconstant(theta->subregion(), 64, 1);
+  auto eight = jive::create_bitconstant(theta->subregion(), 64, 8);
+  auto sum = jive::bitadd_op::create(64, idv->argument(), one);
+  auto cmp = jive::bitult_op::create(64, sum, eight);
+
+  idv->result()->divert_to(sum);
+  lvs->result()->divert_to(state);
+  theta->set_predicate(jive::match(1, {{1, 1}}, 0, 2, cmp));
+
+  graph.add_export(lvs, {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopStrengthReduction(*rvsdgModule, false);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(!ContainsMultiplication(*theta->subregion()));
+  assert(idv->argument()->nusers() == 1);
+
+  auto cmpNode = GetPredicateComparison(*theta);
+  assert(is<jive::bitne_op>(cmpNode));
+  auto end = jive::node_output::node(cmpNode->input(1)->origin());
+  assert(is<jive::bitconstant_op>(end));
+  assert(static_cast<const jive::bitconstant_op*>(&end->operation())->value() == 24);
+}
+
+static void
+TestUnknownFactor()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto p = graph.add_import({pointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto s = graph.add_import({memoryStateType, "s"});
+  auto factor = graph.add_import({jive::bit64, "factor"});
+
+  auto theta = CreateTheta(p, factor, v, s);
+  graph.add_export(theta->output(5), {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunLoopStrengthReduction(*rvsdgModule, false);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(!ContainsMultiplication(*theta->subregion()));
+  assert(is<jive::bitult_op>(GetPredicateComparison(*theta)));
+}
+
+static int
+verify()
+{
+  TestAddress();
+  TestMultiplication();
+  TestUnknownFactor();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestLoopStrengthReduction", verify)
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/SlpVectorizer.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunSlpVectorizer(jlm::RvsdgModule & rvsdgModule)
+{
+  jlm::StatisticsDescriptor statisticsDescriptor;
+  jlm::SlpVectorizer slpVectorizer;
+  slpVectorizer.run(rvsdgModule, statisticsDescriptor);
+}
+
+/**
+ * Returns the address of element \p i + \p offset of the array \p address points to.
+ */
+static jive::output *
+CreateElementAddress(
+  jive::output * address,
+  jive::output * i,
+  size_t offset)
+{
+  using namespace jlm;
+
+  auto index = offset == 0 ? i : jive::bitadd_op::create(64, i, jive::create_bitconstant(i->region(), 64, offset));
+  return getelementptr_op::create(address, {index}, address->type());
+}
+
+static void
+TestLoadAddStore()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({pointerType, "p"});
+  auto i = graph.add_import({jive::bit64, "i"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  /*
+   * p[i+n] = p[i+n] + 1 for n in [0, 4)
+   */
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+  jive::output * state = s;
+  for (size_t n = 0; n < 4; n++) {
+    auto address = CreateElementAddress(p, i, n);
+    auto load = LoadNode::Create(address, {state}, 4);
+    auto sum = jive::bitadd_op::create(32, load[0], one);
+    state = StoreNode::Create(address, sum, {load[1]}, 4)[0];
+  }
+
+  graph.add_export(state, {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSlpVectorizer(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto storeNode = dynamic_cast<const StoreNode*>(jive::node_output::node(graph.root()->result(0)->origin()));
+  assert(storeNode);
+  assert(is<fixedvectortype>(storeNode->GetValueInput()->type()));
+  assert(is<vectorbinary_op>(jive::node_output::node(storeNode->GetValueInput()->origin())));
+
+  auto loadNode = dynamic_cast<const LoadNode*>(jive::node_output::node(storeNode->input(2)->origin()));
+  assert(loadNode);
+  assert(is<fixedvectortype>(loadNode->GetValueOutput()->type()));
+  assert(loadNode->input(1)->origin() == s);
+}
+
+static void
+TestUnprofitable()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({pointerType, "p"});
+  auto i = graph.add_import({jive::bit64, "i"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  /*
+   * The stored values would need to be gathered into a vector.
+   */
+  jive::output * state = s;
+  for (size_t n = 0; n < 4; n++) {
+    auto value = graph.add_import({jive::bit32, "v"});
+    state = StoreNode::Create(CreateElementAddress(p, i, n), value, {state}, 4)[0];
+  }
+
+  graph.add_export(state, {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSlpVectorizer(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto storeNode = dynamic_cast<const StoreNode*>(jive::node_output::node(graph.root()->result(0)->origin()));
+  assert(storeNode);
+  assert(storeNode->GetValueInput()->type() == jive::bit32);
+}
+
+static void
+TestMayAlias()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({pointerType, "p"});
+  auto q = graph.add_import({pointerType, "q"});
+  auto i = graph.add_import({jive::bit64, "i"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  /*
+   * p[i+n] = q[i+n] + 1 for n in [0, 4), where a store to p might change the value loaded from q in the next lane.
+   */
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+  jive::output * state = s;
+  for (size_t n = 0; n < 4; n++) {
+    auto load = LoadNode::Create(CreateElementAddress(q, i, n), {state}, 4);
+    auto sum = jive::bitadd_op::create(32, load[0], one);
+    state = StoreNode::Create(CreateElementAddress(p, i, n), sum, {load[1]}, 4)[0];
+  }
+
+  graph.add_export(state, {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSlpVectorizer(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto storeNode = dynamic_cast<const StoreNode*>(jive::node_output::node(graph.root()->result(0)->origin()));
+  assert(storeNode);
+  assert(storeNode->GetValueInput()->type() == jive::bit32);
+}
+
+static int
+verify()
+{
+  TestLoadAddStore();
+  TestUnprofitable();
+  TestMayAlias();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestSlpVectorizer", verify)
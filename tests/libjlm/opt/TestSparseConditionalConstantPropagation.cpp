@@ -0,0 +1,201 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/SparseConditionalConstantPropagation.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunSparseConditionalConstantPropagation(jlm::RvsdgModule & rvsdgModule)
+{
+  jlm::StatisticsDescriptor statisticsDescriptor;
+  jlm::SparseConditionalConstantPropagation sparseConditionalConstantPropagation;
+  sparseConditionalConstantPropagation.run(rvsdgModule, statisticsDescriptor);
+}
+
+static bool
+IsBitConstant(
+  const jive::output & output,
+  int64_t value)
+{
+  auto node = jive::node_output::node(&output);
+  auto constant = node ? dynamic_cast<const jive::bitconstant_op*>(&node->operation()) : nullptr;
+  return constant && constant->value() == value;
+}
+
+static bool
+ContainsGamma(const jive::region & region)
+{
+  for (auto & node : region.nodes) {
+    if (jive::is<jive::gamma_op>(&node))
+      return true;
+  }
+
+  return false;
+}
+
+static void
+TestThetaGamma()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto n = graph.add_import({jive::bit32, "n"});
+
+  /*
+   * x = 0
+   * do {
+   *   if (x != 0)
+   *     x = x + 1;
+   * } while (x < n);
+   */
+  auto thetaNode = jive::theta_node::create(graph.root());
+  auto x = thetaNode->add_loopvar(jive::create_bitconstant(graph.root(), 32, 0));
+  auto lvn = thetaNode->add_loopvar(n);
+
+  auto match = jive::match(32, {{0, 0}}, 1, 2, x->argument());
+  auto gammaNode = jive::gamma_node::create(match, 2);
+  auto ev = gammaNode->add_entryvar(x->argument());
+  auto one = jive::create_bitconstant(gammaNode->subregion(1), 32, 1);
+  auto sum = jive::bitadd_op::create(32, ev->argument(1), one);
+  auto xNew = gammaNode->add_exitvar({ev->argument(0), sum});
+
+  auto cmp = jive::bitult_op::create(32, xNew, lvn->argument());
+  x->result()->divert_to(xNew);
+  thetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, cmp));
+
+  auto ex = graph.add_export(x, {x->type(), "x"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSparseConditionalConstantPropagation(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(IsBitConstant(*ex->origin(), 0));
+  assert(!ContainsGamma(*thetaNode->subregion()));
+}
+
+static void
+TestLambdaContextVariable()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  FunctionType functionType({&jive::bit32}, {&jive::bit32});
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto constant = jive::create_bitconstant(graph.root(), 32, 1);
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto cv = lambda->add_ctxvar(constant);
+
+  auto match = jive::match(32, {{1, 1}}, 0, 2, cv);
+  auto gammaNode = jive::gamma_node::create(match, 2);
+  auto ev = gammaNode->add_entryvar(lambda->fctargument(0));
+  auto zero = jive::create_bitconstant(gammaNode->subregion(0), 32, 0);
+  auto result = gammaNode->add_exitvar({zero, ev->argument(1)});
+
+  auto output = lambda->finalize({result});
+  graph.add_export(output, {output->type(), "f"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSparseConditionalConstantPropagation(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(!ContainsGamma(*lambda->subregion()));
+  assert(lambda->fctresult(0)->origin() == lambda->fctargument(0));
+}
+
+static void
+TestGammaMerge()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::ctltype controlType(2);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto c = graph.add_import({controlType, "c"});
+  auto y = graph.add_import({jive::bit32, "y"});
+
+  /*
+   * Both alternatives compute the same constant, but the other output differs.
+   */
+  auto gammaNode = jive::gamma_node::create(c, 2);
+  auto ev = gammaNode->add_entryvar(y);
+  auto two = jive::create_bitconstant(gammaNode->subregion(0), 32, 2);
+  auto one = jive::create_bitconstant(gammaNode->subregion(1), 32, 1);
+  auto sum = jive::bitadd_op::create(32, one, one);
+  auto output1 = gammaNode->add_exitvar({two, sum});
+  auto output2 = gammaNode->add_exitvar({two, ev->argument(1)});
+
+  auto ex1 = graph.add_export(output1, {output1->type(), "x"});
+  auto ex2 = graph.add_export(output2, {output2->type(), "y"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunSparseConditionalConstantPropagation(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(IsBitConstant(*ex1->origin(), 2));
+  assert(ex2->origin() == output2);
+}
+
+static int
+verify()
+{
+  TestThetaGamma();
+  TestLambdaContextVariable();
+  TestGammaMerge();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestSparseConditionalConstantPropagation", verify)
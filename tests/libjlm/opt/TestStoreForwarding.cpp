@@ -0,0 +1,341 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jive/view.hpp>
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/StoreForwarding.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunStoreForwarding(jlm::RvsdgModule & rvsdgModule)
+{
+  jlm::StatisticsDescriptor statisticsDescriptor;
+  jlm::StoreForwarding storeForwarding;
+  storeForwarding.run(rvsdgModule, statisticsDescriptor);
+}
+
+static void
+TestGamma()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  jive::ctltype controlType(2);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto c = graph.add_import({controlType, "c"});
+  auto p = graph.add_import({pointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto store = StoreNode::Create(p, v, {s}, 4);
+
+  auto gammaNode = jive::gamma_node::create(c, 2);
+  auto evP = gammaNode->add_entryvar(p);
+  auto evS = gammaNode->add_entryvar(store[0]);
+  auto evV = gammaNode->add_entryvar(v);
+
+  auto loadInGamma = LoadNode::Create(evP->argument(0), {evS->argument(0)}, 4);
+
+  auto xvValue = gammaNode->add_exitvar({loadInGamma[0], evV->argument(1)});
+  auto xvState = gammaNode->add_exitvar({loadInGamma[1], evS->argument(1)});
+
+  auto load = LoadNode::Create(p, {xvState}, 4);
+
+  graph.add_export(xvValue, {xvValue->type(), "x"});
+  graph.add_export(load[0], {load[0]->type(), "y"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunStoreForwarding(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(graph.root()->result(1)->origin() == v);
+
+  auto argument = is_gamma_argument(gammaNode->subregion(0)->result(0)->origin());
+  assert(argument && argument->input()->origin() == v);
+}
+
+static void
+TestTheta()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  jive::ctltype controlType(2);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto c = graph.add_import({controlType, "c"});
+  auto p = graph.add_import({pointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto w = graph.add_import({jive::bit32, "w"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto store = StoreNode::Create(p, v, {s}, 4);
+
+  /*
+   * The first loop only loads from p, while the second loop overwrites p.
+   */
+  auto thetaNode1 = jive::theta_node::create(graph.root());
+  auto lvC1 = thetaNode1->add_loopvar(c);
+  auto lvP1 = thetaNode1->add_loopvar(p);
+  auto lvS1 = thetaNode1->add_loopvar(store[0]);
+  auto lvX1 = thetaNode1->add_loopvar(w);
+
+  auto loadInTheta = LoadNode::Create(lvP1->argument(), {lvS1->argument()}, 4);
+  lvX1->result()->divert_to(loadInTheta[0]);
+  lvS1->result()->divert_to(loadInTheta[1]);
+  thetaNode1->set_predicate(lvC1->argument());
+
+  auto thetaNode2 = jive::theta_node::create(graph.root());
+  auto lvC2 = thetaNode2->add_loopvar(c);
+  auto lvP2 = thetaNode2->add_loopvar(p);
+  auto lvS2 = thetaNode2->add_loopvar(lvS1);
+  auto lvW2 = thetaNode2->add_loopvar(w);
+
+  auto storeInTheta = StoreNode::Create(lvP2->argument(), lvW2->argument(), {lvS2->argument()}, 4);
+  lvS2->result()->divert_to(storeInTheta[0]);
+  thetaNode2->set_predicate(lvC2->argument());
+
+  auto load = LoadNode::Create(p, {lvS2}, 4);
+
+  graph.add_export(lvX1, {lvX1->type(), "x"});
+  graph.add_export(load[0], {load[0]->type(), "y"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunStoreForwarding(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto argument = is_theta_argument(lvX1->result()->origin());
+  assert(argument && argument->input()->origin() == v);
+
+  assert(is<LoadOperation>(jive::node_output::node(graph.root()->result(1)->origin())));
+}
+
+static void
+TestDeadStores()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({pointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto w = graph.add_import({jive::bit32, "w"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto store1 = StoreNode::Create(p, v, {s}, 4);
+  auto store2 = StoreNode::Create(p, w, {store1[0]}, 4);
+
+  auto size = jive::create_bitconstant(graph.root(), 32, 1);
+  auto alloca = alloca_op::create(jive::bit32, size, 4);
+  auto store3 = StoreNode::Create(alloca[0], v, {alloca[1]}, 4);
+
+  graph.add_export(store2[0], {memoryStateType, "s1"});
+  graph.add_export(store3[0], {memoryStateType, "s2"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunStoreForwarding(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  auto storeNode = jive::node_output::node(graph.root()->result(0)->origin());
+  assert(is<StoreOperation>(storeNode));
+  assert(storeNode->input(1)->origin() == w);
+  assert(storeNode->input(2)->origin() == s);
+
+  assert(graph.root()->result(1)->origin() == alloca[1]);
+}
+
+static void
+TestOutOfBoundsIndices()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  arraytype arrayType(jive::bit32, 5);
+  PointerType arrayPointerType(arrayType);
+  PointerType pointerType(jive::bit32);
+  PointerType halfPointerType(jive::bit16);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({arrayPointerType, "p"});
+  auto v = graph.add_import({jive::bit32, "v"});
+  auto w = graph.add_import({jive::bit32, "w"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+  auto four = jive::create_bitconstant(graph.root(), 32, 4);
+  auto five = jive::create_bitconstant(graph.root(), 32, 5);
+
+  /*
+   * The first two addresses are both at byte offset 20 of p.
+   */
+  auto gep1 = getelementptr_op::create(p, {zero, five}, pointerType);
+  auto gep2 = getelementptr_op::create(p, {one, zero}, pointerType);
+  auto gep3 = getelementptr_op::create(p, {one, zero}, halfPointerType);
+  auto gep4 = getelementptr_op::create(p, {zero, four}, pointerType);
+
+  auto store1 = StoreNode::Create(gep1, v, {s}, 4);
+  auto store2 = StoreNode::Create(gep4, w, {store1[0]}, 4);
+  auto load1 = LoadNode::Create(gep2, {store2[0]}, 4);
+  auto load2 = LoadNode::Create(gep3, {load1[1]}, 2);
+  auto store3 = StoreNode::Create(gep1, w, {load2[1]}, 4);
+  auto load3 = LoadNode::Create(gep4, {store3[0]}, 4);
+
+  graph.add_export(load1[0], {jive::bit32, "x"});
+  graph.add_export(load2[0], {jive::bit16, "y"});
+  graph.add_export(load3[0], {jive::bit32, "z"});
+  graph.add_export(load3[1], {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunStoreForwarding(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   */
+  assert(graph.root()->result(0)->origin() == v);
+  assert(graph.root()->result(2)->origin() == w);
+
+  /*
+   * The first store is read by the second load before it is overwritten.
+   */
+  auto loadNode = jive::node_output::node(graph.root()->result(1)->origin());
+  assert(is<LoadOperation>(loadNode));
+
+  auto storeNode = jive::node_output::node(graph.root()->result(3)->origin());
+  assert(is<StoreOperation>(storeNode) && storeNode->input(0)->origin() == gep1);
+  assert(storeNode->input(2)->origin() == loadNode->output(1));
+
+  storeNode = jive::node_output::node(loadNode->input(1)->origin());
+  assert(is<StoreOperation>(storeNode) && storeNode->input(0)->origin() == gep4);
+  storeNode = jive::node_output::node(storeNode->input(2)->origin());
+  assert(is<StoreOperation>(storeNode) && storeNode->input(0)->origin() == gep1);
+}
+
+static void
+TestPointerSize(const std::string & dataLayout, bool forwarded)
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  MemoryStateType memoryStateType;
+  PointerType pointerType(jive::bit32);
+  arraytype arrayType(pointerType, 2);
+  PointerType arrayPointerType(arrayType);
+  auto pointerPointerType = PointerType::Create(pointerType);
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", dataLayout);
+  auto & graph = rvsdgModule->Rvsdg();
+  auto p = graph.add_import({arrayPointerType, "p"});
+  auto q = graph.add_import({pointerType, "q"});
+  auto r = graph.add_import({pointerType, "r"});
+  auto s = graph.add_import({memoryStateType, "s"});
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+
+  auto gep0 = getelementptr_op::create(p, {zero, zero}, *pointerPointerType);
+  auto gep1 = getelementptr_op::create(p, {zero, one}, *pointerPointerType);
+
+  auto store1 = StoreNode::Create(gep0, q, {s}, 4);
+  auto store2 = StoreNode::Create(gep1, r, {store1[0]}, 4);
+  auto load = LoadNode::Create(gep0, {store2[0]}, 4);
+
+  graph.add_export(load[0], {pointerType, "x"});
+  graph.add_export(load[1], {memoryStateType, "s"});
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Act
+   */
+  RunStoreForwarding(*rvsdgModule);
+
+//	jive::view(graph.root(), stdout);
+
+  /*
+   * Assert
+   *
+   * The second store only provably misses the loaded pointer if the size of pointers is known.
+   */
+  assert((graph.root()->result(0)->origin() == q) == forwarded);
+}
+
+static int
+verify()
+{
+  TestGamma();
+  TestTheta();
+  TestDeadStores();
+  TestOutOfBoundsIndices();
+  TestPointerSize("e-p:32:32", true);
+  TestPointerSize("", false);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestStoreForwarding", verify)
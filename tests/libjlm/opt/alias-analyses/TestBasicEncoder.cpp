@@ -82,6 +82,15 @@ TestStore1()
     assert(is<StoreOperation>(*storeB, 3, 1));
     assert(storeB->input(0)->origin() == test.alloca_a->output(0));
     assert(storeB->input(1)->origin() == test.alloca_b->output(0));
+
+    /*
+     * Every store accesses a single, distinct alloca.
+     */
+    auto & aliasClassesD = AssertedCast<StoreNode>(storeD)->GetAliasClasses();
+    auto & aliasClassesC = AssertedCast<StoreNode>(storeC)->GetAliasClasses();
+    auto & aliasClassesB = AssertedCast<StoreNode>(storeB)->GetAliasClasses();
+    assert(aliasClassesD.size() == 1 && aliasClassesC.size() == 1 && aliasClassesB.size() == 1);
+    assert(aliasClassesD != aliasClassesC && aliasClassesC != aliasClassesB && aliasClassesD != aliasClassesB);
 	};
 
 	StoreTest1 test;
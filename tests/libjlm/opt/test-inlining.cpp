@@ -201,11 +201,86 @@ test2()
 	assert(is<CallOperation>(jive::node_output::node(f2->node()->fctresult(0)->origin())));
 }
 
+static void
+test3()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&vt, &iOStateType, &memoryStateType, &loopStateType},
+    {&vt, &iOStateType, &memoryStateType, &loopStateType});
+
+  auto SetupModule = [&](RvsdgModule & rm)
+  {
+    auto & graph = rm.Rvsdg();
+
+    auto f1 = lambda::node::create(
+      graph.root(),
+      functionType,
+      "f1",
+      linkage::external_linkage);
+    auto t = test_op::create(f1->subregion(), {f1->fctargument(0)}, {&vt});
+    f1->finalize({t->output(0), f1->fctargument(1), f1->fctargument(2), f1->fctargument(3)});
+    graph.add_export(f1->output(), {f1->output()->type(), "f1"});
+
+    auto f2 = lambda::node::create(
+      graph.root(),
+      functionType,
+      "f2",
+      linkage::external_linkage);
+    auto cvf1 = f2->add_ctxvar(f1->output());
+    auto call1 = CallNode::Create(
+      cvf1,
+      {f2->fctargument(0), f2->fctargument(1), f2->fctargument(2), f2->fctargument(3)});
+    auto call2 = CallNode::Create(cvf1, call1);
+    f2->finalize(call2);
+    graph.add_export(f2->output(), {f2->output()->type(), "f2"});
+
+    return f2;
+  };
+
+  RvsdgModule rm1(filepath(""), "", "");
+  auto f2 = SetupModule(rm1);
+
+  RvsdgModule rm2(filepath(""), "", "");
+  auto f2NoBudget = SetupModule(rm2);
+
+//	jive::view(rm1.Rvsdg().root(), stdout);
+
+  /*
+   * Act
+   */
+  jlm::fctinline fctinline;
+  fctinline.run(rm1, sd);
+
+  jlm::fctinline fctinlineNoGrowth(40, 0);
+  fctinlineNoGrowth.run(rm2, sd);
+
+//	jive::view(rm1.Rvsdg().root(), stdout);
+
+  /*
+   * Assert
+   *
+   * The exported function f1 is small enough to be inlined at both of its call sites, but not
+   * without a growth budget.
+   */
+  assert(!jive::contains<jlm::CallOperation>(f2->subregion(), true));
+  assert(jive::contains<jlm::CallOperation>(f2NoBudget->subregion(), true));
+}
+
 static int
 verify()
 {
 	test1();
 	test2();
+	test3();
 
 	return 0;
 }
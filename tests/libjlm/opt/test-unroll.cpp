@@ -412,6 +412,102 @@ test_nested_theta()
 }
 
 
+static inline void
+test_adaptive()
+{
+	jive::bitult_op ult(32);
+	jive::bitadd_op add(32);
+
+	{
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto & graph = rm.Rvsdg();
+		auto nf = graph.node_normal_form(typeid(jive::operation));
+		nf->set_mutable(false);
+
+		auto init = jive::create_bitconstant(graph.root(), 32, 0);
+		auto step = jive::create_bitconstant(graph.root(), 32, 1);
+		auto end = jive::create_bitconstant(graph.root(), 32, 6);
+
+		create_theta(ult, add, init, step, end);
+//		jive::view(graph, stdout);
+		jlm::loopunroll loopunroll(4, 100);
+		loopunroll.run(rm, sd);
+//		jive::view(graph, stdout);
+		/*
+			The number of iterations is small enough to unroll the loop completely.
+		*/
+		assert(nthetas(graph.root()) == 0);
+	}
+
+	{
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto & graph = rm.Rvsdg();
+		auto nf = graph.node_normal_form(typeid(jive::operation));
+		nf->set_mutable(false);
+
+		auto init = jive::create_bitconstant(graph.root(), 32, 0);
+		auto step = jive::create_bitconstant(graph.root(), 32, 1);
+		auto end = jive::create_bitconstant(graph.root(), 32, 6);
+
+		auto theta = create_theta(ult, add, init, step, end);
+		auto nnodes = theta->subregion()->nnodes();
+//		jive::view(graph, stdout);
+		jlm::loopunroll loopunroll(4, 4*nnodes);
+		loopunroll.run(rm, sd);
+//		jive::view(graph, stdout);
+		/*
+			The budget permits a factor of four, but the loop should be unrolled by three as it
+			divides the number of iterations. No residual iterations are left.
+		*/
+		auto thetas = find_thetas(graph.root());
+		assert(thetas.size() == 1);
+		assert(thetas[0]->subregion()->nnodes() >= 3*nnodes);
+	}
+
+	{
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto & graph = rm.Rvsdg();
+		auto nf = graph.node_normal_form(typeid(jive::operation));
+		nf->set_mutable(false);
+
+		auto init = jive::create_bitconstant(graph.root(), 32, 0);
+		auto step = jive::create_bitconstant(graph.root(), 32, 1);
+		auto end = jive::create_bitconstant(graph.root(), 32, 2);
+
+		auto otheta = jive::theta_node::create(graph.root());
+		auto lvo_init = otheta->add_loopvar(init);
+		auto lvo_step = otheta->add_loopvar(step);
+		auto lvo_end = otheta->add_loopvar(end);
+
+		auto inner_theta = jive::theta_node::create(otheta->subregion());
+		auto inner_init = jive::create_bitconstant(otheta->subregion(), 32, 0);
+		auto lvi_init = inner_theta->add_loopvar(inner_init);
+		auto lvi_step = inner_theta->add_loopvar(lvo_step->argument());
+		auto lvi_end = inner_theta->add_loopvar(lvo_end->argument());
+
+		auto inner_add = jive::bitadd_op::create(32, lvi_init->argument(), lvi_step->argument());
+		auto inner_compare = jive::bitult_op::create(32, inner_add, lvi_end->argument());
+		auto inner_match = jive::match(1, {{1, 1}}, 0, 2, inner_compare);
+		inner_theta->set_predicate(inner_match);
+		lvi_init->result()->divert_to(inner_add);
+
+		auto add = jive::bitadd_op::create(32, lvo_init->argument(), lvo_step->argument());
+		auto compare = jive::bitult_op::create(32, add, lvo_end->argument());
+		auto match = jive::match(1, {{1, 1}}, 0, 2, compare);
+		otheta->set_predicate(match);
+		lvo_init->result()->divert_to(add);
+
+//		jive::view(graph, stdout);
+		jlm::loopunroll loopunroll(4, 100);
+		loopunroll.run(rm, sd);
+//		jive::view(graph, stdout);
+		/*
+			The inner loop is unrolled completely, which permits to unroll the outer loop completely.
+		*/
+		assert(find_thetas(graph.root()).empty());
+	}
+}
+
 static int
 verify()
 {
@@ -420,6 +516,7 @@ verify()
 	test_nested_theta();
 	test_known_boundaries();
 	test_unknown_boundaries();
+	test_adaptive();
 
 	return 0;
 }
@@ -256,6 +256,34 @@ test_load_load_reduction()
 	assert(mx2->input(1)->origin() == ld2[1] || mx2->input(1)->origin() == ld->output(3));
 }
 
+static void
+test_copy()
+{
+	using namespace jlm;
+
+	MemoryStateType mt;
+	PointerType pt(jive::bit32);
+
+	jive::graph graph;
+	auto address1 = graph.add_import({pt, "address1"});
+	auto address2 = graph.add_import({pt, "address2"});
+	auto state = graph.add_import({mt, "state"});
+
+	auto ld = LoadNode::Create(address1, {state}, 4);
+	auto node = jive::node_output::node(ld[0]);
+
+//	jive::view(graph.root(), stdout);
+
+	auto copy = node->copy(graph.root(), {address2, state});
+
+//	jive::view(graph.root(), stdout);
+
+	auto loadNode = dynamic_cast<const LoadNode*>(copy);
+	assert(loadNode);
+	assert(loadNode->GetAddressInput()->origin() == address2);
+	assert(loadNode->NumStates() == 1);
+}
+
 static int
 test()
 {
@@ -265,6 +293,7 @@ test()
 	test_load_store_alloca_reduction();
 	test_load_store_reduction();
 	test_load_load_reduction();
+	test_copy();
 
 	return 0;
 }
@@ -175,6 +175,35 @@ test_store_store_reduction()
 	assert(jive::node_output::node(ex->origin())->input(1)->origin() == v2);
 }
 
+static void
+test_copy()
+{
+	using namespace jlm;
+
+	MemoryStateType mt;
+	PointerType pt(jive::bit32);
+
+	jive::graph graph;
+	auto address = graph.add_import({pt, "address"});
+	auto value1 = graph.add_import({jive::bit32, "value1"});
+	auto value2 = graph.add_import({jive::bit32, "value2"});
+	auto state = graph.add_import({mt, "state"});
+
+	auto st = StoreNode::Create(address, value1, {state}, 4);
+	auto node = jive::node_output::node(st[0]);
+
+//	jive::view(graph.root(), stdout);
+
+	auto copy = node->copy(graph.root(), {address, value2, state});
+
+//	jive::view(graph.root(), stdout);
+
+	auto storeNode = dynamic_cast<const StoreNode*>(copy);
+	assert(storeNode);
+	assert(storeNode->GetValueInput()->origin() == value2);
+	assert(storeNode->NumStates() == 1);
+}
+
 static int
 test()
 {
@@ -182,6 +211,7 @@ test()
 	test_store_alloca_reduction();
 	test_multiple_origin_reduction();
 	test_store_store_reduction();
+	test_copy();
 
 	return 0;
 }
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2022 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/tooling/JlmOptServer.hpp>
+
+#include <cassert>
+#include <climits>
+#include <csignal>
+#include <cstring>
+
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * Returns the number of arguments times ten, plus one if the request runs in \p directory.
+ */
+static int
+Handler(int argc, char ** argv, const std::string & directory)
+{
+  char cwd[PATH_MAX];
+  bool inDirectory = getcwd(cwd, sizeof(cwd)) != nullptr && directory == cwd;
+
+  return argc * 10 + (inDirectory ? 1 : 0);
+}
+
+static int
+TestJlmOptServer()
+{
+  using namespace jlm;
+
+  char directoryTemplate[] = "/tmp/jlm-opt-server-XXXXXX";
+  std::string directory(mkdtemp(directoryTemplate));
+  std::string socket = directory + "/socket";
+
+  char cwd[PATH_MAX];
+  assert(getcwd(cwd, sizeof(cwd)) != nullptr);
+  std::string clientDirectory(cwd);
+
+  /*
+   * Arrange
+   */
+  auto pid = fork();
+  if (pid == 0) {
+    JlmOptServer server(socket);
+    _exit(server.Run([&](int argc, char ** argv) { return Handler(argc, argv, clientDirectory); }));
+  }
+
+  /*
+   * Act & Assert: Requests are answered with the exit status of the handler, which runs in the directory of the
+   * client.
+   */
+  std::optional<int> exitStatus;
+  for (size_t n = 0; n < 500 && !exitStatus.has_value(); n++) {
+    exitStatus = JlmOptServer::SendRequest(socket, {"jlm-opt", "--dne", "foo.ll"});
+    if (!exitStatus.has_value())
+      usleep(10000);
+  }
+  assert(exitStatus == 31);
+
+  /*
+   * Assert: Only the user of the server can access the socket.
+   */
+  struct stat status;
+  assert(stat(socket.c_str(), &status) == 0);
+  assert((status.st_mode & 0777) == (S_IRUSR | S_IWUSR));
+
+  exitStatus = JlmOptServer::SendRequest(socket, {"jlm-opt"});
+  assert(exitStatus == 11);
+
+  /*
+   * Act & Assert: No exit status is returned if no server is listening.
+   */
+  exitStatus = JlmOptServer::SendRequest(directory + "/none", {"jlm-opt"});
+  assert(!exitStatus.has_value());
+
+  /*
+   * Act & Assert: The server removes its socket when it is terminated.
+   */
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+  assert(access(socket.c_str(), F_OK) != 0);
+
+  rmdir(directory.c_str());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/tooling/TestJlmOptServer", TestJlmOptServer)